@@ -1,6 +1,7 @@
 #include "benchmark_runner.hpp"
 #include "duckdb_benchmark_macro.hpp"
 #include "duckdb/main/appender.hpp"
+#include "duckdb/common/thread.hpp"
 
 using namespace duckdb;
 
@@ -219,3 +220,52 @@ string BenchmarkInfo() override {
 	return "Write 100K 4-byte integers to CSV";
 }
 FINISH_BENCHMARK(Write100KIntegers)
+
+////////////////
+// CONCURRENT //
+////////////////
+#define APPEND_BENCHMARK_CONCURRENT(SYNCHRONOUS)                                                                       \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("SET synchronous='" SYNCHRONOUS "'");                                                        \
+		state->conn.Query("CREATE TABLE integers(i INTEGER)");                                                         \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		vector<thread> threads;                                                                                        \
+		for (int32_t t = 0; t < 8; t++) {                                                                              \
+			threads.emplace_back([state, t]() {                                                                        \
+				Connection conn(state->db);                                                                            \
+				for (int32_t i = 0; i < 1000; i++) {                                                                   \
+					conn.Query("INSERT INTO integers VALUES (" + std::to_string(t * 1000 + i) + ")");                  \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &worker : threads) {                                                                                 \
+			worker.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DROP TABLE integers");                                                                      \
+		state->conn.Query("CREATE TABLE integers(i INTEGER)");                                                         \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Append 8K 4-byte integers from 8 concurrent connections, committing every INSERT INTO statement "      \
+		       "(synchronous=" SYNCHRONOUS ")";                                                                        \
+	}
+
+DUCKDB_BENCHMARK(Append8KIntegersConcurrentSynchronousFull, "[append]")
+APPEND_BENCHMARK_CONCURRENT("full")
+FINISH_BENCHMARK(Append8KIntegersConcurrentSynchronousFull)
+
+DUCKDB_BENCHMARK(Append8KIntegersConcurrentSynchronousNormal, "[append]")
+APPEND_BENCHMARK_CONCURRENT("normal")
+FINISH_BENCHMARK(Append8KIntegersConcurrentSynchronousNormal)
+
+DUCKDB_BENCHMARK(Append8KIntegersConcurrentSynchronousOff, "[append]")
+APPEND_BENCHMARK_CONCURRENT("off")
+FINISH_BENCHMARK(Append8KIntegersConcurrentSynchronousOff)
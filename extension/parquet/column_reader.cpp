@@ -149,6 +149,43 @@ void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_m
 	}
 }
 
+void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge,
+                                    const vector<ParquetRowRange> &row_ranges) {
+	if (page_locations.empty()) {
+		RegisterPrefetch(transport, allow_merge);
+		return;
+	}
+	D_ASSERT(chunk);
+	// the dictionary page (if any) precedes the first data page
+	auto data_start = NumericCast<idx_t>(page_locations[0].offset);
+	if (FileOffset() < data_start) {
+		transport.RegisterPrefetch(FileOffset(), data_start - FileOffset(), allow_merge);
+	}
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto page_end = page_idx + 1 < page_locations.size()
+		                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                    : NumericCast<idx_t>(chunk->meta_data.num_values);
+		while (range_idx < row_ranges.size() && row_ranges[range_idx].end <= page_start) {
+			range_idx++;
+		}
+		if (range_idx == row_ranges.size()) {
+			break;
+		}
+		if (row_ranges[range_idx].start < page_end) {
+			auto &location = page_locations[page_idx];
+			transport.RegisterPrefetch(NumericCast<idx_t>(location.offset),
+			                           NumericCast<idx_t>(location.compressed_page_size), allow_merge);
+		}
+	}
+}
+
+void ColumnReader::SetPageLocations(vector<PageLocation> page_locations_p) {
+	D_ASSERT(max_repeat == 0);
+	page_locations = std::move(page_locations_p);
+}
+
 uint64_t ColumnReader::TotalCompressedSize() {
 	if (!chunk) {
 		return 0;
@@ -234,6 +271,8 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	page_locations.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -464,15 +503,15 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 
 idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
                          Vector &result) {
-	// we need to reset the location because multiple column readers share the same protocol
-	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
-	trans.SetLocation(chunk_read_offset);
-
 	// Perform any skips that were not applied yet.
 	if (pending_skips > 0) {
 		ApplyPendingSkips(pending_skips);
 	}
 
+	// we need to reset the location because multiple column readers share the same protocol
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+
 	idx_t result_offset = 0;
 	auto to_read = num_values;
 
@@ -580,9 +619,54 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	D_ASSERT(!page_locations.empty());
+	// for columns without repeats, every value is a row
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	if (target_row <= current_row + page_rows_available) {
+		// the skip ends within the current page
+		return num_values;
+	}
+	// find the page that contains the target row
+	idx_t page_idx = page_locations.size();
+	while (page_idx > 0 && NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) > target_row) {
+		page_idx--;
+	}
+	if (page_idx == 0) {
+		return num_values;
+	}
+	page_idx--;
+	auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+	if (page_start <= current_row + page_rows_available) {
+		// the target row is in the next page: there are no pages that can be skipped entirely
+		return num_values;
+	}
+	// if we have not read anything yet, we still need to read the dictionary page that precedes the data pages
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	while (chunk_read_offset < NumericCast<idx_t>(page_locations[0].offset)) {
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+		chunk_read_offset = trans.GetLocation();
+		if (page_rows_available > 0) {
+			throw std::runtime_error("Parquet offset index does not match the data pages of the column chunk");
+		}
+	}
+	// jump directly to the page that contains the target row
+	chunk_read_offset = NumericCast<idx_t>(page_locations[page_idx].offset);
+	page_rows_available = 0;
+	group_rows_available -= page_start - current_row;
+	return target_row - page_start;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	if (!page_locations.empty()) {
+		// skip over the pages we don't need to read at all
+		num_values = SkipPages(num_values);
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
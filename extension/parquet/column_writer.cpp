@@ -85,6 +85,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -323,6 +326,8 @@ struct PageWriteInformation {
 	size_t compressed_size;
 	data_ptr_t compressed_data;
 	unique_ptr<data_t[]> compressed_buf;
+	//! The statistics of this page (only tracked when writing a page index)
+	unique_ptr<ColumnWriterStatistics> page_stats;
 };
 
 class BasicColumnWriterState : public ColumnWriterState {
@@ -339,6 +344,10 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+
+	//! The hashes of the values written to this column chunk (only collected when writing a bloom filter)
+	bool write_bloom_filter = false;
+	vector<uint64_t> bloom_filter_hashes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -365,6 +374,8 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	// the size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	//! When writing a page index we limit the amount of rows per page, so readers can skip individual pages
+	static constexpr const idx_t PAGE_INDEX_MAX_PAGE_ROWS = 20480;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override;
@@ -382,6 +393,18 @@ protected:
 	void NextPage(BasicColumnWriterState &state);
 	void FlushPage(BasicColumnWriterState &state);
 
+	//! Whether or not we write a page index for this column (only supported for non-repeated columns)
+	bool WritePageIndex() {
+		return writer.GetWritePageIndex() && max_repeat == 0;
+	}
+	//! Whether or not we can write a bloom filter for the values of this column
+	virtual bool SupportsBloomFilter() {
+		return false;
+	}
+	//! Computes the bloom filter hashes of the plain-encoded non-null values of (a subset of) a vector
+	virtual void HashVector(Vector &input_column, idx_t chunk_start, idx_t chunk_end, vector<uint64_t> &hashes);
+	void WriteColumnChunkIndex(BasicColumnWriterState &state, const vector<idx_t> &page_offsets);
+
 	//! Initializes the state used to track statistics during writing. Only used for scalar types.
 	virtual unique_ptr<ColumnWriterStatistics> InitializeStatsState();
 
@@ -443,6 +466,9 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	// with a page index, the amount of rows per page is limited as well
+	idx_t max_page_rows = WritePageIndex() ? PAGE_INDEX_MAX_PAGE_ROWS : NumericLimits<idx_t>::Maximum();
+
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = state.page_info.back();
@@ -454,11 +480,11 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
-				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
-				state.page_info.push_back(new_info);
-			}
+		}
+		if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE || page_info.row_count >= max_page_rows) {
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
 		}
 		vector_index++;
 	}
@@ -473,6 +499,7 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	state.write_bloom_filter = writer.GetWriteBloomFilter() && max_repeat == 0 && SupportsBloomFilter();
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -497,6 +524,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (WritePageIndex()) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -567,6 +597,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -596,6 +629,10 @@ idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWrit
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
 }
 
+void BasicColumnWriter::HashVector(Vector &input_column, idx_t chunk_start, idx_t chunk_end, vector<uint64_t> &hashes) {
+	throw InternalException("HashVector unsupported for column writers without bloom filter support");
+}
+
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
 
@@ -610,8 +647,11 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
+		if (state.write_bloom_filter) {
+			HashVector(vector, offset, offset + write_count, state.bloom_filter_hashes);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -689,17 +729,90 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<idx_t> page_offsets;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
+		page_offsets.push_back(header_start_offset);
 		writer.Write(write_info.page_header);
 		// total uncompressed size in the column chunk includes the header size (!)
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
 	}
+	page_offsets.push_back(column_writer.GetTotalWritten());
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	WriteColumnChunkIndex(state, page_offsets);
+}
+
+void BasicColumnWriter::WriteColumnChunkIndex(BasicColumnWriterState &state, const vector<idx_t> &page_offsets) {
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	if (WritePageIndex()) {
+		column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+		column_index->__set_boundary_order(duckdb_parquet::format::BoundaryOrder::UNORDERED);
+		offset_index = make_uniq<duckdb_parquet::format::OffsetIndex>();
+		idx_t page_idx = 0;
+		for (idx_t write_idx = 0; write_idx < state.write_info.size(); write_idx++) {
+			auto &write_info = state.write_info[write_idx];
+			if (write_info.page_header.type == PageType::DICTIONARY_PAGE) {
+				continue;
+			}
+			D_ASSERT(page_idx < state.page_info.size());
+			auto &page_info = state.page_info[page_idx++];
+
+			duckdb_parquet::format::PageLocation location;
+			location.__set_offset(NumericCast<int64_t>(page_offsets[write_idx]));
+			location.__set_compressed_page_size(
+			    NumericCast<int32_t>(page_offsets[write_idx + 1] - page_offsets[write_idx]));
+			location.__set_first_row_index(NumericCast<int64_t>(page_info.offset));
+			offset_index->page_locations.push_back(location);
+
+			if (!column_index) {
+				continue;
+			}
+			idx_t null_count = 0;
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				if (!state.definition_levels.empty() && state.definition_levels[i] < max_define) {
+					null_count++;
+				}
+			}
+			auto min_value = write_info.page_stats->GetMinValue();
+			auto max_value = write_info.page_stats->GetMaxValue();
+			bool null_page = null_count == page_info.row_count;
+			if (!null_page && (min_value.empty() || max_value.empty())) {
+				// we don't have the statistics of this page: we can only write the offset index
+				column_index.reset();
+				continue;
+			}
+			column_index->null_pages.push_back(null_page);
+			column_index->min_values.push_back(null_page ? string() : std::move(min_value));
+			column_index->max_values.push_back(null_page ? string() : std::move(max_value));
+			column_index->null_counts.push_back(NumericCast<int64_t>(null_count));
+		}
+		if (column_index) {
+			column_index->__isset.null_counts = true;
+		}
+	}
+
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+	if (state.write_bloom_filter && !state.bloom_filter_hashes.empty()) {
+		auto &hashes = state.bloom_filter_hashes;
+		std::sort(hashes.begin(), hashes.end());
+		hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+		bloom_filter = make_uniq<ParquetBloomFilter>(hashes.size(), ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+		for (auto &hash : hashes) {
+			bloom_filter->FilterInsert(hash);
+		}
+		hashes.clear();
+	}
+
+	if (column_index || offset_index || bloom_filter) {
+		writer.BufferColumnChunkIndex(state.col_idx, std::move(column_index), std::move(offset_index),
+		                              std::move(bloom_filter));
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -769,6 +882,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -882,6 +1004,21 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	bool SupportsBloomFilter() override {
+		return true;
+	}
+
+	void HashVector(Vector &input_column, idx_t chunk_start, idx_t chunk_end, vector<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				auto target_value = ParquetBloomFilter::NormalizeValue(OP::template Operation<SRC, TGT>(ptr[r]));
+				hashes.push_back(ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(TGT);
 	}
@@ -915,6 +1052,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1046,6 +1188,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1227,6 +1376,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.HasStats()) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1253,8 +1415,8 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool page_stats)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false), page_stats(page_stats) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
@@ -1266,6 +1428,8 @@ public:
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+	//! Whether or not we track the statistics of dictionary encoded pages (for the page index)
+	bool page_stats;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1364,6 +1528,9 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (page_state.page_stats) {
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1390,7 +1557,21 @@ public:
 
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, WritePageIndex());
+	}
+
+	bool SupportsBloomFilter() override {
+		return true;
+	}
+
+	void HashVector(Vector &input_column, idx_t chunk_start, idx_t chunk_end, vector<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				hashes.push_back(ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
@@ -33,11 +33,21 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
 typedef std::bitset<STANDARD_VECTOR_SIZE> parquet_filter_t;
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	ParquetRowRange(idx_t start, idx_t end) : start(start), end(end) {
+	}
+
+	idx_t start;
+	idx_t end;
+};
+
 class ColumnReader {
 public:
 	ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -67,6 +77,11 @@ public:
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
+	// register only the pages that contain rows within the given ranges for prefetching
+	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge, const vector<ParquetRowRange> &row_ranges);
+
+	//! Sets the page locations of the current column chunk (from the offset index), which allows skipping pages
+	void SetPageLocations(vector<PageLocation> page_locations_p);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
@@ -141,6 +156,8 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	//! Skips over the pages that only contain skipped rows, returns the number of rows that remain to be skipped
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -150,6 +167,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The locations of the data pages of the current column chunk, if known
+	vector<PageLocation> page_locations;
 
 	shared_ptr<ResizeableBuffer> block;
 
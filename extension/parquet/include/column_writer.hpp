@@ -48,6 +48,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of (a page of) the same column into this state
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -63,6 +63,12 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Whether or not the page index restricted the rows of the current group that need to be scanned
+	bool has_row_ranges = false;
+	//! The ranges of rows in the current group that can contain matching rows (sorted, non-overlapping)
+	vector<ParquetRowRange> row_ranges;
+	idx_t current_row_range = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -162,6 +168,9 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the page index of the current group to find the ranges of rows that can contain matching rows
+	void PrepareRowRanges(ParquetReaderScanState &state);
+	optional_ptr<ColumnReader> GetFlatColumnReader(ParquetReaderScanState &state, idx_t col_idx);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -5,6 +5,7 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #endif
 #include "parquet_types.h"
+#include "resizable_buffer.hpp"
 
 namespace duckdb {
 
@@ -13,14 +14,81 @@ using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
 class ColumnReader;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
 
+	//! Transforms (column chunk or page level) Parquet statistics of a non-nested column into DuckDB statistics
+	static unique_ptr<BaseStatistics>
+	TransformColumnStatistics(const ColumnReader &reader, const duckdb_parquet::format::Statistics &parquet_stats);
+
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether or not the values of a column read by the reader can be checked against its bloom filter
+	static bool BloomFilterSupported(const ColumnReader &reader);
+
+	//! Returns true if the bloom filter of the column chunk proves that none of the values an equality or IN filter
+	//! looks for can be present in the column chunk
+	static bool BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+	                                const duckdb_parquet::format::ColumnMetaData &column_meta_data,
+	                                duckdb_apache::thrift::protocol::TProtocol &file_proto, Allocator &allocator);
+};
+
+//! A split block bloom filter as described by the Parquet specification
+class ParquetBloomFilter {
+public:
+	//! Each block consists of eight 32-bit words
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! Bloom filters are never larger than 128MB
+	static constexpr const idx_t MAXIMUM_SIZE = 128 * 1024 * 1024;
+	//! The default false positive ratio of bloom filters that are written
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	//! Creates an empty bloom filter sized for the given number of distinct values
+	ParquetBloomFilter(idx_t num_entries, double false_positive_ratio);
+	//! Wraps the bitset of a bloom filter that was read from a file
+	explicit ParquetBloomFilter(unique_ptr<ResizeableBuffer> data);
+
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	//! The bitset of the bloom filter
+	const ResizeableBuffer &Get() const {
+		return *data;
+	}
+
+	//! Computes the hash of a (plain-encoded) value, as used by Parquet bloom filters
+	static uint64_t Hash(const_data_ptr_t value, idx_t size);
+	//! Maps values that compare equal to the same representation before hashing them (i.e. -0.0 and NaN payloads)
+	template <class T>
+	static T NormalizeValue(T value) {
+		return value;
+	}
+
+private:
+	unique_ptr<ResizeableBuffer> data;
+	idx_t block_count;
 };
 
+template <>
+inline float ParquetBloomFilter::NormalizeValue(float value) {
+	if (Value::IsNan(value)) {
+		return std::numeric_limits<float>::quiet_NaN();
+	}
+	return value == 0 ? 0.0f : value;
+}
+
+template <>
+inline double ParquetBloomFilter::NormalizeValue(double value) {
+	if (Value::IsNan(value)) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	return value == 0 ? 0.0 : value;
+}
+
 } // namespace duckdb
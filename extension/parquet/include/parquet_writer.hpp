@@ -19,6 +19,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_types.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
@@ -59,12 +60,22 @@ struct FieldID {
 	static FieldID Deserialize(Deserializer &source);
 };
 
+//! The page index and bloom filter of a column chunk, these are written right before the footer of the file
+struct ParquetColumnChunkIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 class ParquetWriter {
 public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
-	              shared_ptr<ParquetEncryptionConfig> encryption_config);
+	              shared_ptr<ParquetEncryptionConfig> encryption_config, bool write_page_index = false,
+	              bool write_bloom_filter = false);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -87,6 +98,12 @@ public:
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
+	bool GetWritePageIndex() const {
+		return write_page_index;
+	}
+	bool GetWriteBloomFilter() const {
+		return write_bloom_filter;
+	}
 	idx_t FileSize() {
 		lock_guard<mutex> glock(lock);
 		return writer->total_written;
@@ -97,15 +114,25 @@ public:
 	uint32_t Write(const duckdb_apache::thrift::TBase &object);
 	uint32_t WriteData(const const_data_ptr_t buffer, const uint32_t buffer_size);
 
+	//! Buffers the page index and/or bloom filter of a column chunk of the row group that is being flushed
+	void BufferColumnChunkIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                            unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index,
+	                            unique_ptr<ParquetBloomFilter> bloom_filter);
+
 private:
 	static CopyTypeSupport DuckDBTypeToParquetTypeInternal(const LogicalType &duckdb_type,
 	                                                       duckdb_parquet::format::Type::type &type);
+	//! Writes the buffered bloom filters and page indexes, and sets their locations in the file meta data
+	void WriteColumnChunkIndexes();
+
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec;
 	ChildFieldIDs field_ids;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
+	bool write_page_index;
+	bool write_bloom_filter;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -113,6 +140,7 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<ParquetColumnChunkIndex> column_chunk_indexes;
 };
 
 } // namespace duckdb
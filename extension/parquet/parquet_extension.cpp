@@ -130,6 +130,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 	//! How/Whether to encrypt the data
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 
+	//! Whether or not to write the page index (column and offset indexes)
+	bool write_page_index = false;
+	//! Whether or not to write bloom filters for the column chunks
+	bool write_bloom_filter = false;
+
 	ChildFieldIDs field_ids;
 };
 
@@ -318,6 +323,7 @@ public:
 		table_function.get_bind_info = ParquetGetBindInfo;
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.filter_prune = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 		return MultiFileReader::CreateFunctionSet(table_function);
@@ -992,10 +998,17 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "encryption_config") {
 			bind_data->encryption_config = ParquetEncryptionConfig::Create(context, option.second[0]);
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = GetBooleanArgument(option);
+		} else if (loption == "write_bloom_filter") {
+			bind_data->write_bloom_filter = GetBooleanArgument(option);
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->encryption_config && (bind_data->write_page_index || bind_data->write_bloom_filter)) {
+		throw BinderException("WRITE_PAGE_INDEX and WRITE_BLOOM_FILTER are not supported for encrypted Parquet files");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1019,7 +1032,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer = make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                                                parquet_bind.codec, parquet_bind.field_ids.Copy(),
-	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config);
+	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config,
+	                                                parquet_bind.write_page_index, parquet_bind.write_bloom_filter);
 	return std::move(global_state);
 }
 
@@ -1138,6 +1152,8 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(106, "field_ids", bind_data.field_ids);
 	serializer.WritePropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                         bind_data.encryption_config, nullptr);
+	serializer.WritePropertyWithDefault<bool>(108, "write_page_index", bind_data.write_page_index, false);
+	serializer.WritePropertyWithDefault<bool>(109, "write_bloom_filter", bind_data.write_bloom_filter, false);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1151,6 +1167,8 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->field_ids = deserializer.ReadProperty<ChildFieldIDs>(106, "field_ids");
 	deserializer.ReadPropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                          data->encryption_config, nullptr);
+	deserializer.ReadPropertyWithDefault<bool>(108, "write_page_index", data->write_page_index, false);
+	deserializer.ReadPropertyWithDefault<bool>(109, "write_bloom_filter", data->write_bloom_filter, false);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
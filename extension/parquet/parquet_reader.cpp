@@ -22,8 +22,10 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -657,6 +659,12 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
 			}
+			if (!skip_chunk && !parquet_options.encryption_config && GetFlatColumnReader(state, col_idx)) {
+				// check the bloom filter of the column chunk (if any) for equality and IN filters
+				auto &column_chunk = group.columns[column_reader->FileIdx()];
+				skip_chunk = ParquetStatisticsUtils::BloomFilterExcludes(*column_reader, filter, column_chunk.meta_data,
+				                                                         *state.thrift_file_proto, allocator);
+			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
@@ -669,6 +677,172 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+optional_ptr<ColumnReader> ParquetReader::GetFlatColumnReader(ParquetReaderScanState &state, idx_t col_idx) {
+	auto file_col_idx = reader_data.column_ids[col_idx];
+	if (reader_data.cast_map.find(file_col_idx) != reader_data.cast_map.end()) {
+		return nullptr;
+	}
+	auto column_reader = state.root_reader->Cast<StructColumnReader>().GetChildReader(file_col_idx);
+	// only top-level primitive columns map directly onto a single column chunk
+	if (!column_reader->Schema().__isset.type || column_reader->MaxRepeat() > 0 || column_reader->MaxDefine() > 1 ||
+	    column_reader->Type().IsNested()) {
+		return nullptr;
+	}
+	return column_reader;
+}
+
+static bool FilterExcludesNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (FilterExcludesNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Intersects two sorted lists of non-overlapping row ranges
+static vector<ParquetRowRange> IntersectRowRanges(const vector<ParquetRowRange> &left,
+                                                  const vector<ParquetRowRange> &right) {
+	vector<ParquetRowRange> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue(left[left_idx].start, right[right_idx].start);
+		auto end = MinValue(left[left_idx].end, right[right_idx].end);
+		if (start < end) {
+			result.emplace_back(start, end);
+		}
+		if (left[left_idx].end < right[right_idx].end) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::PrepareRowRanges(ParquetReaderScanState &state) {
+	state.has_row_ranges = false;
+	state.row_ranges.clear();
+	state.current_row_range = 0;
+
+	auto &group = GetGroup(state);
+	if (!reader_data.filters || parquet_options.encryption_config || state.group_offset == (idx_t)group.num_rows) {
+		return;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+
+	// use the column index of every filtered column to figure out which pages can contain matching rows
+	vector<ParquetRowRange> row_ranges;
+	row_ranges.emplace_back(0, group_rows);
+	bool used_page_index = false;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto column_reader = GetFlatColumnReader(state, col_idx);
+		if (!column_reader) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+			continue;
+		}
+		duckdb_parquet::format::ColumnIndex column_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+		column_index.read(state.thrift_file_proto.get());
+		duckdb_parquet::format::OffsetIndex offset_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		offset_index.read(state.thrift_file_proto.get());
+
+		auto &pages = offset_index.page_locations;
+		auto page_count = pages.size();
+		if (page_count == 0 || column_index.null_pages.size() != page_count ||
+		    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count ||
+		    (column_index.__isset.null_counts && column_index.null_counts.size() != page_count)) {
+			// malformed or incomplete page index - ignore it
+			continue;
+		}
+
+		auto &filter = *filter_entry->second;
+		auto excludes_nulls = FilterExcludesNulls(filter);
+		vector<ParquetRowRange> column_ranges;
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+			auto page_end =
+			    page_idx + 1 < page_count ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index) : group_rows;
+			bool skip_page = false;
+			if (column_index.null_pages[page_idx]) {
+				skip_page = excludes_nulls;
+			} else {
+				duckdb_parquet::format::Statistics page_stats;
+				page_stats.__set_min_value(column_index.min_values[page_idx]);
+				page_stats.__set_max_value(column_index.max_values[page_idx]);
+				if (column_index.__isset.null_counts) {
+					page_stats.__set_null_count(column_index.null_counts[page_idx]);
+				}
+				auto stats = ParquetStatisticsUtils::TransformColumnStatistics(*column_reader, page_stats);
+				skip_page = stats && filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+			if (skip_page || page_start >= page_end) {
+				continue;
+			}
+			if (!column_ranges.empty() && column_ranges.back().end == page_start) {
+				column_ranges.back().end = page_end;
+			} else {
+				column_ranges.emplace_back(page_start, page_end);
+			}
+		}
+		row_ranges = IntersectRowRanges(row_ranges, column_ranges);
+		used_page_index = true;
+	}
+	if (!used_page_index) {
+		return;
+	}
+	if (row_ranges.empty()) {
+		// no page can contain matching rows: skip the entire group
+		state.group_offset = group_rows;
+		return;
+	}
+	if (row_ranges.size() == 1 && row_ranges[0].start == 0 && row_ranges[0].end == group_rows) {
+		// every page can contain matching rows
+		return;
+	}
+	state.has_row_ranges = true;
+	state.row_ranges = std::move(row_ranges);
+
+	// hand the page locations to the column readers so they can skip over pages without decoding them
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_reader = GetFlatColumnReader(state, col_idx);
+		if (!column_reader) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.offset_index_offset) {
+			continue;
+		}
+		duckdb_parquet::format::OffsetIndex offset_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		offset_index.read(state.thrift_file_proto.get());
+		if (!offset_index.page_locations.empty() && offset_index.page_locations[0].first_row_index == 0) {
+			column_reader->SetPageLocations(std::move(offset_index.page_locations));
+		}
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -880,6 +1054,40 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		SelectionVector sel(count);
+		idx_t approved_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (filter_mask[i]) {
+				sel.set_index(approved_count++, i);
+			}
+		}
+		bloom_filter.Filter(v, sel, approved_count, count);
+		filter_mask.reset();
+		for (idx_t i = 0; i < approved_count; i++) {
+			filter_mask.set(sel.get_index(i));
+		}
+		break;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		SelectionVector sel(count);
+		idx_t approved_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (filter_mask[i]) {
+				sel.set_index(approved_count++, i);
+			}
+		}
+		UnifiedVectorFormat vdata;
+		v.ToUnifiedFormat(count, vdata);
+		in_filter.Filter(vdata, v.GetType(), sel, approved_count);
+		filter_mask.reset();
+		for (idx_t i = 0; i < approved_count; i++) {
+			filter_mask.set(sel.get_index(i));
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -923,6 +1131,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrepareRowRanges(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -961,7 +1170,13 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 						auto entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
 						has_filter = entry != reader_data.filters->filters.end();
 					}
-					root_reader.GetChildReader(file_col_idx)->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					auto child_reader = root_reader.GetChildReader(file_col_idx);
+					if (state.has_row_ranges) {
+						// only fetch the pages that can contain matching rows
+						child_reader->RegisterPrefetch(trans, !(lazy_fetch && !has_filter), state.row_ranges);
+					} else {
+						child_reader->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					}
 				}
 
 				trans.FinalizeRegistration();
@@ -974,6 +1189,27 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	if (state.has_row_ranges) {
+		// skip ahead to the next range of rows that can contain matching rows
+		auto &row_ranges = state.row_ranges;
+		while (state.current_row_range < row_ranges.size() &&
+		       row_ranges[state.current_row_range].end <= state.group_offset) {
+			state.current_row_range++;
+		}
+		auto skip_to = state.current_row_range < row_ranges.size() ? row_ranges[state.current_row_range].start
+		                                                            : NumericCast<idx_t>(GetGroup(state).num_rows);
+		if (skip_to > state.group_offset) {
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_to - state.group_offset);
+			}
+			state.group_offset = skip_to;
+			if (state.current_row_range == row_ranges.size()) {
+				return true;
+			}
+		}
+	}
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
@@ -998,8 +1234,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
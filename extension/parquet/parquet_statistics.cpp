@@ -5,13 +5,19 @@
 #include "parquet_timestamp.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "thrift_tools.hpp"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
 
+#include "zstd/common/xxhash.h"
+
 namespace duckdb {
 
 using duckdb_parquet::format::ConvertedType;
@@ -285,8 +291,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(reader, column_chunk.meta_data.statistics);
+}
 
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformColumnStatistics(const ColumnReader &reader,
+                                                  const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
@@ -352,4 +363,224 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+bool ParquetStatisticsUtils::BloomFilterSupported(const ColumnReader &reader) {
+	if (reader.MaxRepeat() > 0) {
+		return false;
+	}
+	switch (reader.Schema().type) {
+	case Type::INT32:
+		switch (reader.Type().id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::DATE:
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		return reader.Type().id() == LogicalTypeId::BIGINT || reader.Type().id() == LogicalTypeId::UBIGINT;
+	case Type::FLOAT:
+		return reader.Type().id() == LogicalTypeId::FLOAT;
+	case Type::DOUBLE:
+		return reader.Type().id() == LogicalTypeId::DOUBLE;
+	case Type::BYTE_ARRAY:
+		return reader.Type().id() == LogicalTypeId::VARCHAR || reader.Type().id() == LogicalTypeId::BLOB;
+	default:
+		return false;
+	}
+}
+
+//! Hashes a value the way it is plain-encoded in a column of the given type
+static uint64_t BloomFilterHash(const ColumnReader &reader, const Value &value) {
+	switch (reader.Schema().type) {
+	case Type::INT32: {
+		uint32_t plain_value;
+		if (reader.Type().id() == LogicalTypeId::DATE) {
+			plain_value = UnsafeNumericCast<uint32_t>(value.GetValue<date_t>().days);
+		} else {
+			// (unsigned) integers smaller than 64 bits are all stored as INT32
+			plain_value = static_cast<uint32_t>(value.GetValue<int64_t>());
+		}
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(&plain_value), sizeof(uint32_t));
+	}
+	case Type::INT64: {
+		uint64_t plain_value;
+		if (reader.Type().id() == LogicalTypeId::UBIGINT) {
+			plain_value = value.GetValue<uint64_t>();
+		} else {
+			plain_value = static_cast<uint64_t>(value.GetValue<int64_t>());
+		}
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(&plain_value), sizeof(uint64_t));
+	}
+	case Type::FLOAT: {
+		auto plain_value = ParquetBloomFilter::NormalizeValue(value.GetValue<float>());
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(&plain_value), sizeof(float));
+	}
+	case Type::DOUBLE: {
+		auto plain_value = ParquetBloomFilter::NormalizeValue(value.GetValue<double>());
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(&plain_value), sizeof(double));
+	}
+	case Type::BYTE_ARRAY: {
+		auto &plain_value = StringValue::Get(value);
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(plain_value.c_str()), plain_value.size());
+	}
+	default:
+		throw InternalException("Unsupported type for Parquet bloom filter");
+	}
+}
+
+//! Whether the hash of the value is reliable: other writers might hash -0.0 or a NaN with a different payload for
+//! floating point values that compare equal to the value
+static bool BloomFilterCanProbe(const ColumnReader &reader, const Value &value) {
+	switch (reader.Schema().type) {
+	case Type::FLOAT: {
+		auto float_value = value.GetValue<float>();
+		return float_value != 0 && !Value::IsNan(float_value);
+	}
+	case Type::DOUBLE: {
+		auto double_value = value.GetValue<double>();
+		return double_value != 0 && !Value::IsNan(double_value);
+	}
+	default:
+		return true;
+	}
+}
+
+//! Collects the values an equality or IN filter is looking for
+static bool GetEqualityValues(const TableFilter &filter, vector<Value> &values) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		values.push_back(constant_filter.constant);
+		return true;
+	}
+	case TableFilterType::IN_FILTER:
+		values = filter.Cast<InFilter>().values;
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		// if any of the children can be checked against the bloom filter, so can the conjunction
+		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (GetEqualityValues(*child_filter, values)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+                                                 const duckdb_parquet::format::ColumnMetaData &column_meta_data,
+                                                 TProtocol &file_proto, Allocator &allocator) {
+	if (!column_meta_data.__isset.bloom_filter_offset || column_meta_data.bloom_filter_offset <= 0 ||
+	    !BloomFilterSupported(reader)) {
+		return false;
+	}
+	vector<Value> values;
+	if (!GetEqualityValues(filter, values)) {
+		return false;
+	}
+	for (auto &value : values) {
+		if (value.IsNull() || value.type() != reader.Type()) {
+			return false;
+		}
+		if (!BloomFilterCanProbe(reader, value)) {
+			return false;
+		}
+	}
+
+	// read the bloom filter header, followed by the bitset
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto.getTransport());
+	transport.SetLocation(column_meta_data.bloom_filter_offset);
+	duckdb_parquet::format::BloomFilterHeader filter_header;
+	filter_header.read(&file_proto);
+	if (!filter_header.algorithm.__isset.BLOCK || !filter_header.hash.__isset.XXHASH ||
+	    !filter_header.compression.__isset.UNCOMPRESSED) {
+		// unsupported bloom filter
+		return false;
+	}
+	auto num_bytes = filter_header.numBytes;
+	if (num_bytes <= 0 || num_bytes % ParquetBloomFilter::BLOCK_SIZE != 0 ||
+	    idx_t(num_bytes) > ParquetBloomFilter::MAXIMUM_SIZE) {
+		throw InvalidInputException("Malformed Parquet bloom filter: invalid size %d", num_bytes);
+	}
+	auto buffer = make_uniq<ResizeableBuffer>(allocator, num_bytes);
+	transport.read(buffer->ptr, num_bytes);
+	ParquetBloomFilter bloom_filter(std::move(buffer));
+
+	for (auto &value : values) {
+		if (bloom_filter.FilterCheck(BloomFilterHash(reader, value))) {
+			// this value might be present
+			return false;
+		}
+	}
+	return true;
+}
+
+// The salt values and the block layout are defined by the Parquet specification
+static constexpr const uint32_t PARQUET_BLOOM_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                         0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_entries, double false_positive_ratio) {
+	// the optimal number of bits for a split block bloom filter with the given false positive ratio
+	auto bits = -8.0 * double(MaxValue<idx_t>(num_entries, 1)) / std::log(1 - std::pow(false_positive_ratio, 1.0 / 8));
+	auto num_bytes = NextPowerOfTwo(MaxValue<idx_t>(idx_t(bits / 8), BLOCK_SIZE));
+	num_bytes = MinValue<idx_t>(num_bytes, MAXIMUM_SIZE);
+	block_count = num_bytes / BLOCK_SIZE;
+
+	data = make_uniq<ResizeableBuffer>(Allocator::DefaultAllocator(), num_bytes);
+	data->zero();
+}
+
+ParquetBloomFilter::ParquetBloomFilter(unique_ptr<ResizeableBuffer> data_p) : data(std::move(data_p)) {
+	D_ASSERT(data->len % BLOCK_SIZE == 0);
+	block_count = data->len / BLOCK_SIZE;
+}
+
+static void ParquetBloomMask(uint32_t key, uint32_t mask[8]) {
+	for (idx_t i = 0; i < 8; i++) {
+		mask[i] = 1U << ((key * PARQUET_BLOOM_SALT[i]) >> 27);
+	}
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto block = reinterpret_cast<uint32_t *>(data->ptr + block_idx * BLOCK_SIZE);
+	uint32_t mask[8];
+	ParquetBloomMask(static_cast<uint32_t>(hash), mask);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= mask[i];
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto block = reinterpret_cast<const uint32_t *>(data->ptr + block_idx * BLOCK_SIZE);
+	uint32_t mask[8];
+	ParquetBloomMask(static_cast<uint32_t>(hash), mask);
+	for (idx_t i = 0; i < 8; i++) {
+		if ((block[i] & mask[i]) == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t value, idx_t size) {
+	return duckdb_zstd::XXH64(value, size, 0);
+}
+
 } // namespace duckdb
@@ -350,9 +350,11 @@ void VerifyUniqueNames(const vector<string> &names) {
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalType> types_p, vector<string> names_p,
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
-                             shared_ptr<ParquetEncryptionConfig> encryption_config_p)
+                             shared_ptr<ParquetEncryptionConfig> encryption_config_p, bool write_page_index,
+                             bool write_bloom_filter)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
-      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)) {
+      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
+      write_page_index(write_page_index), write_bloom_filter(write_bloom_filter) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -499,7 +501,69 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::BufferColumnChunkIndex(idx_t column_idx,
+                                           unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                           unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index,
+                                           unique_ptr<ParquetBloomFilter> bloom_filter) {
+	// this is called while flushing a row group (i.e. while holding the lock), before it is added to the meta data
+	ParquetColumnChunkIndex index;
+	index.row_group_idx = file_meta_data.row_groups.size();
+	index.column_idx = column_idx;
+	index.column_index = std::move(column_index);
+	index.offset_index = std::move(offset_index);
+	index.bloom_filter = std::move(bloom_filter);
+	column_chunk_indexes.push_back(std::move(index));
+}
+
+void ParquetWriter::WriteColumnChunkIndexes() {
+	// the bloom filters are written first, followed by all column indexes and then all offset indexes
+	// this way readers can fetch the indexes they need with a single read
+	for (auto &index : column_chunk_indexes) {
+		if (!index.bloom_filter) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[index.row_group_idx].columns[index.column_idx];
+		auto &bloom_filter = index.bloom_filter->Get();
+		auto start_offset = writer->GetTotalWritten();
+
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bloom_filter.len);
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+		Write(header);
+		writer->WriteData(bloom_filter.ptr, bloom_filter.len);
+
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(start_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(writer->GetTotalWritten() - start_offset));
+	}
+	for (auto &index : column_chunk_indexes) {
+		if (!index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[index.row_group_idx].columns[index.column_idx];
+		auto start_offset = writer->GetTotalWritten();
+		Write(*index.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(start_offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - start_offset));
+	}
+	for (auto &index : column_chunk_indexes) {
+		if (!index.offset_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[index.row_group_idx].columns[index.column_idx];
+		auto start_offset = writer->GetTotalWritten();
+		Write(*index.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(start_offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - start_offset));
+	}
+	column_chunk_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WriteColumnChunkIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
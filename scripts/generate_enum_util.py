@@ -7,7 +7,7 @@ import glob
 os.chdir(os.path.dirname(__file__))
 
 # Dont generate serialization for these enums
-blacklist = ["RegexOptions", "Flags"]
+blacklist = ["RegexOptions", "Flags", "TemporaryBufferSize"]
 
 enum_util_header_file = os.path.join("..", "src", "include", "duckdb", "common", "enum_util.hpp")
 enum_util_source_file = os.path.join("..", "src", "common", "enum_util.cpp")
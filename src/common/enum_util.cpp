@@ -49,6 +49,7 @@
 #include "duckdb/common/enums/statement_type.hpp"
 #include "duckdb/common/enums/subquery_type.hpp"
 #include "duckdb/common/enums/tableref_type.hpp"
+#include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
 #include "duckdb/common/enums/vector_type.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
@@ -58,6 +59,7 @@
 #include "duckdb/common/extra_type_info.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/file_open_flags.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/sort/partition_state.hpp"
 #include "duckdb/common/types.hpp"
@@ -1168,6 +1170,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1213,6 +1217,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -2881,6 +2888,34 @@ HLLStorageType EnumUtil::FromString<HLLStorageType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<HardwareCounterType>(HardwareCounterType value) {
+	switch(value) {
+	case HardwareCounterType::CPU_CYCLES:
+		return "CPU_CYCLES";
+	case HardwareCounterType::INSTRUCTIONS:
+		return "INSTRUCTIONS";
+	case HardwareCounterType::CACHE_MISSES:
+		return "CACHE_MISSES";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+HardwareCounterType EnumUtil::FromString<HardwareCounterType>(const char *value) {
+	if (StringUtil::Equals(value, "CPU_CYCLES")) {
+		return HardwareCounterType::CPU_CYCLES;
+	}
+	if (StringUtil::Equals(value, "INSTRUCTIONS")) {
+		return HardwareCounterType::INSTRUCTIONS;
+	}
+	if (StringUtil::Equals(value, "CACHE_MISSES")) {
+		return HardwareCounterType::CACHE_MISSES;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<IndexConstraintType>(IndexConstraintType value) {
 	switch(value) {
@@ -3862,6 +3897,8 @@ const char* EnumUtil::ToChars<MemoryTag>(MemoryTag value) {
 		return "ALLOCATOR";
 	case MemoryTag::EXTENSION:
 		return "EXTENSION";
+	case MemoryTag::WINDOW:
+		return "WINDOW";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -3905,6 +3942,9 @@ MemoryTag EnumUtil::FromString<MemoryTag>(const char *value) {
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return MemoryTag::EXTENSION;
 	}
+	if (StringUtil::Equals(value, "WINDOW")) {
+		return MemoryTag::WINDOW;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -3925,6 +3965,10 @@ const char* EnumUtil::ToChars<NType>(NType value) {
 		return "NODE_256";
 	case NType::LEAF_INLINED:
 		return "LEAF_INLINED";
+	case NType::NODE_7:
+		return "NODE_7";
+	case NType::NODE_15:
+		return "NODE_15";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -3953,6 +3997,12 @@ NType EnumUtil::FromString<NType>(const char *value) {
 	if (StringUtil::Equals(value, "LEAF_INLINED")) {
 		return NType::LEAF_INLINED;
 	}
+	if (StringUtil::Equals(value, "NODE_7")) {
+		return NType::NODE_7;
+	}
+	if (StringUtil::Equals(value, "NODE_15")) {
+		return NType::NODE_15;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -4168,6 +4218,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::JOIN_FILTER_PUSHDOWN:
+		return "JOIN_FILTER_PUSHDOWN";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -4231,6 +4283,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "JOIN_FILTER_PUSHDOWN")) {
+		return OptimizerType::JOIN_FILTER_PUSHDOWN;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -4622,6 +4677,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::SORT_GROUP_BY:
+		return "SORT_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -4792,6 +4849,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "SORT_GROUP_BY")) {
+		return PhysicalOperatorType::SORT_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -5171,6 +5231,8 @@ const char* EnumUtil::ToChars<PreparedStatementMode>(PreparedStatementMode value
 		return "PREPARE_ONLY";
 	case PreparedStatementMode::PREPARE_AND_EXECUTE:
 		return "PREPARE_AND_EXECUTE";
+	case PreparedStatementMode::PREPARE_FOR_PLAN_CACHE:
+		return "PREPARE_FOR_PLAN_CACHE";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -5184,6 +5246,9 @@ PreparedStatementMode EnumUtil::FromString<PreparedStatementMode>(const char *va
 	if (StringUtil::Equals(value, "PREPARE_AND_EXECUTE")) {
 		return PreparedStatementMode::PREPARE_AND_EXECUTE;
 	}
+	if (StringUtil::Equals(value, "PREPARE_FOR_PLAN_CACHE")) {
+		return PreparedStatementMode::PREPARE_FOR_PLAN_CACHE;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6540,6 +6605,10 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6565,6 +6634,12 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6720,6 +6795,62 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TaskPriority>(TaskPriority value) {
+	switch(value) {
+	case TaskPriority::LOW:
+		return "LOW";
+	case TaskPriority::NORMAL:
+		return "NORMAL";
+	case TaskPriority::HIGH:
+		return "HIGH";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TaskPriority EnumUtil::FromString<TaskPriority>(const char *value) {
+	if (StringUtil::Equals(value, "LOW")) {
+		return TaskPriority::LOW;
+	}
+	if (StringUtil::Equals(value, "NORMAL")) {
+		return TaskPriority::NORMAL;
+	}
+	if (StringUtil::Equals(value, "HIGH")) {
+		return TaskPriority::HIGH;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<ThreadPinMode>(ThreadPinMode value) {
+	switch(value) {
+	case ThreadPinMode::OFF:
+		return "OFF";
+	case ThreadPinMode::ON:
+		return "ON";
+	case ThreadPinMode::AUTO:
+		return "AUTO";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+ThreadPinMode EnumUtil::FromString<ThreadPinMode>(const char *value) {
+	if (StringUtil::Equals(value, "OFF")) {
+		return ThreadPinMode::OFF;
+	}
+	if (StringUtil::Equals(value, "ON")) {
+		return ThreadPinMode::ON;
+	}
+	if (StringUtil::Equals(value, "AUTO")) {
+		return ThreadPinMode::AUTO;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
@@ -7110,6 +7241,34 @@ VerifyExistenceType EnumUtil::FromString<VerifyExistenceType>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<WALSynchronousMode>(WALSynchronousMode value) {
+	switch(value) {
+	case WALSynchronousMode::OFF:
+		return "OFF";
+	case WALSynchronousMode::NORMAL:
+		return "NORMAL";
+	case WALSynchronousMode::FULL:
+		return "FULL";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+WALSynchronousMode EnumUtil::FromString<WALSynchronousMode>(const char *value) {
+	if (StringUtil::Equals(value, "OFF")) {
+		return WALSynchronousMode::OFF;
+	}
+	if (StringUtil::Equals(value, "NORMAL")) {
+		return WALSynchronousMode::NORMAL;
+	}
+	if (StringUtil::Equals(value, "FULL")) {
+		return WALSynchronousMode::FULL;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<WALType>(WALType value) {
 	switch(value) {
@@ -0,0 +1,94 @@
+#include "duckdb/common/hardware_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+const char *HardwareCounterValues::GetName(HardwareCounterType type) {
+	switch (type) {
+	case HardwareCounterType::CPU_CYCLES:
+		return "cpu_cycles";
+	case HardwareCounterType::INSTRUCTIONS:
+		return "instructions";
+	case HardwareCounterType::CACHE_MISSES:
+		return "cache_misses";
+	default:
+		throw InternalException("Unknown HardwareCounterType");
+	}
+}
+
+HardwareCounters::HardwareCounters() : opened(false) {
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		fds[i] = -1;
+	}
+}
+
+HardwareCounters::~HardwareCounters() {
+	Close();
+}
+
+#if defined(__linux__)
+static int OpenPerfEvent(uint64_t config) {
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	// measure the calling thread on any cpu
+	auto fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	return fd < 0 ? -1 : int(fd);
+}
+#endif
+
+void HardwareCounters::Open() {
+	Close();
+	opened = true;
+	thread_id = std::this_thread::get_id();
+#if defined(__linux__)
+	fds[uint8_t(HardwareCounterType::CPU_CYCLES)] = OpenPerfEvent(PERF_COUNT_HW_CPU_CYCLES);
+	fds[uint8_t(HardwareCounterType::INSTRUCTIONS)] = OpenPerfEvent(PERF_COUNT_HW_INSTRUCTIONS);
+	fds[uint8_t(HardwareCounterType::CACHE_MISSES)] = OpenPerfEvent(PERF_COUNT_HW_CACHE_MISSES);
+#endif
+}
+
+void HardwareCounters::Close() {
+#if defined(__linux__)
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		if (fds[i] >= 0) {
+			close(fds[i]);
+		}
+	}
+#endif
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		fds[i] = -1;
+	}
+	opened = false;
+}
+
+bool HardwareCounters::Read(HardwareCounterValues &result) {
+	if (!opened || thread_id != std::this_thread::get_id()) {
+		// tasks can be picked up by different threads - (re-)open the counters for the current thread
+		Open();
+	}
+	bool success = false;
+#if defined(__linux__)
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		uint64_t value = 0;
+		if (fds[i] >= 0 && read(fds[i], &value, sizeof(value)) == sizeof(value)) {
+			result.values[i] = value;
+			success = true;
+		} else {
+			result.values[i] = 0;
+		}
+	}
+#endif
+	return success;
+}
+
+} // namespace duckdb
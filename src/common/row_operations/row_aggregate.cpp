@@ -69,6 +69,11 @@ void RowOperations::UpdateFilteredStates(RowOperationsState &state, AggregateFil
 
 void RowOperations::CombineStates(RowOperationsState &state, TupleDataLayout &layout, Vector &sources, Vector &targets,
                                   idx_t count) {
+	CombineStates(state, layout, sources, targets, count, AggregateCombineType::ALLOW_DESTRUCTIVE);
+}
+
+void RowOperations::CombineStates(RowOperationsState &state, TupleDataLayout &layout, Vector &sources, Vector &targets,
+                                  idx_t count, AggregateCombineType combine_type) {
 	if (count == 0) {
 		return;
 	}
@@ -82,8 +87,7 @@ void RowOperations::CombineStates(RowOperationsState &state, TupleDataLayout &la
 
 	for (auto &aggr : layout.GetAggregates()) {
 		D_ASSERT(aggr.function.combine);
-		AggregateInputData aggr_input_data(aggr.GetFunctionData(), state.allocator,
-		                                   AggregateCombineType::ALLOW_DESTRUCTIVE);
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), state.allocator, combine_type);
 		aggr.function.combine(sources, targets, aggr_input_data, count);
 
 		// Move to the next aggregate states
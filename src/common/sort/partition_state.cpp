@@ -513,20 +513,22 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 		return true;
 
 	case PartitionSortStage::PREPARE:
-		total_tasks = global_sort->sorted_blocks.size() / 2;
-		if (!total_tasks) {
+		if (global_sort->sorted_blocks.size() < 2) {
 			break;
 		}
+		//	The merge sorters split the pairs of blocks into partitions,
+		//	so even the final merge of a single pair can use all the threads.
+		total_tasks = num_threads;
 		stage = PartitionSortStage::MERGE;
 		global_sort->InitializeMergeRound();
 		return true;
 
 	case PartitionSortStage::MERGE:
 		global_sort->CompleteMergeRound(true);
-		total_tasks = global_sort->sorted_blocks.size() / 2;
-		if (!total_tasks) {
+		if (global_sort->sorted_blocks.size() < 2) {
 			break;
 		}
+		total_tasks = num_threads;
 		global_sort->InitializeMergeRound();
 		return true;
 
@@ -534,6 +536,7 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 		break;
 	}
 
+	total_tasks = 0;
 	stage = PartitionSortStage::SORTED;
 
 	return false;
@@ -489,6 +489,12 @@ unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const QueryProfiler::TreeNod
 	result->extra_text += "\n" + to_string(op.info.elements);
 	string timing = StringUtil::Format("%.2f", op.info.time);
 	result->extra_text += "\n(" + timing + "s)";
+	if (!op.info.counters.empty()) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		for (auto &counter : op.info.counters) {
+			result->extra_text += "\n" + counter.first + ": " + to_string(counter.second);
+		}
+	}
 	return result;
 }
 
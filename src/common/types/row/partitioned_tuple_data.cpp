@@ -352,6 +352,48 @@ void PartitionedTupleData::Repartition(PartitionedTupleData &new_partitioned_dat
 	Verify();
 }
 
+void PartitionedTupleData::Repartition(idx_t partition_idx, PartitionedTupleData &new_partitioned_data) {
+	D_ASSERT(layout.GetTypes() == new_partitioned_data.layout.GetTypes());
+	auto &partition = *partitions[partition_idx];
+	const auto partition_count = partition.Count();
+	const auto partition_size = partition.SizeInBytes();
+
+	if (partition_count > 0) {
+		PartitionedTupleDataAppendState append_state;
+		new_partitioned_data.InitializeAppendState(append_state);
+
+		TupleDataChunkIterator iterator(partition, TupleDataPinProperties::DESTROY_AFTER_DONE, true);
+		auto &chunk_state = iterator.GetChunkState();
+		do {
+			new_partitioned_data.Append(append_state, chunk_state, iterator.GetCurrentChunkCount());
+		} while (iterator.Next());
+		new_partitioned_data.FlushAppendState(append_state);
+	}
+	partition.Reset();
+
+	count -= partition_count;
+	data_size -= partition_size;
+
+	Verify();
+}
+
+void PartitionedTupleData::MovePartition(idx_t partition_idx, PartitionedTupleData &new_partitioned_data,
+                                         idx_t new_partition_idx) {
+	D_ASSERT(layout.GetTypes() == new_partitioned_data.layout.GetTypes());
+	auto &partition = *partitions[partition_idx];
+	const auto partition_count = partition.Count();
+	const auto partition_size = partition.SizeInBytes();
+
+	new_partitioned_data.partitions[new_partition_idx]->Combine(partition);
+	new_partitioned_data.count += partition_count;
+	new_partitioned_data.data_size += partition_size;
+	count -= partition_count;
+	data_size -= partition_size;
+
+	Verify();
+	new_partitioned_data.Verify();
+}
+
 void PartitionedTupleData::Unpin() {
 	for (auto &partition : partitions) {
 		partition->Unpin();
@@ -316,6 +316,7 @@ AggregateFunction GetTypedModeFunction(const LogicalType &type) {
 	auto return_type = type.id() == LogicalTypeId::ANY ? LogicalType::VARCHAR : type;
 	auto func = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, return_type);
 	func.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
+	func.holistic = true;
 	return func;
 }
 
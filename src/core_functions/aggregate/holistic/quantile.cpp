@@ -663,13 +663,157 @@ struct PointerLess {
 	}
 };
 
+// How the values of a regular aggregation are stored in the arena
+template <typename SAVE_TYPE>
+struct QuantileStorage {
+	using StorageType = SAVE_TYPE;
+
+	template <class INPUT_TYPE>
+	static inline StorageType Store(ArenaAllocator &, const INPUT_TYPE &input) {
+		return StorageType(input);
+	}
+};
+
+template <>
+struct QuantileStorage<std::string> {
+	//	Strings are copied into the arena too, so the stored values never need a destructor
+	using StorageType = string_t;
+
+	static inline string_t Store(ArenaAllocator &allocator, const string_t &input) {
+		if (input.IsInlined()) {
+			return input;
+		}
+		const auto size = input.GetSize();
+		auto data = allocator.Allocate(size);
+		memcpy(data, input.GetData(), size);
+		return string_t(char_ptr_cast(data), UnsafeNumericCast<uint32_t>(size));
+	}
+};
+
+//! The values of a regular aggregation, kept in a list of segments in the aggregate's arena.
+//! Their memory is allocated through the buffer manager, and merging two lists is just linking them.
+//! The arena can not be spilled. A GROUP BY sorts on the groups first (see PhysicalSortAggregate), so only the values
+//! of the groups in the current chunk have to fit in memory.
+template <typename SAVE_TYPE>
+struct QuantileValues {
+	using Storage = QuantileStorage<SAVE_TYPE>;
+	using StorageType = typename Storage::StorageType;
+	static_assert(std::is_trivially_destructible<StorageType>::value, "stored quantile values can not be destroyed");
+
+	struct Segment {
+		Segment *next;
+		idx_t count;
+		idx_t capacity;
+
+		inline StorageType *GetData() {
+			return reinterpret_cast<StorageType *>(this + 1);
+		}
+		inline const StorageType *GetData() const {
+			return reinterpret_cast<const StorageType *>(this + 1);
+		}
+	};
+
+	static constexpr idx_t MINIMUM_SEGMENT_CAPACITY = 16;
+	static constexpr idx_t MAXIMUM_SEGMENT_CAPACITY = STANDARD_VECTOR_SIZE;
+
+	QuantileValues() : first(nullptr), last(nullptr), count(0) {
+	}
+
+	inline bool empty() const { // NOLINT: match vector
+		return count == 0;
+	}
+
+	inline idx_t size() const { // NOLINT: match vector
+		return count;
+	}
+
+	template <class INPUT_TYPE>
+	inline void Append(ArenaAllocator &allocator, const INPUT_TYPE &input) {
+		if (!last || last->count == last->capacity) {
+			AppendSegment(allocator);
+		}
+		last->GetData()[last->count++] = Storage::Store(allocator, input);
+		count++;
+	}
+
+	void AppendSegment(ArenaAllocator &allocator) {
+		//	Grow the segments with the number of values, so small groups stay small
+		const auto capacity =
+		    last ? MinValue<idx_t>(last->capacity * 2, MAXIMUM_SEGMENT_CAPACITY) : MINIMUM_SEGMENT_CAPACITY;
+		auto segment =
+		    reinterpret_cast<Segment *>(allocator.AllocateAligned(sizeof(Segment) + capacity * sizeof(StorageType)));
+		segment->next = nullptr;
+		segment->count = 0;
+		segment->capacity = capacity;
+		if (last) {
+			last->next = segment;
+		} else {
+			first = segment;
+		}
+		last = segment;
+	}
+
+	//! Take over the segments of another list (whose arena must outlive ours)
+	void Absorb(QuantileValues &other) {
+		if (other.empty()) {
+			return;
+		}
+		if (last) {
+			last->next = other.first;
+		} else {
+			first = other.first;
+		}
+		last = other.last;
+		count += other.count;
+
+		other.first = other.last = nullptr;
+		other.count = 0;
+	}
+
+	//! Copy the values of another list, which is left intact
+	void Append(ArenaAllocator &allocator, const QuantileValues &other) {
+		for (auto segment = other.first; segment; segment = segment->next) {
+			auto data = segment->GetData();
+			for (idx_t i = 0; i < segment->count; i++) {
+				Append(allocator, data[i]);
+			}
+		}
+	}
+
+	//! Move the values into a single segment, so they can be selected from in place
+	StorageType *Compact(ArenaAllocator &allocator) {
+		D_ASSERT(first);
+		if (first == last) {
+			return first->GetData();
+		}
+		//	The stored values are trivially copyable: strings only point into the arena
+		auto segment =
+		    reinterpret_cast<Segment *>(allocator.AllocateAligned(sizeof(Segment) + count * sizeof(StorageType)));
+		segment->next = nullptr;
+		segment->count = count;
+		segment->capacity = count;
+		auto data = segment->GetData();
+		for (auto source = first; source; source = source->next) {
+			memcpy(data, source->GetData(), source->count * sizeof(StorageType));
+			data += source->count;
+		}
+		first = last = segment;
+		return segment->GetData();
+	}
+
+	Segment *first;
+	Segment *last;
+	idx_t count;
+};
+
 template <typename INPUT_TYPE, typename SAVE_TYPE>
 struct QuantileState {
 	using SaveType = SAVE_TYPE;
 	using InputType = INPUT_TYPE;
+	using StorageType = typename QuantileValues<SaveType>::StorageType;
 
 	// Regular aggregation
-	vector<SaveType> v;
+	QuantileValues<SaveType> v;
 
 	// Windowed Quantile merge sort trees
 	using QuantileSortTree32 = QuantileSortTree<uint32_t>;
@@ -822,16 +966,21 @@ struct QuantileOperation {
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
-	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
-		state.v.emplace_back(input);
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		state.v.Append(unary_input.input.allocator, input);
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
 		if (source.v.empty()) {
 			return;
 		}
-		target.v.insert(target.v.end(), source.v.begin(), source.v.end());
+		if (aggr_input_data.combine_type == AggregateCombineType::ALLOW_DESTRUCTIVE) {
+			auto &other = const_cast<STATE &>(source); // NOLINT: absorb explicitly allows destruction
+			target.v.Absorb(other.v);
+		} else {
+			target.v.Append(aggr_input_data.allocator, source.v);
+		}
 	}
 
 	template <class STATE>
@@ -921,8 +1070,10 @@ struct QuantileScalarOperation : public QuantileOperation {
 		D_ASSERT(finalize_data.input.bind_data);
 		auto &bind_data = finalize_data.input.bind_data->Cast<QuantileBindData>();
 		D_ASSERT(bind_data.quantiles.size() == 1);
+		using STORAGE_TYPE = typename STATE::StorageType;
+		auto v_t = state.v.Compact(finalize_data.input.allocator);
 		Interpolator<DISCRETE> interp(bind_data.quantiles[0], state.v.size(), bind_data.desc);
-		target = interp.template Operation<typename STATE::SaveType, T>(state.v.data(), finalize_data.result);
+		target = interp.template Operation<STORAGE_TYPE, T>(v_t, finalize_data.result);
 	}
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
@@ -967,6 +1118,7 @@ AggregateFunction GetTypedDiscreteQuantileAggregateFunction(const LogicalType &t
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, return_type);
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
 	fun.window_init = OP::WindowInit<STATE, INPUT_TYPE>;
+	fun.holistic = true;
 	return fun;
 }
 
@@ -1035,7 +1187,8 @@ struct QuantileListOperation : public QuantileOperation {
 		ListVector::Reserve(finalize_data.result, ridx + bind_data.quantiles.size());
 		auto rdata = FlatVector::GetData<CHILD_TYPE>(result);
 
-		auto v_t = state.v.data();
+		using STORAGE_TYPE = typename STATE::StorageType;
+		auto v_t = state.v.Compact(finalize_data.input.allocator);
 		D_ASSERT(v_t);
 
 		auto &entry = target;
@@ -1045,7 +1198,7 @@ struct QuantileListOperation : public QuantileOperation {
 			const auto &quantile = bind_data.quantiles[q];
 			Interpolator<DISCRETE> interp(quantile, state.v.size(), bind_data.desc);
 			interp.begin = lower;
-			rdata[ridx + q] = interp.template Operation<typename STATE::SaveType, CHILD_TYPE>(v_t, result);
+			rdata[ridx + q] = interp.template Operation<STORAGE_TYPE, CHILD_TYPE>(v_t, result);
 			lower = interp.FRN;
 		}
 		entry.length = bind_data.quantiles.size();
@@ -1089,6 +1242,7 @@ AggregateFunction GetTypedDiscreteQuantileListAggregateFunction(const LogicalTyp
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.holistic = true;
 	return fun;
 }
 
@@ -1147,6 +1301,7 @@ AggregateFunction GetTypedContinuousQuantileAggregateFunction(const LogicalType
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.holistic = true;
 	return fun;
 }
 
@@ -1202,6 +1357,7 @@ AggregateFunction GetTypedContinuousQuantileListAggregateFunction(const LogicalT
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.holistic = true;
 	return fun;
 }
 
@@ -1336,11 +1492,12 @@ struct MedianAbsoluteDeviationOperation : public QuantileOperation {
 		auto &bind_data = finalize_data.input.bind_data->Cast<QuantileBindData>();
 		D_ASSERT(bind_data.quantiles.size() == 1);
 		const auto &q = bind_data.quantiles[0];
+		auto v_t = state.v.Compact(finalize_data.input.allocator);
 		Interpolator<false> interp(q, state.v.size(), false);
-		const auto med = interp.template Operation<SAVE_TYPE, MEDIAN_TYPE>(state.v.data(), finalize_data.result);
+		const auto med = interp.template Operation<SAVE_TYPE, MEDIAN_TYPE>(v_t, finalize_data.result);
 
 		MadAccessor<SAVE_TYPE, T, MEDIAN_TYPE> accessor(med);
-		target = interp.template Operation<SAVE_TYPE, T>(state.v.data(), finalize_data.result, accessor);
+		target = interp.template Operation<SAVE_TYPE, T>(v_t, finalize_data.result, accessor);
 	}
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
@@ -1417,6 +1574,7 @@ AggregateFunction GetTypedMedianAbsoluteDeviationAggregateFunction(const Logical
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.holistic = true;
 	return fun;
 }
 
@@ -280,6 +280,29 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	return new_group_count;
 }
 
+idx_t GroupedAggregateHashTable::AddStates(DataChunk &groups, Vector &source_rows,
+                                           const TupleDataLayout &source_layout) {
+	D_ASSERT(source_layout.GetAggrWidth() == layout.GetAggrWidth());
+	if (groups.size() == 0) {
+		return 0;
+	}
+
+	const auto new_group_count = FindOrCreateGroups(groups, state.addresses, state.new_groups);
+
+	// The source rows have different group columns: shift their addresses so the states line up with this layout
+	Vector source_addresses(LogicalType::POINTER);
+	VectorOperations::Copy(source_rows, source_addresses, groups.size(), 0, 0);
+	const auto offset_delta = int64_t(source_layout.GetAggrOffset()) - int64_t(layout.GetAggrOffset());
+	VectorOperations::AddInPlace(source_addresses, offset_delta, groups.size());
+
+	RowOperationsState row_state(*aggregate_allocator);
+	RowOperations::CombineStates(row_state, layout, source_addresses, state.addresses, groups.size(),
+	                             AggregateCombineType::PRESERVE_INPUT);
+
+	Verify();
+	return new_group_count;
+}
+
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
 #ifdef DEBUG
 	groups.Verify();
@@ -1,40 +1,79 @@
 #include "duckdb/execution/index/art/art.hpp"
 
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/radix.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/execution/index/art/iterator.hpp"
 #include "duckdb/execution/index/art/leaf.hpp"
+#include "duckdb/execution/index/art/node15.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
+#include "duckdb/execution/index/art/node7.hpp"
 #include "duckdb/execution/index/art/prefix.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
-#include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 
 namespace duckdb {
 
+//! A range of keys scanned by an index scan. The bounds can be prefixes of the keys in the ART, in which case they
+//! are inclusive, and include all keys starting with the bound
+struct ARTScanRange {
+	//! The lower bound, or an empty key if there is no lower bound
+	ARTKey lower;
+	bool lower_inclusive = true;
+	//! The upper bound, or an empty key if there is no upper bound
+	ARTKey upper;
+	bool upper_inclusive = true;
+	//! True, if the range consists of the single (complete) key in lower
+	bool point_lookup = false;
+};
+
 struct ARTIndexScanState : public IndexScanState {
+	explicit ARTIndexScanState(Allocator &allocator) : arena_allocator(allocator) {
+	}
 
-	//! Scan predicates (single predicate scan or range scan)
-	Value values[2];
-	//! Expressions of the scan predicates
-	ExpressionType expressions[2];
-	bool checked = false;
-	//! All scanned row IDs
-	vector<row_t> result_ids;
-	Iterator iterator;
+	//! Holds the keys of the scan ranges
+	ArenaAllocator arena_allocator;
+	//! The key ranges to scan
+	vector<ARTScanRange> ranges;
 };
 
 //===--------------------------------------------------------------------===//
 // ART
 //===--------------------------------------------------------------------===//
 
+static uint8_t GetPrefixCount(const bool compact_nodes, const vector<PhysicalType> &types) {
+	// we serialize the buffers of the prefix allocator as-is, and older versions of DuckDB read prefix segments
+	// with PREFIX_SIZE bytes
+	if (!compact_nodes) {
+		return Node::PREFIX_SIZE;
+	}
+
+	// keys of up to eight bytes, e.g., a BIGINT primary key, rarely need more than COMPACT_PREFIX_SIZE bytes
+	// in a prefix node, longer prefixes (e.g., the prefix of the first key in the ART) chain multiple prefix nodes
+	idx_t key_size = 0;
+	for (auto &type : types) {
+		if (type == PhysicalType::VARCHAR) {
+			return Node::PREFIX_SIZE;
+		}
+		key_size += GetTypeIdSize(type);
+	}
+	return key_size <= sizeof(int64_t) ? Node::COMPACT_PREFIX_SIZE : Node::PREFIX_SIZE;
+}
+
 ART::ART(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
          TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
          AttachedDatabase &db, const shared_ptr<array<unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>> &allocators_ptr,
@@ -42,18 +81,24 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
     : Index(name, ART::TYPE_NAME, index_constraint_type, column_ids, table_io_manager, unbound_expressions, db),
       allocators(allocators_ptr), owns_data(false) {
 
+	// database files of the oldest storage version that we can read keep the ART layout of the DuckDB versions
+	// that created them, i.e., no Node7, no Node15 and no compact prefix nodes
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	compact_nodes = block_manager.GetVersionNumber() > VERSION_NUMBER_LOWER;
+
 	// initialize all allocators
 	if (!allocators) {
 		owns_data = true;
-		auto &block_manager = table_io_manager.GetIndexBlockManager();
 
 		array<unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT> allocator_array = {
-		    make_uniq<FixedSizeAllocator>(sizeof(Prefix), block_manager),
+		    make_uniq<FixedSizeAllocator>(Prefix::GetSegmentSize(GetPrefixCount(compact_nodes, types)), block_manager),
 		    make_uniq<FixedSizeAllocator>(sizeof(Leaf), block_manager),
 		    make_uniq<FixedSizeAllocator>(sizeof(Node4), block_manager),
 		    make_uniq<FixedSizeAllocator>(sizeof(Node16), block_manager),
 		    make_uniq<FixedSizeAllocator>(sizeof(Node48), block_manager),
-		    make_uniq<FixedSizeAllocator>(sizeof(Node256), block_manager)};
+		    make_uniq<FixedSizeAllocator>(sizeof(Node256), block_manager),
+		    make_uniq<FixedSizeAllocator>(sizeof(Node7), block_manager),
+		    make_uniq<FixedSizeAllocator>(sizeof(Node15), block_manager)};
 		allocators = make_shared<array<unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>>(std::move(allocator_array));
 	}
 
@@ -69,6 +114,11 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 		}
 	}
 
+	// the prefix count follows from the segment size of the prefix allocator, which is either shared with another
+	// ART, or was deserialized from an (older) storage file
+	auto prefix_segment_size = (*allocators)[Node::GetAllocatorIdx(NType::PREFIX)]->GetSegmentSize();
+	prefix_count = UnsafeNumericCast<uint8_t>(prefix_segment_size - Prefix::GetSegmentSize(0));
+
 	// validate the types of the key columns
 	for (idx_t i = 0; i < types.size(); i++) {
 		switch (types[i]) {
@@ -97,115 +147,248 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Predicate Scans
 //===--------------------------------------------------------------------===//
 
-//! Initialize a single predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Transaction &transaction, const Value &value,
-                                                                const ExpressionType expression_type) {
-	// initialize point lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
+//! The maximum number of key ranges a scan generates for the IN lists on the key columns
+static constexpr idx_t MAX_SCAN_RANGES = STANDARD_VECTOR_SIZE;
+
+static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value);
+
+//! The constant predicates on a single key column
+struct ARTColumnPredicates {
+	//! The values of an equality or IN predicate
+	vector<Value> equal_values;
+	bool has_equality = false;
+	//! The lower bound of a range predicate
+	Value low_value;
+	bool low_inclusive = false;
+	//! The upper bound of a range predicate
+	Value high_value;
+	bool high_inclusive = false;
+
+	bool HasRange() const {
+		return !low_value.IsNull() || !high_value.IsNull();
+	}
+
+	void AddEquality(vector<Value> values) {
+		// keep the most selective set of values, the scan only needs to return a superset of the qualifying rows
+		if (!has_equality || values.size() < equal_values.size()) {
+			equal_values = std::move(values);
+			has_equality = true;
+		}
+	}
+
+	void AddLowerBound(const Value &value, const bool inclusive) {
+		if (low_value.IsNull() || value > low_value || (value == low_value && !inclusive)) {
+			low_value = value;
+			low_inclusive = inclusive;
+		}
+	}
+
+	void AddUpperBound(const Value &value, const bool inclusive) {
+		if (high_value.IsNull() || value < high_value || (value == high_value && !inclusive)) {
+			high_value = value;
+			high_inclusive = inclusive;
+		}
+	}
+};
+
+//! Returns the key column matching the expression, or DConstants::INVALID_INDEX
+static idx_t FindKeyColumn(const vector<unique_ptr<Expression>> &index_exprs, const Expression &expr) {
+	for (idx_t i = 0; i < index_exprs.size(); i++) {
+		if (index_exprs[i] && index_exprs[i]->Equals(expr)) {
+			return i;
+		}
+	}
+	return DConstants::INVALID_INDEX;
 }
 
-//! Initialize a two predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Transaction &transaction, const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	// initialize range lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
+//! Returns true, if the expression is a constant of the type of the key column
+static bool IsKeyConstant(const Expression &expr, const LogicalType &type) {
+	return expr.type == ExpressionType::VALUE_CONSTANT && expr.return_type == type;
 }
 
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-                                                  const Expression &filter_expr) {
-
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-	// try to find a matching index for any of the filter expressions
-
-	// create a matcher for a comparison with a constant
-	ComparisonExpressionMatcher matcher;
-	// match on a comparison type
-	matcher.expr_type = make_uniq<ComparisonExpressionTypeMatcher>();
-	// match on a constant comparison with the indexed expression
-	matcher.matchers.push_back(make_uniq<ExpressionEqualityMatcher>(index_expr));
-	matcher.matchers.push_back(make_uniq<ConstantExpressionMatcher>());
-
-	matcher.policy = SetMatcher::Policy::UNORDERED;
-
-	vector<reference<Expression>> bindings;
-	if (matcher.Match(const_cast<Expression &>(filter_expr), bindings)) { // NOLINT: Match does not alter the expr
-		// range or equality comparison with constant value
-		// we can use our index here
-		// bindings[0] = the expression
-		// bindings[1] = the index expression
-		// bindings[2] = the constant
-		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
-		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
+static void ExtractPredicates(const Expression &filter_expr, const vector<unique_ptr<Expression>> &index_exprs,
+                              const vector<LogicalType> &types, vector<ARTColumnPredicates> &predicates) {
+	switch (filter_expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		if (filter_expr.type != ExpressionType::CONJUNCTION_AND) {
+			return;
+		}
+		auto &conjunction = filter_expr.Cast<BoundConjunctionExpression>();
+		for (auto &child : conjunction.children) {
+			ExtractPredicates(*child, index_exprs, types, predicates);
+		}
+		return;
+	}
+	case ExpressionClass::BOUND_COMPARISON: {
+		// range or equality comparison of a key column with a constant value
+		auto &comparison = filter_expr.Cast<BoundComparisonExpression>();
 		auto comparison_type = comparison.type;
-		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
+		auto key_column = FindKeyColumn(index_exprs, *comparison.left);
+		reference<const Expression> constant = *comparison.right;
+		if (key_column == DConstants::INVALID_INDEX) {
 			// the expression is on the right side, we flip them around
+			key_column = FindKeyColumn(index_exprs, *comparison.right);
+			constant = *comparison.left;
 			comparison_type = FlipComparisonExpression(comparison_type);
 		}
-		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
-			// equality value
-			// equality overrides any other bounds so we just break here
-			equal_value = constant_value;
-		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
-		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
-			// greater than means this is a lower bound
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
-			// smaller than means this is an upper bound
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
+		if (key_column == DConstants::INVALID_INDEX || !IsKeyConstant(constant, types[key_column])) {
+			return;
 		}
-	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
-		// BETWEEN expression
+		auto &value = constant.get().Cast<BoundConstantExpression>().value;
+		if (value.IsNull()) {
+			return;
+		}
+		auto &column_predicates = predicates[key_column];
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			column_predicates.AddEquality(vector<Value> {value});
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			column_predicates.AddLowerBound(value, true);
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			column_predicates.AddLowerBound(value, false);
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			column_predicates.AddUpperBound(value, true);
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+			column_predicates.AddUpperBound(value, false);
+			break;
+		default:
+			break;
+		}
+		return;
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
 		auto &between = filter_expr.Cast<BoundBetweenExpression>();
-		if (!between.input->Equals(index_expr)) {
-			// expression doesn't match the index expression
-			return nullptr;
+		auto key_column = FindKeyColumn(index_exprs, *between.input);
+		if (key_column == DConstants::INVALID_INDEX) {
+			return;
 		}
-		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
-		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
-			// not a constant comparison
-			return nullptr;
+		auto &type = types[key_column];
+		if (!IsKeyConstant(*between.lower, type) || !IsKeyConstant(*between.upper, type)) {
+			return;
 		}
-		low_value = (between.lower->Cast<BoundConstantExpression>()).value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
-		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
-	}
-
-	if (!equal_value.IsNull() || !low_value.IsNull() || !high_value.IsNull()) {
-		// we can scan this index using this predicate: try a scan
-		unique_ptr<IndexScanState> index_state;
-		if (!equal_value.IsNull()) {
-			// equality predicate
-			index_state = InitializeScanSinglePredicate(transaction, equal_value, ExpressionType::COMPARE_EQUAL);
-		} else if (!low_value.IsNull() && !high_value.IsNull()) {
-			// two-sided predicate
-			index_state = InitializeScanTwoPredicates(transaction, low_value, low_comparison_type, high_value,
-			                                          high_comparison_type);
-		} else if (!low_value.IsNull()) {
-			// less than predicate
-			index_state = InitializeScanSinglePredicate(transaction, low_value, low_comparison_type);
-		} else {
-			D_ASSERT(!high_value.IsNull());
-			index_state = InitializeScanSinglePredicate(transaction, high_value, high_comparison_type);
+		auto &lower = between.lower->Cast<BoundConstantExpression>().value;
+		auto &upper = between.upper->Cast<BoundConstantExpression>().value;
+		if (lower.IsNull() || upper.IsNull()) {
+			return;
 		}
-		return index_state;
+		predicates[key_column].AddLowerBound(lower, between.lower_inclusive);
+		predicates[key_column].AddUpperBound(upper, between.upper_inclusive);
+		return;
 	}
-	return nullptr;
+	case ExpressionClass::BOUND_OPERATOR: {
+		if (filter_expr.type != ExpressionType::COMPARE_IN) {
+			return;
+		}
+		// IN list of constant values
+		auto &in_expr = filter_expr.Cast<BoundOperatorExpression>();
+		auto key_column = FindKeyColumn(index_exprs, *in_expr.children[0]);
+		if (key_column == DConstants::INVALID_INDEX) {
+			return;
+		}
+		vector<Value> values;
+		for (idx_t i = 1; i < in_expr.children.size(); i++) {
+			if (!IsKeyConstant(*in_expr.children[i], types[key_column])) {
+				return;
+			}
+			auto &value = in_expr.children[i]->Cast<BoundConstantExpression>().value;
+			if (!value.IsNull()) {
+				// NULL values never match
+				values.push_back(value);
+			}
+		}
+		predicates[key_column].AddEquality(std::move(values));
+		return;
+	}
+	default:
+		return;
+	}
+}
+
+static ARTKey AppendToKey(ArenaAllocator &allocator, const ARTKey &prefix, PhysicalType type, Value value) {
+	auto key = CreateKey(allocator, type, value);
+	if (prefix.Empty()) {
+		return key;
+	}
+	auto result = prefix;
+	result.ConcatenateARTKey(allocator, key);
+	return result;
+}
+
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction,
+                                                  const vector<unique_ptr<Expression>> &index_exprs,
+                                                  const vector<unique_ptr<Expression>> &filters,
+                                                  const bool keys_not_null) {
+	D_ASSERT(index_exprs.size() == types.size());
+
+	// collect the constant predicates on each key column
+	vector<ARTColumnPredicates> predicates(types.size());
+	for (auto &filter : filters) {
+		ExtractPredicates(*filter, index_exprs, logical_types, predicates);
+	}
+
+	// we can scan a prefix of key columns with equality predicates, optionally followed by a range predicate
+	idx_t equal_count = 0;
+	idx_t range_count = 1;
+	while (equal_count < types.size() && predicates[equal_count].has_equality) {
+		auto value_count = predicates[equal_count].equal_values.size();
+		if (range_count * value_count > MAX_SCAN_RANGES) {
+			break;
+		}
+		range_count *= value_count;
+		equal_count++;
+	}
+	auto has_range = equal_count < types.size() && predicates[equal_count].HasRange();
+	auto column_count = equal_count + (has_range ? 1 : 0);
+	if (column_count == 0) {
+		return nullptr;
+	}
+	if (column_count < types.size() && !keys_not_null) {
+		// rows with a NULL value in any key column are not in the index, but they could match the predicates
+		return nullptr;
+	}
+
+	// generate the key prefixes of all combinations of equality predicates
+	auto result = make_uniq<ARTIndexScanState>(Allocator::Get(db));
+	auto &allocator = result->arena_allocator;
+	vector<ARTKey> prefixes(1);
+	for (idx_t i = 0; i < equal_count; i++) {
+		vector<ARTKey> next_prefixes;
+		for (auto &prefix : prefixes) {
+			for (auto &value : predicates[i].equal_values) {
+				next_prefixes.push_back(AppendToKey(allocator, prefix, types[i], value));
+			}
+		}
+		prefixes = std::move(next_prefixes);
+	}
+
+	for (auto &prefix : prefixes) {
+		ARTScanRange range;
+		range.lower = prefix;
+		range.upper = prefix;
+		if (!has_range) {
+			range.point_lookup = equal_count == types.size();
+			result->ranges.push_back(range);
+			continue;
+		}
+
+		auto &column_predicates = predicates[equal_count];
+		if (!column_predicates.low_value.IsNull()) {
+			range.lower = AppendToKey(allocator, prefix, types[equal_count], column_predicates.low_value);
+			// an exclusive bound on a prefix of the key columns would have to skip all keys starting with the bound,
+			// we include them instead, as the filter is still applied to the result
+			range.lower_inclusive = column_predicates.low_inclusive || column_count < types.size();
+		}
+		if (!column_predicates.high_value.IsNull()) {
+			range.upper = AppendToKey(allocator, prefix, types[equal_count], column_predicates.high_value);
+			range.upper_inclusive = column_predicates.high_inclusive;
+		}
+		result->ranges.push_back(range);
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -431,7 +614,7 @@ bool Construct(ART &art, vector<ARTKey> &keys, row_t *row_ids, Node &node, KeySe
 	            UnsafeNumericCast<uint32_t>(prefix_length));
 
 	// set the node
-	auto node_type = Node::GetARTNodeTypeByCount(child_sections.size());
+	auto node_type = Node::GetARTNodeTypeByCount(art, child_sections.size());
 	Node::New(art, ref_node, node_type);
 
 	// recurse on each child section
@@ -514,6 +697,7 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 	}
 
 	if (failed_index != DConstants::INVALID_INDEX) {
+		UnpinBuffers();
 		return ErrorData(ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicate key \"%s\"",
 		                                     AppendRowError(input, failed_index)));
 	}
@@ -529,6 +713,7 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 	}
 #endif
 
+	UnpinBuffers();
 	return ErrorData();
 }
 
@@ -684,6 +869,8 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 		}
 	}
 #endif
+
+	UnpinBuffers();
 }
 
 void ART::Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id) {
@@ -840,141 +1027,213 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 }
 
 //===--------------------------------------------------------------------===//
-// Greater Than and Less Than
+// Range Scans
 //===--------------------------------------------------------------------===//
 
-bool ART::SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids) {
+bool ART::ScanRanges(ARTIndexScanState &state, const idx_t max_count, vector<row_t> &row_ids,
+                     optional_ptr<vector<string>> row_keys) {
 
+	lock_guard<mutex> l(lock);
 	if (!tree.HasMetadata()) {
 		return true;
 	}
-	Iterator &it = state.iterator;
 
-	// find the lowest value that satisfies the predicate
-	if (!it.art) {
+	auto success = true;
+	for (auto &range : state.ranges) {
+		if (range.point_lookup) {
+			auto row_id_count = row_ids.size();
+			if (!SearchEqual(range.lower, max_count, row_ids)) {
+				success = false;
+				break;
+			}
+			if (row_keys) {
+				for (idx_t i = row_id_count; i < row_ids.size(); i++) {
+					row_keys->emplace_back(const_char_ptr_cast(range.lower.data), range.lower.len);
+				}
+			}
+			continue;
+		}
+
+		// find the first key that satisfies the lower bound
+		Iterator it;
 		it.art = this;
-		if (!it.LowerBound(tree, key, equal, 0)) {
+		if (range.lower.Empty()) {
+			it.FindMinimum(tree);
+		} else if (!it.LowerBound(tree, range.lower, range.lower_inclusive, 0)) {
 			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+			continue;
+		}
+
+		// now continue the scan until we reach the upper bound
+		if (!it.Scan(range.upper, max_count, row_ids, range.upper_inclusive, row_keys)) {
+			success = false;
+			break;
 		}
 	}
 
-	// after that we continue the scan; we don't need to check the bounds as any value following this value is
-	// automatically bigger and hence satisfies our predicate
-	ARTKey empty_key = ARTKey();
-	return it.Scan(empty_key, max_count, result_ids, false);
+	UnpinBuffers();
+	return success;
 }
 
-bool ART::SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-                     vector<row_t> &result_ids) {
+bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
+               vector<row_t> &result_ids) {
 
-	if (!tree.HasMetadata()) {
+	auto &scan_state = state.Cast<ARTIndexScanState>();
+	vector<row_t> row_ids;
+	if (!ScanRanges(scan_state, max_count, row_ids, nullptr)) {
+		return false;
+	}
+	if (row_ids.empty()) {
 		return true;
 	}
-	Iterator &it = state.iterator;
 
-	if (!it.art) {
-		it.art = this;
-		// find the minimum value in the ART: we start scanning from this value
-		it.FindMinimum(tree);
-		// early-out, if the minimum value is higher than the upper bound
-		if (it.current_key > upper_bound) {
-			return true;
+	// sort the row ids
+	sort(row_ids.begin(), row_ids.end());
+	// duplicate eliminate the row ids and append them to the row ids of the state
+	result_ids.reserve(row_ids.size());
+
+	result_ids.push_back(row_ids[0]);
+	for (idx_t i = 1; i < row_ids.size(); i++) {
+		if (row_ids[i] != row_ids[i - 1]) {
+			result_ids.push_back(row_ids[i]);
 		}
 	}
-
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, equal);
+	return true;
 }
 
 //===--------------------------------------------------------------------===//
-// Closed Range Query
+// Key Reconstruction
 //===--------------------------------------------------------------------===//
 
-bool ART::SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-                           bool right_equal, idx_t max_count, vector<row_t> &result_ids) {
-
-	Iterator &it = state.iterator;
-
-	// find the first node that satisfies the left predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, lower_bound, left_equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+bool ART::CanReconstructKeys() const {
+	for (auto &type : types) {
+		switch (type) {
+		case PhysicalType::BOOL:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::UINT128:
+		case PhysicalType::VARCHAR:
+			break;
+		default:
+			// the keys of floating point values do not preserve -0.0 and the payloads of NaN values
+			return false;
 		}
 	}
-
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, right_equal);
+	return true;
 }
 
-bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
-               vector<row_t> &result_ids) {
-
-	auto &scan_state = state.Cast<ARTIndexScanState>();
-	vector<row_t> row_ids;
-	bool success;
-
-	// FIXME: the key directly owning the data for a single key might be more efficient
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
-	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
+template <class T>
+static idx_t TemplatedDecodeKey(const_data_ptr_t data, Vector &result, const idx_t row) {
+	FlatVector::GetData<T>(result)[row] = Radix::DecodeData<T>(data);
+	return sizeof(T);
+}
 
-	if (scan_state.values[1].IsNull()) {
+static idx_t DecodeStringKey(const_data_ptr_t data, const idx_t len, Vector &result, const idx_t row) {
+	// remove the escapes of ARTKey::CreateARTKey<string_t>, up to the null-terminator
+	string value;
+	idx_t pos = 0;
+	while (pos < len && data[pos] != '\0') {
+		if (data[pos] == '\01') {
+			pos++;
+		}
+		value += char(data[pos++]);
+	}
+	FlatVector::GetData<string_t>(result)[row] = StringVector::AddStringOrBlob(result, value);
+	return pos + 1;
+}
 
-		// single predicate
-		lock_guard<mutex> l(lock);
-		switch (scan_state.expressions[0]) {
-		case ExpressionType::COMPARE_EQUAL:
-			success = SearchEqual(key, max_count, row_ids);
+//! Reconstructs the values of the key columns from the key and writes them to the row of the key columns
+static void DecodeKey(const string &key, vector<Vector> &key_columns, const idx_t row) {
+	auto data = const_data_ptr_cast(key.c_str());
+	idx_t offset = 0;
+	for (auto &column : key_columns) {
+		switch (column.GetType().InternalType()) {
+		case PhysicalType::BOOL:
+			offset += TemplatedDecodeKey<bool>(data + offset, column, row);
 			break;
-		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			success = SearchGreater(scan_state, key, true, max_count, row_ids);
+		case PhysicalType::INT8:
+			offset += TemplatedDecodeKey<int8_t>(data + offset, column, row);
 			break;
-		case ExpressionType::COMPARE_GREATERTHAN:
-			success = SearchGreater(scan_state, key, false, max_count, row_ids);
+		case PhysicalType::INT16:
+			offset += TemplatedDecodeKey<int16_t>(data + offset, column, row);
 			break;
-		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			success = SearchLess(scan_state, key, true, max_count, row_ids);
+		case PhysicalType::INT32:
+			offset += TemplatedDecodeKey<int32_t>(data + offset, column, row);
 			break;
-		case ExpressionType::COMPARE_LESSTHAN:
-			success = SearchLess(scan_state, key, false, max_count, row_ids);
+		case PhysicalType::INT64:
+			offset += TemplatedDecodeKey<int64_t>(data + offset, column, row);
+			break;
+		case PhysicalType::INT128:
+			offset += TemplatedDecodeKey<hugeint_t>(data + offset, column, row);
+			break;
+		case PhysicalType::UINT8:
+			offset += TemplatedDecodeKey<uint8_t>(data + offset, column, row);
+			break;
+		case PhysicalType::UINT16:
+			offset += TemplatedDecodeKey<uint16_t>(data + offset, column, row);
+			break;
+		case PhysicalType::UINT32:
+			offset += TemplatedDecodeKey<uint32_t>(data + offset, column, row);
+			break;
+		case PhysicalType::UINT64:
+			offset += TemplatedDecodeKey<uint64_t>(data + offset, column, row);
+			break;
+		case PhysicalType::UINT128:
+			offset += TemplatedDecodeKey<uhugeint_t>(data + offset, column, row);
+			break;
+		case PhysicalType::VARCHAR:
+			offset += DecodeStringKey(data + offset, key.size() - offset, column, row);
 			break;
 		default:
-			throw InternalException("Index scan type not implemented");
+			throw InternalException("Cannot reconstruct the key column of an ART with type %s",
+			                        EnumUtil::ToString(column.GetType().InternalType()));
 		}
+	}
+	D_ASSERT(offset == key.size());
+}
 
-	} else {
-
-		// two predicates
-		lock_guard<mutex> l(lock);
-
-		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
-		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
+bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
+               vector<row_t> &result_ids, vector<Vector> &key_columns) {
 
-		bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
-		bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
-		success = SearchCloseRange(scan_state, key, upper_bound, left_equal, right_equal, max_count, row_ids);
+	D_ASSERT(CanReconstructKeys());
+	auto &scan_state = state.Cast<ARTIndexScanState>();
+	vector<row_t> row_ids;
+	vector<string> row_keys;
+	if (!ScanRanges(scan_state, max_count, row_ids, &row_keys)) {
+		return false;
 	}
+	D_ASSERT(row_ids.size() == row_keys.size());
 
-	if (!success) {
-		return false;
+	// sort the row ids together with their keys, and eliminate duplicates
+	vector<idx_t> order;
+	order.reserve(row_ids.size());
+	for (idx_t i = 0; i < row_ids.size(); i++) {
+		order.push_back(i);
 	}
-	if (row_ids.empty()) {
-		return true;
+	sort(order.begin(), order.end(), [&](const idx_t lhs, const idx_t rhs) { return row_ids[lhs] < row_ids[rhs]; });
+	vector<idx_t> unique_order;
+	unique_order.reserve(order.size());
+	for (idx_t i = 0; i < order.size(); i++) {
+		if (i == 0 || row_ids[order[i]] != row_ids[order[i - 1]]) {
+			unique_order.push_back(order[i]);
+		}
 	}
 
-	// sort the row ids
-	sort(row_ids.begin(), row_ids.end());
-	// duplicate eliminate the row ids and append them to the row ids of the state
-	result_ids.reserve(row_ids.size());
-
-	result_ids.push_back(row_ids[0]);
-	for (idx_t i = 1; i < row_ids.size(); i++) {
-		if (row_ids[i] != row_ids[i - 1]) {
-			result_ids.push_back(row_ids[i]);
-		}
+	key_columns.clear();
+	for (auto &type : logical_types) {
+		key_columns.emplace_back(type, MaxValue<idx_t>(unique_order.size(), STANDARD_VECTOR_SIZE));
+	}
+	result_ids.reserve(unique_order.size());
+	for (idx_t i = 0; i < unique_order.size(); i++) {
+		result_ids.push_back(row_ids[unique_order[i]]);
+		DecodeKey(row_keys[unique_order[i]], key_columns, i);
 	}
 	return true;
 }
@@ -1071,6 +1330,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	}
 
 	conflict_manager.FinishLookup();
+	UnpinBuffers();
 
 	if (found_conflict == DConstants::INVALID_INDEX) {
 		return;
@@ -1092,19 +1352,23 @@ IndexStorageInfo ART::GetStorageInfo(const bool get_buffers) {
 	info.name = name;
 	info.root = tree.Get();
 
+	// older versions of DuckDB expect exactly ALLOCATOR_COUNT_LOWER allocators, the Node7 and Node15 allocators of
+	// their ARTs are empty
+	auto allocator_count = compact_nodes ? ALLOCATOR_COUNT : ALLOCATOR_COUNT_LOWER;
+
 	if (!get_buffers) {
 		// store the data on disk as partial blocks and set the block ids
 		WritePartialBlocks();
 
 	} else {
 		// set the correct allocation sizes and get the map containing all buffers
-		for (const auto &allocator : *allocators) {
-			info.buffers.push_back(allocator->InitSerializationToWAL());
+		for (idx_t i = 0; i < allocator_count; i++) {
+			info.buffers.push_back((*allocators)[i]->InitSerializationToWAL());
 		}
 	}
 
-	for (const auto &allocator : *allocators) {
-		info.allocator_infos.push_back(allocator->GetInfo());
+	for (idx_t i = 0; i < allocator_count; i++) {
+		info.allocator_infos.push_back((*allocators)[i]->GetInfo());
 	}
 
 	return info;
@@ -1127,8 +1391,8 @@ void ART::InitAllocators(const IndexStorageInfo &info) {
 	// set the root node
 	tree.Set(info.root);
 
-	// initialize the allocators
-	D_ASSERT(info.allocator_infos.size() == ALLOCATOR_COUNT);
+	// initialize the allocators, ARTs of the oldest storage version have no Node7 and Node15 allocators
+	D_ASSERT(info.allocator_infos.size() == (compact_nodes ? ALLOCATOR_COUNT : ALLOCATOR_COUNT_LOWER));
 	for (idx_t i = 0; i < info.allocator_infos.size(); i++) {
 		(*allocators)[i]->Init(info.allocator_infos[i]);
 	}
@@ -1141,7 +1405,7 @@ void ART::Deserialize(const BlockPointer &pointer) {
 	MetadataReader reader(metadata_manager, pointer);
 	tree = reader.Read<Node>();
 
-	for (idx_t i = 0; i < ALLOCATOR_COUNT; i++) {
+	for (idx_t i = 0; i < ALLOCATOR_COUNT_LOWER; i++) {
 		(*allocators)[i]->Deserialize(metadata_manager, reader.Read<BlockPointer>());
 	}
 }
@@ -1199,6 +1463,13 @@ void ART::Vacuum(IndexLock &state) {
 
 	// finalize the vacuum operation
 	FinalizeVacuum(flags);
+	UnpinBuffers();
+}
+
+void ART::UnpinBuffers() {
+	for (auto &allocator : *allocators) {
+		allocator->UnpinBuffers();
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -1216,6 +1487,29 @@ idx_t ART::GetInMemorySize(IndexLock &index_lock) {
 	return in_memory_size;
 }
 
+vector<pair<NType, idx_t>> ART::GetNodeMemoryUsage() {
+
+	IndexLock state;
+	InitializeLock(state);
+
+	// the node types that this ART uses, ordered by their size
+	vector<NType> types = {NType::PREFIX, NType::LEAF, NType::NODE_4};
+	if (compact_nodes) {
+		types.push_back(NType::NODE_7);
+		types.push_back(NType::NODE_15);
+	} else {
+		types.push_back(NType::NODE_16);
+	}
+	types.push_back(NType::NODE_48);
+	types.push_back(NType::NODE_256);
+
+	vector<pair<NType, idx_t>> result;
+	for (auto type : types) {
+		result.emplace_back(type, Node::GetAllocator(*this, type).GetInMemorySize());
+	}
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // Merging
 //===--------------------------------------------------------------------===//
@@ -1258,6 +1552,28 @@ bool ART::MergeIndexes(IndexLock &state, Index &other_index) {
 	return true;
 }
 
+void ART::IncrementBufferIds(const ARTFlags &flags) {
+
+	D_ASSERT(owns_data);
+	if (tree.HasMetadata()) {
+		tree.InitializeMerge(*this, flags);
+	}
+}
+
+bool ART::MergeIncrementedIndex(ART &other) {
+
+	D_ASSERT(owns_data && other.owns_data);
+	if (!other.tree.HasMetadata()) {
+		return true;
+	}
+
+	// merge the node storage, the buffer IDs of the other ART already start after our buffer IDs
+	for (idx_t i = 0; i < allocators->size(); i++) {
+		(*allocators)[i]->Merge(*(*other.allocators)[i]);
+	}
+	return tree.Merge(*this, other.tree);
+}
+
 //===--------------------------------------------------------------------===//
 // Utility
 //===--------------------------------------------------------------------===//
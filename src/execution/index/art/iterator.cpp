@@ -41,14 +41,26 @@ bool IteratorKey::operator==(const ARTKey &key) const {
 	return true;
 }
 
-bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids, const bool equal) {
+bool IteratorKey::PrefixGreaterThan(const ARTKey &key) const {
+	for (idx_t i = 0; i < MinValue<idx_t>(key_bytes.size(), key.len); i++) {
+		if (key_bytes[i] > key.data[i]) {
+			return true;
+		} else if (key_bytes[i] < key.data[i]) {
+			return false;
+		}
+	}
+	return false;
+}
+
+bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids, const bool equal,
+                    optional_ptr<vector<string>> result_keys) {
 
 	bool has_next;
 	do {
 		if (!upper_bound.Empty()) {
 			// no more row IDs within the key bounds
 			if (equal) {
-				if (current_key > upper_bound) {
+				if (current_key.PrefixGreaterThan(upper_bound)) {
 					return true;
 				}
 			} else {
@@ -59,9 +71,15 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row
 		}
 
 		// copy all row IDs of this leaf into the result IDs (if they don't exceed max_count)
+		auto row_id_count = result_ids.size();
 		if (!Leaf::GetRowIds(*art, last_leaf, result_ids, max_count)) {
 			return false;
 		}
+		if (result_keys) {
+			for (idx_t i = row_id_count; i < result_ids.size(); i++) {
+				result_keys->push_back(current_key.GetBytes());
+			}
+		}
 
 		// get the next leaf
 		has_next = Next();
@@ -84,11 +102,11 @@ void Iterator::FindMinimum(const Node &node) {
 	// traverse the prefix
 	if (node.GetType() == NType::PREFIX) {
 		auto &prefix = Node::Ref<const Prefix>(*art, node, NType::PREFIX);
-		for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		for (idx_t i = 0; i < prefix.Count(*art); i++) {
 			current_key.Push(prefix.data[i]);
 		}
 		nodes.emplace(node, 0);
-		return FindMinimum(prefix.ptr);
+		return FindMinimum(prefix.Ptr(*art));
 	}
 
 	// go to the leftmost entry in the current node and recurse
@@ -115,6 +133,13 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return true;
 	}
 
+	// the key is a prefix of all keys in this subtree
+	if (depth >= key.len) {
+		D_ASSERT(equal);
+		FindMinimum(node);
+		return true;
+	}
+
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
 		auto child = node.GetNextChild(*art, next_byte);
@@ -139,12 +164,18 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 
 	// resolve the prefix
 	auto &prefix = Node::Ref<const Prefix>(*art, node, NType::PREFIX);
-	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+	for (idx_t i = 0; i < prefix.Count(*art); i++) {
 		current_key.Push(prefix.data[i]);
 	}
 	nodes.emplace(node, 0);
 
-	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+	for (idx_t i = 0; i < prefix.Count(*art); i++) {
+		// the key is a prefix of all keys in this subtree
+		if (depth + i >= key.len) {
+			D_ASSERT(equal);
+			FindMinimum(prefix.Ptr(*art));
+			return true;
+		}
 		// the key down to this node is less than the lower bound, the next key will be
 		// greater than the lower bound
 		if (prefix.data[i] < key[depth + i]) {
@@ -153,14 +184,14 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		// we only need to find the minimum from here
 		// because all keys will be greater than the lower bound
 		if (prefix.data[i] > key[depth + i]) {
-			FindMinimum(prefix.ptr);
+			FindMinimum(prefix.Ptr(*art));
 			return true;
 		}
 	}
 
 	// recurse into the child
-	depth += prefix.data[Node::PREFIX_SIZE];
-	return LowerBound(prefix.ptr, key, equal, depth);
+	depth += prefix.Count(*art);
+	return LowerBound(prefix.Ptr(*art), key, equal, depth);
 }
 
 bool Iterator::Next() {
@@ -200,7 +231,7 @@ bool Iterator::Next() {
 void Iterator::PopNode() {
 	if (nodes.top().node.GetType() == NType::PREFIX) {
 		auto &prefix = Node::Ref<const Prefix>(*art, nodes.top().node, NType::PREFIX);
-		auto prefix_byte_count = prefix.data[Node::PREFIX_SIZE];
+		auto prefix_byte_count = prefix.Count(*art);
 		current_key.Pop(prefix_byte_count);
 	} else {
 		current_key.Pop(1);
@@ -64,7 +64,7 @@ void Leaf::Free(ART &art, Node &node) {
 
 void Leaf::InitializeMerge(ART &art, Node &node, const ARTFlags &flags) {
 
-	auto merge_buffer_count = flags.merge_buffer_counts[static_cast<uint8_t>(NType::LEAF) - 1];
+	auto merge_buffer_count = flags.merge_buffer_counts[Node::GetAllocatorIdx(NType::LEAF)];
 
 	Node next_node = node;
 	node.IncreaseBufferId(merge_buffer_count);
@@ -309,14 +309,24 @@ void Leaf::Vacuum(ART &art, Node &node) {
 
 	auto &allocator = Node::GetAllocator(art, NType::LEAF);
 
-	reference<Node> node_ref(node);
-	while (node_ref.get().HasMetadata()) {
-		if (allocator.NeedsVacuum(node_ref)) {
-			node_ref.get() = allocator.VacuumPointer(node_ref);
-			node_ref.get().SetMetadata(static_cast<uint8_t>(NType::LEAF));
+	if (allocator.NeedsVacuum(node)) {
+		node = allocator.VacuumPointer(node);
+		node.SetMetadata(static_cast<uint8_t>(NType::LEAF));
+	}
+
+	// we only write the pointer of a leaf back, if the vacuum moved the next leaf
+	Node current_node = node;
+	while (true) {
+		auto next_node = Node::Ref<const Leaf>(art, current_node, NType::LEAF).ptr;
+		if (!next_node.HasMetadata()) {
+			return;
 		}
-		auto &leaf = Node::RefMutable<Leaf>(art, node_ref, NType::LEAF);
-		node_ref = leaf.ptr;
+		if (allocator.NeedsVacuum(next_node)) {
+			next_node = allocator.VacuumPointer(next_node);
+			next_node.SetMetadata(static_cast<uint8_t>(NType::LEAF));
+			Node::RefMutable<Leaf>(art, current_node, NType::LEAF).ptr = next_node;
+		}
+		current_node = next_node;
 	}
 }
 
@@ -6,6 +6,8 @@
 #include "duckdb/execution/index/art/node256.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
+#include "duckdb/execution/index/art/node15.hpp"
+#include "duckdb/execution/index/art/node7.hpp"
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/leaf.hpp"
 #include "duckdb/execution/index/art/prefix.hpp"
@@ -25,6 +27,12 @@ void Node::New(ART &art, Node &node, const NType type) {
 	case NType::NODE_4:
 		Node4::New(art, node);
 		break;
+	case NType::NODE_7:
+		Node7::New(art, node);
+		break;
+	case NType::NODE_15:
+		Node15::New(art, node);
+		break;
 	case NType::NODE_16:
 		Node16::New(art, node);
 		break;
@@ -57,6 +65,12 @@ void Node::Free(ART &art, Node &node) {
 	case NType::NODE_4:
 		Node4::Free(art, node);
 		break;
+	case NType::NODE_7:
+		Node7::Free(art, node);
+		break;
+	case NType::NODE_15:
+		Node15::Free(art, node);
+		break;
 	case NType::NODE_16:
 		Node16::Free(art, node);
 		break;
@@ -79,7 +93,7 @@ void Node::Free(ART &art, Node &node) {
 //===--------------------------------------------------------------------===//
 
 FixedSizeAllocator &Node::GetAllocator(const ART &art, const NType type) {
-	return *(*art.allocators)[static_cast<uint8_t>(type) - 1];
+	return *(*art.allocators)[GetAllocatorIdx(type)];
 }
 
 //===--------------------------------------------------------------------===//
@@ -91,6 +105,10 @@ void Node::ReplaceChild(const ART &art, const uint8_t byte, const Node child) co
 	switch (GetType()) {
 	case NType::NODE_4:
 		return RefMutable<Node4>(art, *this, NType::NODE_4).ReplaceChild(byte, child);
+	case NType::NODE_7:
+		return RefMutable<Node7>(art, *this, NType::NODE_7).ReplaceChild(byte, child);
+	case NType::NODE_15:
+		return RefMutable<Node15>(art, *this, NType::NODE_15).ReplaceChild(byte, child);
 	case NType::NODE_16:
 		return RefMutable<Node16>(art, *this, NType::NODE_16).ReplaceChild(byte, child);
 	case NType::NODE_48:
@@ -107,6 +125,10 @@ void Node::InsertChild(ART &art, Node &node, const uint8_t byte, const Node chil
 	switch (node.GetType()) {
 	case NType::NODE_4:
 		return Node4::InsertChild(art, node, byte, child);
+	case NType::NODE_7:
+		return Node7::InsertChild(art, node, byte, child);
+	case NType::NODE_15:
+		return Node15::InsertChild(art, node, byte, child);
 	case NType::NODE_16:
 		return Node16::InsertChild(art, node, byte, child);
 	case NType::NODE_48:
@@ -127,6 +149,10 @@ void Node::DeleteChild(ART &art, Node &node, Node &prefix, const uint8_t byte) {
 	switch (node.GetType()) {
 	case NType::NODE_4:
 		return Node4::DeleteChild(art, node, prefix, byte);
+	case NType::NODE_7:
+		return Node7::DeleteChild(art, node, byte);
+	case NType::NODE_15:
+		return Node15::DeleteChild(art, node, byte);
 	case NType::NODE_16:
 		return Node16::DeleteChild(art, node, byte);
 	case NType::NODE_48:
@@ -149,6 +175,10 @@ optional_ptr<const Node> Node::GetChild(ART &art, const uint8_t byte) const {
 	switch (GetType()) {
 	case NType::NODE_4:
 		return Ref<const Node4>(art, *this, NType::NODE_4).GetChild(byte);
+	case NType::NODE_7:
+		return Ref<const Node7>(art, *this, NType::NODE_7).GetChild(byte);
+	case NType::NODE_15:
+		return Ref<const Node15>(art, *this, NType::NODE_15).GetChild(byte);
 	case NType::NODE_16:
 		return Ref<const Node16>(art, *this, NType::NODE_16).GetChild(byte);
 	case NType::NODE_48:
@@ -167,6 +197,10 @@ optional_ptr<Node> Node::GetChildMutable(ART &art, const uint8_t byte) const {
 	switch (GetType()) {
 	case NType::NODE_4:
 		return RefMutable<Node4>(art, *this, NType::NODE_4).GetChildMutable(byte);
+	case NType::NODE_7:
+		return RefMutable<Node7>(art, *this, NType::NODE_7).GetChildMutable(byte);
+	case NType::NODE_15:
+		return RefMutable<Node15>(art, *this, NType::NODE_15).GetChildMutable(byte);
 	case NType::NODE_16:
 		return RefMutable<Node16>(art, *this, NType::NODE_16).GetChildMutable(byte);
 	case NType::NODE_48:
@@ -185,6 +219,10 @@ optional_ptr<const Node> Node::GetNextChild(ART &art, uint8_t &byte) const {
 	switch (GetType()) {
 	case NType::NODE_4:
 		return Ref<const Node4>(art, *this, NType::NODE_4).GetNextChild(byte);
+	case NType::NODE_7:
+		return Ref<const Node7>(art, *this, NType::NODE_7).GetNextChild(byte);
+	case NType::NODE_15:
+		return Ref<const Node15>(art, *this, NType::NODE_15).GetNextChild(byte);
 	case NType::NODE_16:
 		return Ref<const Node16>(art, *this, NType::NODE_16).GetNextChild(byte);
 	case NType::NODE_48:
@@ -203,6 +241,10 @@ optional_ptr<Node> Node::GetNextChildMutable(ART &art, uint8_t &byte) const {
 	switch (GetType()) {
 	case NType::NODE_4:
 		return RefMutable<Node4>(art, *this, NType::NODE_4).GetNextChildMutable(byte);
+	case NType::NODE_7:
+		return RefMutable<Node7>(art, *this, NType::NODE_7).GetNextChildMutable(byte);
+	case NType::NODE_15:
+		return RefMutable<Node15>(art, *this, NType::NODE_15).GetNextChildMutable(byte);
 	case NType::NODE_16:
 		return RefMutable<Node16>(art, *this, NType::NODE_16).GetNextChildMutable(byte);
 	case NType::NODE_48:
@@ -253,6 +295,10 @@ idx_t Node::GetCapacity() const {
 	switch (GetType()) {
 	case NType::NODE_4:
 		return NODE_4_CAPACITY;
+	case NType::NODE_7:
+		return NODE_7_CAPACITY;
+	case NType::NODE_15:
+		return NODE_15_CAPACITY;
 	case NType::NODE_16:
 		return NODE_16_CAPACITY;
 	case NType::NODE_48:
@@ -264,11 +310,15 @@ idx_t Node::GetCapacity() const {
 	}
 }
 
-NType Node::GetARTNodeTypeByCount(const idx_t count) {
+NType Node::GetARTNodeTypeByCount(const ART &art, const idx_t count) {
 
 	if (count <= NODE_4_CAPACITY) {
 		return NType::NODE_4;
-	} else if (count <= NODE_16_CAPACITY) {
+	} else if (art.compact_nodes && count <= NODE_7_CAPACITY) {
+		return NType::NODE_7;
+	} else if (art.compact_nodes && count <= NODE_15_CAPACITY) {
+		return NType::NODE_15;
+	} else if (!art.compact_nodes && count <= NODE_16_CAPACITY) {
 		return NType::NODE_16;
 	} else if (count <= NODE_48_CAPACITY) {
 		return NType::NODE_48;
@@ -294,6 +344,12 @@ void Node::InitializeMerge(ART &art, const ARTFlags &flags) {
 	case NType::NODE_4:
 		RefMutable<Node4>(art, *this, NType::NODE_4).InitializeMerge(art, flags);
 		break;
+	case NType::NODE_7:
+		RefMutable<Node7>(art, *this, NType::NODE_7).InitializeMerge(art, flags);
+		break;
+	case NType::NODE_15:
+		RefMutable<Node15>(art, *this, NType::NODE_15).InitializeMerge(art, flags);
+		break;
 	case NType::NODE_16:
 		RefMutable<Node16>(art, *this, NType::NODE_16).InitializeMerge(art, flags);
 		break;
@@ -307,7 +363,7 @@ void Node::InitializeMerge(ART &art, const ARTFlags &flags) {
 		return;
 	}
 
-	IncreaseBufferId(flags.merge_buffer_counts[static_cast<uint8_t>(GetType()) - 1]);
+	IncreaseBufferId(flags.merge_buffer_counts[GetAllocatorIdx(GetType())]);
 }
 
 bool Node::Merge(ART &art, Node &other) {
@@ -420,7 +476,8 @@ bool Node::MergeInternal(ART &art, Node &other) {
 	// always try to merge the smaller node into the bigger node
 	// because maybe there is enough free space in the bigger node to fit the smaller one
 	// without too much recursion
-	if (GetType() < other.GetType()) {
+	auto is_leaf = GetType() == NType::LEAF || GetType() == NType::LEAF_INLINED;
+	if (is_leaf ? GetType() < other.GetType() : GetCapacity() < other.GetCapacity()) {
 		swap(*this, other);
 	}
 
@@ -477,7 +534,6 @@ void Node::Vacuum(ART &art, const ARTFlags &flags) {
 	D_ASSERT(HasMetadata());
 
 	auto node_type = GetType();
-	auto node_type_idx = static_cast<uint8_t>(node_type);
 
 	// iterative functions
 	if (node_type == NType::PREFIX) {
@@ -486,32 +542,37 @@ void Node::Vacuum(ART &art, const ARTFlags &flags) {
 	if (node_type == NType::LEAF_INLINED) {
 		return;
 	}
+	auto allocator_idx = GetAllocatorIdx(node_type);
 	if (node_type == NType::LEAF) {
-		if (flags.vacuum_flags[node_type_idx - 1]) {
+		if (flags.vacuum_flags[allocator_idx]) {
 			Leaf::Vacuum(art, *this);
 		}
 		return;
 	}
 
 	auto &allocator = GetAllocator(art, node_type);
-	auto needs_vacuum = flags.vacuum_flags[node_type_idx - 1] && allocator.NeedsVacuum(*this);
+	auto needs_vacuum = flags.vacuum_flags[allocator_idx] && allocator.NeedsVacuum(*this);
 	if (needs_vacuum) {
 		*this = allocator.VacuumPointer(*this);
-		SetMetadata(node_type_idx);
+		SetMetadata(static_cast<uint8_t>(node_type));
 	}
 
-	// recursive functions
-	switch (node_type) {
-	case NType::NODE_4:
-		return RefMutable<Node4>(art, *this, NType::NODE_4).Vacuum(art, flags);
-	case NType::NODE_16:
-		return RefMutable<Node16>(art, *this, NType::NODE_16).Vacuum(art, flags);
-	case NType::NODE_48:
-		return RefMutable<Node48>(art, *this, NType::NODE_48).Vacuum(art, flags);
-	case NType::NODE_256:
-		return RefMutable<Node256>(art, *this, NType::NODE_256).Vacuum(art, flags);
-	default:
-		throw InternalException("Invalid node type for Vacuum.");
+	// recursively vacuum the children, we only write a child pointer back, if the vacuum moved the child,
+	// so that we do not modify (and later rewrite) unchanged on-disk buffers
+	uint8_t byte = 0;
+	auto child = GetNextChild(art, byte);
+	while (child) {
+		auto old_child = *child;
+		auto new_child = old_child;
+		new_child.Vacuum(art, flags);
+		if (!(new_child == old_child)) {
+			ReplaceChild(art, byte, new_child);
+		}
+		if (byte == NumericLimits<uint8_t>::Maximum()) {
+			return;
+		}
+		byte++;
+		child = GetNextChild(art, byte);
 	}
 }
 
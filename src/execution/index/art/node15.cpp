@@ -0,0 +1,189 @@
+#include "duckdb/execution/index/art/node15.hpp"
+#include "duckdb/execution/index/art/node7.hpp"
+#include "duckdb/execution/index/art/node48.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+
+namespace duckdb {
+
+Node15 &Node15::New(ART &art, Node &node) {
+
+	node = Node::GetAllocator(art, NType::NODE_15).New();
+	node.SetMetadata(static_cast<uint8_t>(NType::NODE_15));
+	auto &n15 = Node::RefMutable<Node15>(art, node, NType::NODE_15);
+
+	n15.count = 0;
+	return n15;
+}
+
+void Node15::Free(ART &art, Node &node) {
+
+	D_ASSERT(node.HasMetadata());
+	auto &n15 = Node::RefMutable<Node15>(art, node, NType::NODE_15);
+
+	// free all children
+	for (idx_t i = 0; i < n15.count; i++) {
+		Node::Free(art, n15.children[i]);
+	}
+}
+
+Node15 &Node15::GrowNode7(ART &art, Node &node15, Node &node7) {
+
+	auto &n7 = Node::RefMutable<Node7>(art, node7, NType::NODE_7);
+	auto &n15 = New(art, node15);
+
+	n15.count = n7.count;
+	for (idx_t i = 0; i < n7.count; i++) {
+		n15.key[i] = n7.key[i];
+		n15.children[i] = n7.children[i];
+	}
+
+	n7.count = 0;
+	Node::Free(art, node7);
+	return n15;
+}
+
+Node15 &Node15::ShrinkNode48(ART &art, Node &node15, Node &node48) {
+
+	auto &n15 = New(art, node15);
+	auto &n48 = Node::RefMutable<Node48>(art, node48, NType::NODE_48);
+
+	n15.count = 0;
+	for (idx_t i = 0; i < Node::NODE_256_CAPACITY; i++) {
+		D_ASSERT(n15.count <= Node::NODE_15_CAPACITY);
+		if (n48.child_index[i] != Node::EMPTY_MARKER) {
+			n15.key[n15.count] = UnsafeNumericCast<uint8_t>(i);
+			n15.children[n15.count] = n48.children[n48.child_index[i]];
+			n15.count++;
+		}
+	}
+
+	n48.count = 0;
+	Node::Free(art, node48);
+	return n15;
+}
+
+void Node15::InitializeMerge(ART &art, const ARTFlags &flags) {
+
+	for (idx_t i = 0; i < count; i++) {
+		children[i].InitializeMerge(art, flags);
+	}
+}
+
+void Node15::InsertChild(ART &art, Node &node, const uint8_t byte, const Node child) {
+
+	D_ASSERT(node.HasMetadata());
+	auto &n15 = Node::RefMutable<Node15>(art, node, NType::NODE_15);
+
+	// ensure that there is no other child at the same byte
+	for (idx_t i = 0; i < n15.count; i++) {
+		D_ASSERT(n15.key[i] != byte);
+	}
+
+	// insert new child node into node
+	if (n15.count < Node::NODE_15_CAPACITY) {
+		// still space, just insert the child
+		idx_t child_pos = 0;
+		while (child_pos < n15.count && n15.key[child_pos] < byte) {
+			child_pos++;
+		}
+		// move children backwards to make space
+		for (idx_t i = n15.count; i > child_pos; i--) {
+			n15.key[i] = n15.key[i - 1];
+			n15.children[i] = n15.children[i - 1];
+		}
+
+		n15.key[child_pos] = byte;
+		n15.children[child_pos] = child;
+		n15.count++;
+
+	} else {
+		// node is full, grow to Node48
+		auto node15 = node;
+		Node48::GrowNode15(art, node, node15);
+		Node48::InsertChild(art, node, byte, child);
+	}
+}
+
+void Node15::DeleteChild(ART &art, Node &node, const uint8_t byte) {
+
+	D_ASSERT(node.HasMetadata());
+	auto &n15 = Node::RefMutable<Node15>(art, node, NType::NODE_15);
+
+	idx_t child_pos = 0;
+	for (; child_pos < n15.count; child_pos++) {
+		if (n15.key[child_pos] == byte) {
+			break;
+		}
+	}
+
+	D_ASSERT(child_pos < n15.count);
+
+	// free the child and decrease the count
+	Node::Free(art, n15.children[child_pos]);
+	n15.count--;
+
+	// potentially move any children backwards
+	for (idx_t i = child_pos; i < n15.count; i++) {
+		n15.key[i] = n15.key[i + 1];
+		n15.children[i] = n15.children[i + 1];
+	}
+
+	// shrink node to Node7
+	if (n15.count < Node::NODE_7_CAPACITY) {
+		auto node15 = node;
+		Node7::ShrinkNode15(art, node, node15);
+	}
+}
+
+void Node15::ReplaceChild(const uint8_t byte, const Node child) {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] == byte) {
+			children[i] = child;
+			return;
+		}
+	}
+}
+
+optional_ptr<const Node> Node15::GetChild(const uint8_t byte) const {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] == byte) {
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+optional_ptr<Node> Node15::GetChildMutable(const uint8_t byte) {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] == byte) {
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+optional_ptr<const Node> Node15::GetNextChild(uint8_t &byte) const {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] >= byte) {
+			byte = key[i];
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+optional_ptr<Node> Node15::GetNextChildMutable(uint8_t &byte) {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] >= byte) {
+			byte = key[i];
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+} // namespace duckdb
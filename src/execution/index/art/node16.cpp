@@ -186,11 +186,4 @@ optional_ptr<Node> Node16::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
-void Node16::Vacuum(ART &art, const ARTFlags &flags) {
-
-	for (idx_t i = 0; i < count; i++) {
-		children[i].Vacuum(art, flags);
-	}
-}
-
 } // namespace duckdb
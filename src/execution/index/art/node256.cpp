@@ -126,13 +126,4 @@ optional_ptr<Node> Node256::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
-void Node256::Vacuum(ART &art, const ARTFlags &flags) {
-
-	for (idx_t i = 0; i < Node::NODE_256_CAPACITY; i++) {
-		if (children[i].HasMetadata()) {
-			children[i].Vacuum(art, flags);
-		}
-	}
-}
-
 } // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/execution/index/art/node4.hpp"
 
 #include "duckdb/execution/index/art/prefix.hpp"
+#include "duckdb/execution/index/art/node7.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
 
 namespace duckdb {
@@ -43,6 +44,23 @@ Node4 &Node4::ShrinkNode16(ART &art, Node &node4, Node &node16) {
 	return n4;
 }
 
+Node4 &Node4::ShrinkNode7(ART &art, Node &node4, Node &node7) {
+
+	auto &n4 = New(art, node4);
+	auto &n7 = Node::RefMutable<Node7>(art, node7, NType::NODE_7);
+
+	D_ASSERT(n7.count <= Node::NODE_4_CAPACITY);
+	n4.count = n7.count;
+	for (idx_t i = 0; i < n7.count; i++) {
+		n4.key[i] = n7.key[i];
+		n4.children[i] = n7.children[i];
+	}
+
+	n7.count = 0;
+	Node::Free(art, node7);
+	return n4;
+}
+
 void Node4::InitializeMerge(ART &art, const ARTFlags &flags) {
 
 	for (idx_t i = 0; i < count; i++) {
@@ -77,6 +95,12 @@ void Node4::InsertChild(ART &art, Node &node, const uint8_t byte, const Node chi
 		n4.children[child_pos] = child;
 		n4.count++;
 
+	} else if (art.compact_nodes) {
+		// node is full, grow to Node7
+		auto node4 = node;
+		Node7::GrowNode4(art, node, node4);
+		Node7::InsertChild(art, node, byte, child);
+
 	} else {
 		// node is full, grow to Node16
 		auto node4 = node;
@@ -179,11 +203,4 @@ optional_ptr<Node> Node4::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
-void Node4::Vacuum(ART &art, const ARTFlags &flags) {
-
-	for (idx_t i = 0; i < count; i++) {
-		children[i].Vacuum(art, flags);
-	}
-}
-
 } // namespace duckdb
@@ -1,4 +1,5 @@
 #include "duckdb/execution/index/art/node48.hpp"
+#include "duckdb/execution/index/art/node15.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
 #include "duckdb/common/numeric_utils.hpp"
@@ -64,6 +65,22 @@ Node48 &Node48::GrowNode16(ART &art, Node &node48, Node &node16) {
 	return n48;
 }
 
+Node48 &Node48::GrowNode15(ART &art, Node &node48, Node &node15) {
+
+	auto &n15 = Node::RefMutable<Node15>(art, node15, NType::NODE_15);
+	auto &n48 = New(art, node48);
+
+	n48.count = n15.count;
+	for (idx_t i = 0; i < n15.count; i++) {
+		n48.child_index[n15.key[i]] = UnsafeNumericCast<uint8_t>(i);
+		n48.children[i] = n15.children[i];
+	}
+
+	n15.count = 0;
+	Node::Free(art, node15);
+	return n48;
+}
+
 Node48 &Node48::ShrinkNode256(ART &art, Node &node48, Node &node256) {
 
 	auto &n48 = New(art, node48);
@@ -141,10 +158,14 @@ void Node48::DeleteChild(ART &art, Node &node, const uint8_t byte) {
 	n48.child_index[byte] = Node::EMPTY_MARKER;
 	n48.count--;
 
-	// shrink node to Node16
+	// shrink node to Node15 or Node16
 	if (n48.count < Node::NODE_48_SHRINK_THRESHOLD) {
 		auto node48 = node;
-		Node16::ShrinkNode48(art, node, node48);
+		if (art.compact_nodes) {
+			Node15::ShrinkNode48(art, node, node48);
+		} else {
+			Node16::ShrinkNode48(art, node, node48);
+		}
 	}
 }
 
@@ -186,13 +207,4 @@ optional_ptr<Node> Node48::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
-void Node48::Vacuum(ART &art, const ARTFlags &flags) {
-
-	for (idx_t i = 0; i < Node::NODE_256_CAPACITY; i++) {
-		if (child_index[i] != Node::EMPTY_MARKER) {
-			children[child_index[i]].Vacuum(art, flags);
-		}
-	}
-}
-
 } // namespace duckdb
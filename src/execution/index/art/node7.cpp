@@ -0,0 +1,185 @@
+#include "duckdb/execution/index/art/node7.hpp"
+#include "duckdb/execution/index/art/node4.hpp"
+#include "duckdb/execution/index/art/node15.hpp"
+
+namespace duckdb {
+
+Node7 &Node7::New(ART &art, Node &node) {
+
+	node = Node::GetAllocator(art, NType::NODE_7).New();
+	node.SetMetadata(static_cast<uint8_t>(NType::NODE_7));
+	auto &n7 = Node::RefMutable<Node7>(art, node, NType::NODE_7);
+
+	n7.count = 0;
+	return n7;
+}
+
+void Node7::Free(ART &art, Node &node) {
+
+	D_ASSERT(node.HasMetadata());
+	auto &n7 = Node::RefMutable<Node7>(art, node, NType::NODE_7);
+
+	// free all children
+	for (idx_t i = 0; i < n7.count; i++) {
+		Node::Free(art, n7.children[i]);
+	}
+}
+
+Node7 &Node7::GrowNode4(ART &art, Node &node7, Node &node4) {
+
+	auto &n4 = Node::RefMutable<Node4>(art, node4, NType::NODE_4);
+	auto &n7 = New(art, node7);
+
+	n7.count = n4.count;
+	for (idx_t i = 0; i < n4.count; i++) {
+		n7.key[i] = n4.key[i];
+		n7.children[i] = n4.children[i];
+	}
+
+	n4.count = 0;
+	Node::Free(art, node4);
+	return n7;
+}
+
+Node7 &Node7::ShrinkNode15(ART &art, Node &node7, Node &node15) {
+
+	auto &n7 = New(art, node7);
+	auto &n15 = Node::RefMutable<Node15>(art, node15, NType::NODE_15);
+
+	D_ASSERT(n15.count <= Node::NODE_7_CAPACITY);
+	n7.count = n15.count;
+	for (idx_t i = 0; i < n15.count; i++) {
+		n7.key[i] = n15.key[i];
+		n7.children[i] = n15.children[i];
+	}
+
+	n15.count = 0;
+	Node::Free(art, node15);
+	return n7;
+}
+
+void Node7::InitializeMerge(ART &art, const ARTFlags &flags) {
+
+	for (idx_t i = 0; i < count; i++) {
+		children[i].InitializeMerge(art, flags);
+	}
+}
+
+void Node7::InsertChild(ART &art, Node &node, const uint8_t byte, const Node child) {
+
+	D_ASSERT(node.HasMetadata());
+	auto &n7 = Node::RefMutable<Node7>(art, node, NType::NODE_7);
+
+	// ensure that there is no other child at the same byte
+	for (idx_t i = 0; i < n7.count; i++) {
+		D_ASSERT(n7.key[i] != byte);
+	}
+
+	// insert new child node into node
+	if (n7.count < Node::NODE_7_CAPACITY) {
+		// still space, just insert the child
+		idx_t child_pos = 0;
+		while (child_pos < n7.count && n7.key[child_pos] < byte) {
+			child_pos++;
+		}
+		// move children backwards to make space
+		for (idx_t i = n7.count; i > child_pos; i--) {
+			n7.key[i] = n7.key[i - 1];
+			n7.children[i] = n7.children[i - 1];
+		}
+
+		n7.key[child_pos] = byte;
+		n7.children[child_pos] = child;
+		n7.count++;
+
+	} else {
+		// node is full, grow to Node15
+		auto node7 = node;
+		Node15::GrowNode7(art, node, node7);
+		Node15::InsertChild(art, node, byte, child);
+	}
+}
+
+void Node7::DeleteChild(ART &art, Node &node, const uint8_t byte) {
+
+	D_ASSERT(node.HasMetadata());
+	auto &n7 = Node::RefMutable<Node7>(art, node, NType::NODE_7);
+
+	idx_t child_pos = 0;
+	for (; child_pos < n7.count; child_pos++) {
+		if (n7.key[child_pos] == byte) {
+			break;
+		}
+	}
+
+	D_ASSERT(child_pos < n7.count);
+
+	// free the child and decrease the count
+	Node::Free(art, n7.children[child_pos]);
+	n7.count--;
+
+	// potentially move any children backwards
+	for (idx_t i = child_pos; i < n7.count; i++) {
+		n7.key[i] = n7.key[i + 1];
+		n7.children[i] = n7.children[i + 1];
+	}
+
+	// shrink node to Node4
+	if (n7.count < Node::NODE_4_CAPACITY) {
+		auto node7 = node;
+		Node4::ShrinkNode7(art, node, node7);
+	}
+}
+
+void Node7::ReplaceChild(const uint8_t byte, const Node child) {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] == byte) {
+			children[i] = child;
+			return;
+		}
+	}
+}
+
+optional_ptr<const Node> Node7::GetChild(const uint8_t byte) const {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] == byte) {
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+optional_ptr<Node> Node7::GetChildMutable(const uint8_t byte) {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] == byte) {
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+optional_ptr<const Node> Node7::GetNextChild(uint8_t &byte) const {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] >= byte) {
+			byte = key[i];
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+optional_ptr<Node> Node7::GetNextChildMutable(uint8_t &byte) {
+	for (idx_t i = 0; i < count; i++) {
+		if (key[i] >= byte) {
+			byte = key[i];
+			D_ASSERT(children[i].HasMetadata());
+			return &children[i];
+		}
+	}
+	return nullptr;
+}
+
+} // namespace duckdb
@@ -13,7 +13,7 @@ Prefix &Prefix::New(ART &art, Node &node) {
 	node.SetMetadata(static_cast<uint8_t>(NType::PREFIX));
 
 	auto &prefix = Node::RefMutable<Prefix>(art, node, NType::PREFIX);
-	prefix.data[Node::PREFIX_SIZE] = 0;
+	prefix.Count(art) = 0;
 	return prefix;
 }
 
@@ -23,9 +23,9 @@ Prefix &Prefix::New(ART &art, Node &node, uint8_t byte, const Node &next) {
 	node.SetMetadata(static_cast<uint8_t>(NType::PREFIX));
 
 	auto &prefix = Node::RefMutable<Prefix>(art, node, NType::PREFIX);
-	prefix.data[Node::PREFIX_SIZE] = 1;
+	prefix.Count(art) = 1;
 	prefix.data[0] = byte;
-	prefix.ptr = next;
+	prefix.Ptr(art) = next;
 	return prefix;
 }
 
@@ -41,11 +41,11 @@ void Prefix::New(ART &art, reference<Node> &node, const ARTKey &key, const uint3
 		node.get().SetMetadata(static_cast<uint8_t>(NType::PREFIX));
 		auto &prefix = Node::RefMutable<Prefix>(art, node, NType::PREFIX);
 
-		auto this_count = MinValue((uint32_t)Node::PREFIX_SIZE, count);
-		prefix.data[Node::PREFIX_SIZE] = (uint8_t)this_count;
+		auto this_count = MinValue((uint32_t)art.prefix_count, count);
+		prefix.Count(art) = (uint8_t)this_count;
 		memcpy(prefix.data, key.data + depth + copy_count, this_count);
 
-		node = prefix.ptr;
+		node = prefix.Ptr(art);
 		copy_count += this_count;
 		count -= this_count;
 	}
@@ -56,7 +56,7 @@ void Prefix::Free(ART &art, Node &node) {
 	Node current_node = node;
 	Node next_node;
 	while (current_node.HasMetadata() && current_node.GetType() == NType::PREFIX) {
-		next_node = Node::RefMutable<Prefix>(art, current_node, NType::PREFIX).ptr;
+		next_node = Node::RefMutable<Prefix>(art, current_node, NType::PREFIX).Ptr(art);
 		Node::GetAllocator(art, NType::PREFIX).Free(current_node);
 		current_node = next_node;
 	}
@@ -67,21 +67,21 @@ void Prefix::Free(ART &art, Node &node) {
 
 void Prefix::InitializeMerge(ART &art, Node &node, const ARTFlags &flags) {
 
-	auto merge_buffer_count = flags.merge_buffer_counts[static_cast<uint8_t>(NType::PREFIX) - 1];
+	auto merge_buffer_count = flags.merge_buffer_counts[Node::GetAllocatorIdx(NType::PREFIX)];
 
 	Node next_node = node;
 	reference<Prefix> prefix = Node::RefMutable<Prefix>(art, next_node, NType::PREFIX);
 
 	while (next_node.GetType() == NType::PREFIX) {
-		next_node = prefix.get().ptr;
-		if (prefix.get().ptr.GetType() == NType::PREFIX) {
-			prefix.get().ptr.IncreaseBufferId(merge_buffer_count);
+		next_node = prefix.get().Ptr(art);
+		if (prefix.get().Ptr(art).GetType() == NType::PREFIX) {
+			prefix.get().Ptr(art).IncreaseBufferId(merge_buffer_count);
 			prefix = Node::RefMutable<Prefix>(art, next_node, NType::PREFIX);
 		}
 	}
 
 	node.IncreaseBufferId(merge_buffer_count);
-	prefix.get().ptr.InitializeMerge(art, flags);
+	prefix.get().Ptr(art).InitializeMerge(art, flags);
 }
 
 void Prefix::Concatenate(ART &art, Node &prefix_node, const uint8_t byte, Node &child_prefix_node) {
@@ -93,11 +93,11 @@ void Prefix::Concatenate(ART &art, Node &prefix_node, const uint8_t byte, Node &
 
 		// get the tail
 		reference<Prefix> prefix = Node::RefMutable<Prefix>(art, prefix_node, NType::PREFIX);
-		D_ASSERT(prefix.get().ptr.HasMetadata());
+		D_ASSERT(prefix.get().Ptr(art).HasMetadata());
 
-		while (prefix.get().ptr.GetType() == NType::PREFIX) {
-			prefix = Node::RefMutable<Prefix>(art, prefix.get().ptr, NType::PREFIX);
-			D_ASSERT(prefix.get().ptr.HasMetadata());
+		while (prefix.get().Ptr(art).GetType() == NType::PREFIX) {
+			prefix = Node::RefMutable<Prefix>(art, prefix.get().Ptr(art), NType::PREFIX);
+			D_ASSERT(prefix.get().Ptr(art).HasMetadata());
 		}
 
 		// append the byte
@@ -108,7 +108,7 @@ void Prefix::Concatenate(ART &art, Node &prefix_node, const uint8_t byte, Node &
 			prefix.get().Append(art, child_prefix_node);
 		} else {
 			// set child_prefix_node to succeed prefix
-			prefix.get().ptr = child_prefix_node;
+			prefix.get().Ptr(art) = child_prefix_node;
 		}
 		return;
 	}
@@ -135,13 +135,13 @@ idx_t Prefix::Traverse(ART &art, reference<const Node> &prefix_node, const ARTKe
 	// compare prefix nodes to key bytes
 	while (prefix_node.get().GetType() == NType::PREFIX) {
 		auto &prefix = Node::Ref<const Prefix>(art, prefix_node, NType::PREFIX);
-		for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		for (idx_t i = 0; i < prefix.Count(art); i++) {
 			if (prefix.data[i] != key[depth]) {
 				return i;
 			}
 			depth++;
 		}
-		prefix_node = prefix.ptr;
+		prefix_node = prefix.Ptr(art);
 		D_ASSERT(prefix_node.get().HasMetadata());
 	}
 
@@ -156,13 +156,13 @@ idx_t Prefix::TraverseMutable(ART &art, reference<Node> &prefix_node, const ARTK
 	// compare prefix nodes to key bytes
 	while (prefix_node.get().GetType() == NType::PREFIX) {
 		auto &prefix = Node::RefMutable<Prefix>(art, prefix_node, NType::PREFIX);
-		for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		for (idx_t i = 0; i < prefix.Count(art); i++) {
 			if (prefix.data[i] != key[depth]) {
 				return i;
 			}
 			depth++;
 		}
-		prefix_node = prefix.ptr;
+		prefix_node = prefix.Ptr(art);
 		D_ASSERT(prefix_node.get().HasMetadata());
 	}
 
@@ -175,7 +175,7 @@ bool Prefix::Traverse(ART &art, reference<Node> &l_node, reference<Node> &r_node
 	auto &r_prefix = Node::RefMutable<Prefix>(art, r_node.get(), NType::PREFIX);
 
 	// compare prefix bytes
-	idx_t max_count = MinValue(l_prefix.data[Node::PREFIX_SIZE], r_prefix.data[Node::PREFIX_SIZE]);
+	idx_t max_count = MinValue(l_prefix.Count(art), r_prefix.Count(art));
 	for (idx_t i = 0; i < max_count; i++) {
 		if (l_prefix.data[i] != r_prefix.data[i]) {
 			mismatch_position = i;
@@ -186,20 +186,20 @@ bool Prefix::Traverse(ART &art, reference<Node> &l_node, reference<Node> &r_node
 	if (mismatch_position == DConstants::INVALID_INDEX) {
 
 		// prefixes match (so far)
-		if (l_prefix.data[Node::PREFIX_SIZE] == r_prefix.data[Node::PREFIX_SIZE]) {
-			return l_prefix.ptr.ResolvePrefixes(art, r_prefix.ptr);
+		if (l_prefix.Count(art) == r_prefix.Count(art)) {
+			return l_prefix.Ptr(art).ResolvePrefixes(art, r_prefix.Ptr(art));
 		}
 
 		mismatch_position = max_count;
 
 		// l_prefix contains r_prefix
-		if (r_prefix.ptr.GetType() != NType::PREFIX && r_prefix.data[Node::PREFIX_SIZE] == max_count) {
+		if (r_prefix.Ptr(art).GetType() != NType::PREFIX && r_prefix.Count(art) == max_count) {
 			swap(l_node.get(), r_node.get());
-			l_node = r_prefix.ptr;
+			l_node = r_prefix.Ptr(art);
 
 		} else {
 			// r_prefix contains l_prefix
-			l_node = l_prefix.ptr;
+			l_node = l_prefix.Ptr(art);
 		}
 	}
 
@@ -209,29 +209,29 @@ bool Prefix::Traverse(ART &art, reference<Node> &l_node, reference<Node> &r_node
 void Prefix::Reduce(ART &art, Node &prefix_node, const idx_t n) {
 
 	D_ASSERT(prefix_node.HasMetadata());
-	D_ASSERT(n < Node::PREFIX_SIZE);
+	D_ASSERT(n < art.prefix_count);
 
 	reference<Prefix> prefix = Node::RefMutable<Prefix>(art, prefix_node, NType::PREFIX);
 
 	// free this prefix node
-	if (n == (idx_t)(prefix.get().data[Node::PREFIX_SIZE] - 1)) {
-		auto next_ptr = prefix.get().ptr;
+	if (n == (idx_t)(prefix.get().Count(art) - 1)) {
+		auto next_ptr = prefix.get().Ptr(art);
 		D_ASSERT(next_ptr.HasMetadata());
-		prefix.get().ptr.Clear();
+		prefix.get().Ptr(art).Clear();
 		Node::Free(art, prefix_node);
 		prefix_node = next_ptr;
 		return;
 	}
 
 	// shift by n bytes in the current prefix
-	for (idx_t i = 0; i < Node::PREFIX_SIZE - n - 1; i++) {
+	for (idx_t i = 0; i < art.prefix_count - n - 1; i++) {
 		prefix.get().data[i] = prefix.get().data[n + i + 1];
 	}
-	D_ASSERT(n < (idx_t)(prefix.get().data[Node::PREFIX_SIZE] - 1));
-	prefix.get().data[Node::PREFIX_SIZE] -= n + 1;
+	D_ASSERT(n < (idx_t)(prefix.get().Count(art) - 1));
+	prefix.get().Count(art) -= n + 1;
 
 	// append the remaining prefix bytes
-	prefix.get().Append(art, prefix.get().ptr);
+	prefix.get().Append(art, prefix.get().Ptr(art));
 }
 
 void Prefix::Split(ART &art, reference<Node> &prefix_node, Node &child_node, idx_t position) {
@@ -241,49 +241,49 @@ void Prefix::Split(ART &art, reference<Node> &prefix_node, Node &child_node, idx
 	auto &prefix = Node::RefMutable<Prefix>(art, prefix_node, NType::PREFIX);
 
 	// the split is at the last byte of this prefix, so the child_node contains all subsequent
-	// prefix nodes (prefix.ptr) (if any), and the count of this prefix decreases by one,
-	// then, we reference prefix.ptr, to overwrite it with a new node later
-	if (position + 1 == Node::PREFIX_SIZE) {
-		prefix.data[Node::PREFIX_SIZE]--;
-		prefix_node = prefix.ptr;
-		child_node = prefix.ptr;
+	// prefix nodes (prefix.Ptr(art)) (if any), and the count of this prefix decreases by one,
+	// then, we reference prefix.Ptr(art), to overwrite it with a new node later
+	if (position + 1 == art.prefix_count) {
+		prefix.Count(art)--;
+		prefix_node = prefix.Ptr(art);
+		child_node = prefix.Ptr(art);
 		return;
 	}
 
 	// append the remaining bytes after the split
-	if (position + 1 < prefix.data[Node::PREFIX_SIZE]) {
+	if (position + 1 < prefix.Count(art)) {
 		reference<Prefix> child_prefix = New(art, child_node);
-		for (idx_t i = position + 1; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		for (idx_t i = position + 1; i < prefix.Count(art); i++) {
 			child_prefix = child_prefix.get().Append(art, prefix.data[i]);
 		}
 
-		D_ASSERT(prefix.ptr.HasMetadata());
+		D_ASSERT(prefix.Ptr(art).HasMetadata());
 
-		if (prefix.ptr.GetType() == NType::PREFIX) {
-			child_prefix.get().Append(art, prefix.ptr);
+		if (prefix.Ptr(art).GetType() == NType::PREFIX) {
+			child_prefix.get().Append(art, prefix.Ptr(art));
 		} else {
 			// this is the last prefix node of the prefix
-			child_prefix.get().ptr = prefix.ptr;
+			child_prefix.get().Ptr(art) = prefix.Ptr(art);
 		}
 	}
 
 	// this is the last prefix node of the prefix
-	if (position + 1 == prefix.data[Node::PREFIX_SIZE]) {
-		child_node = prefix.ptr;
+	if (position + 1 == prefix.Count(art)) {
+		child_node = prefix.Ptr(art);
 	}
 
 	// set the new size of this node
-	prefix.data[Node::PREFIX_SIZE] = UnsafeNumericCast<uint8_t>(position);
+	prefix.Count(art) = UnsafeNumericCast<uint8_t>(position);
 
 	// no bytes left before the split, free this node
 	if (position == 0) {
-		prefix.ptr.Clear();
+		prefix.Ptr(art).Clear();
 		Node::Free(art, prefix_node.get());
 		return;
 	}
 
 	// bytes left before the split, reference subsequent node
-	prefix_node = prefix.ptr;
+	prefix_node = prefix.Ptr(art);
 	return;
 }
 
@@ -296,16 +296,16 @@ string Prefix::VerifyAndToString(ART &art, const Node &node, const bool only_ver
 	while (node_ref.get().GetType() == NType::PREFIX) {
 
 		auto &prefix = Node::Ref<const Prefix>(art, node_ref, NType::PREFIX);
-		D_ASSERT(prefix.data[Node::PREFIX_SIZE] != 0);
-		D_ASSERT(prefix.data[Node::PREFIX_SIZE] <= Node::PREFIX_SIZE);
+		D_ASSERT(prefix.Count(art) != 0);
+		D_ASSERT(prefix.Count(art) <= art.prefix_count);
 
 		str += " prefix_bytes:[";
-		for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		for (idx_t i = 0; i < prefix.Count(art); i++) {
 			str += to_string(prefix.data[i]) + "-";
 		}
 		str += "] ";
 
-		node_ref = prefix.ptr;
+		node_ref = prefix.Ptr(art);
 	}
 
 	auto subtree = node_ref.get().VerifyAndToString(art, only_verify);
@@ -314,20 +314,35 @@ string Prefix::VerifyAndToString(ART &art, const Node &node, const bool only_ver
 
 void Prefix::Vacuum(ART &art, Node &node, const ARTFlags &flags) {
 
-	bool flag_set = flags.vacuum_flags[static_cast<uint8_t>(NType::PREFIX) - 1];
+	bool flag_set = flags.vacuum_flags[Node::GetAllocatorIdx(NType::PREFIX)];
 	auto &allocator = Node::GetAllocator(art, NType::PREFIX);
 
-	reference<Node> node_ref(node);
-	while (node_ref.get().GetType() == NType::PREFIX) {
-		if (flag_set && allocator.NeedsVacuum(node_ref)) {
-			node_ref.get() = allocator.VacuumPointer(node_ref);
-			node_ref.get().SetMetadata(static_cast<uint8_t>(NType::PREFIX));
-		}
-		auto &prefix = Node::RefMutable<Prefix>(art, node_ref, NType::PREFIX);
-		node_ref = prefix.ptr;
+	if (flag_set && allocator.NeedsVacuum(node)) {
+		node = allocator.VacuumPointer(node);
+		node.SetMetadata(static_cast<uint8_t>(NType::PREFIX));
 	}
 
-	node_ref.get().Vacuum(art, flags);
+	// we only write the pointer of a prefix node back, if the vacuum moved the next node
+	Node current_node = node;
+	while (true) {
+		auto next_node = Node::Ref<const Prefix>(art, current_node, NType::PREFIX).Ptr(art);
+		auto old_next_node = next_node;
+
+		if (next_node.GetType() != NType::PREFIX) {
+			next_node.Vacuum(art, flags);
+			if (!(next_node == old_next_node)) {
+				Node::RefMutable<Prefix>(art, current_node, NType::PREFIX).Ptr(art) = next_node;
+			}
+			return;
+		}
+
+		if (flag_set && allocator.NeedsVacuum(next_node)) {
+			next_node = allocator.VacuumPointer(next_node);
+			next_node.SetMetadata(static_cast<uint8_t>(NType::PREFIX));
+			Node::RefMutable<Prefix>(art, current_node, NType::PREFIX).Ptr(art) = next_node;
+		}
+		current_node = next_node;
+	}
 }
 
 Prefix &Prefix::Append(ART &art, const uint8_t byte) {
@@ -335,12 +350,12 @@ Prefix &Prefix::Append(ART &art, const uint8_t byte) {
 	reference<Prefix> prefix(*this);
 
 	// we need a new prefix node
-	if (prefix.get().data[Node::PREFIX_SIZE] == Node::PREFIX_SIZE) {
-		prefix = New(art, prefix.get().ptr);
+	if (prefix.get().Count(art) == art.prefix_count) {
+		prefix = New(art, prefix.get().Ptr(art));
 	}
 
-	prefix.get().data[prefix.get().data[Node::PREFIX_SIZE]] = byte;
-	prefix.get().data[Node::PREFIX_SIZE]++;
+	prefix.get().data[prefix.get().Count(art)] = byte;
+	prefix.get().Count(art)++;
 	return prefix.get();
 }
 
@@ -353,18 +368,18 @@ void Prefix::Append(ART &art, Node other_prefix) {
 
 		// copy prefix bytes
 		auto &other = Node::RefMutable<Prefix>(art, other_prefix, NType::PREFIX);
-		for (idx_t i = 0; i < other.data[Node::PREFIX_SIZE]; i++) {
+		for (idx_t i = 0; i < other.Count(art); i++) {
 			prefix = prefix.get().Append(art, other.data[i]);
 		}
 
-		D_ASSERT(other.ptr.HasMetadata());
+		D_ASSERT(other.Ptr(art).HasMetadata());
 
-		prefix.get().ptr = other.ptr;
+		prefix.get().Ptr(art) = other.Ptr(art);
 		Node::GetAllocator(art, NType::PREFIX).Free(other_prefix);
-		other_prefix = prefix.get().ptr;
+		other_prefix = prefix.get().Ptr(art);
 	}
 
-	D_ASSERT(prefix.get().ptr.GetType() != NType::PREFIX);
+	D_ASSERT(prefix.get().Ptr(art).GetType() != NType::PREFIX);
 }
 
 } // namespace duckdb
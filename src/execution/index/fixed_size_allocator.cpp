@@ -8,6 +8,13 @@ FixedSizeAllocator::FixedSizeAllocator(const idx_t segment_size, BlockManager &b
     : block_manager(block_manager), buffer_manager(block_manager.buffer_manager), segment_size(segment_size),
       total_segment_count(0) {
 
+	SetSegmentSize(segment_size);
+}
+
+void FixedSizeAllocator::SetSegmentSize(const idx_t segment_size_p) {
+
+	segment_size = segment_size_p;
+
 	if (segment_size > Storage::BLOCK_SIZE - sizeof(validity_t)) {
 		throw InternalException("The maximum segment size of fixed-size allocators is " +
 		                        to_string(Storage::BLOCK_SIZE - sizeof(validity_t)));
@@ -119,6 +126,7 @@ void FixedSizeAllocator::Reset() {
 	}
 	buffers.clear();
 	buffers_with_free_space.clear();
+	pinned_buffers.clear();
 	total_segment_count = 0;
 }
 
@@ -132,6 +140,17 @@ idx_t FixedSizeAllocator::GetInMemorySize() const {
 	return memory_usage;
 }
 
+void FixedSizeAllocator::UnpinBuffers() {
+	for (auto &buffer_id : pinned_buffers) {
+		// the buffer might have been freed or vacuumed in the meantime
+		auto buffer_it = buffers.find(buffer_id);
+		if (buffer_it != buffers.end()) {
+			buffer_it->second.Unpin();
+		}
+	}
+	pinned_buffers.clear();
+}
+
 idx_t FixedSizeAllocator::GetUpperBoundBufferId() const {
 	idx_t upper_bound_id = 0;
 	for (auto &buffer : buffers) {
@@ -165,8 +184,8 @@ void FixedSizeAllocator::Merge(FixedSizeAllocator &other) {
 
 bool FixedSizeAllocator::InitializeVacuum() {
 
-	// NOTE: we do not vacuum buffers that are not in memory. We might consider changing this
-	// in the future, although buffers on disk should almost never be eligible for a vacuum
+	// NOTE: we only vacuum buffers that changed since the last checkpoint, i.e., buffers that are in memory and not
+	// on disk. Vacuuming unchanged on-disk buffers would rewrite them during the next checkpoint
 
 	if (total_segment_count == 0) {
 		Reset();
@@ -192,7 +211,7 @@ bool FixedSizeAllocator::InitializeVacuum() {
 
 	for (auto &buffer : buffers) {
 		buffer.second.vacuum = false;
-		if (buffer.second.InMemory()) {
+		if (buffer.second.InMemory() && !buffer.second.OnDisk()) {
 			auto available_segments_in_buffer = available_segments_per_buffer - buffer.second.segment_count;
 			available_segments_in_memory += available_segments_in_buffer;
 			temporary_vacuum_buffers.emplace(available_segments_in_buffer, buffer.first);
@@ -208,7 +227,7 @@ bool FixedSizeAllocator::InitializeVacuum() {
 
 	// calculate the vacuum threshold adaptively
 	D_ASSERT(excess_buffer_count < temporary_vacuum_buffers.size());
-	idx_t memory_usage = GetInMemorySize();
+	idx_t memory_usage = temporary_vacuum_buffers.size() * Storage::BLOCK_SIZE;
 	idx_t excess_memory_usage = excess_buffer_count * Storage::BLOCK_SIZE;
 	auto excess_percentage = double(excess_memory_usage) / double(memory_usage);
 	auto threshold = double(VACUUM_THRESHOLD) / 100.0;
@@ -260,7 +279,7 @@ IndexPointer FixedSizeAllocator::VacuumPointer(const IndexPointer ptr) {
 	// new increases the allocation count, we need to counter that here
 	total_segment_count--;
 
-	memcpy(Get(new_ptr), Get(ptr), segment_size);
+	memcpy(Get(new_ptr), Get(ptr, false), segment_size);
 	return new_ptr;
 }
 
@@ -301,7 +320,7 @@ vector<IndexBufferInfo> FixedSizeAllocator::InitSerializationToWAL() {
 
 void FixedSizeAllocator::Init(const FixedSizeAllocatorInfo &info) {
 
-	segment_size = info.segment_size;
+	SetSegmentSize(info.segment_size);
 	total_segment_count = 0;
 
 	for (idx_t i = 0; i < info.buffer_ids.size(); i++) {
@@ -326,7 +345,7 @@ void FixedSizeAllocator::Init(const FixedSizeAllocatorInfo &info) {
 void FixedSizeAllocator::Deserialize(MetadataManager &metadata_manager, const BlockPointer &block_pointer) {
 
 	MetadataReader reader(metadata_manager, block_pointer);
-	segment_size = reader.Read<idx_t>();
+	SetSegmentSize(reader.Read<idx_t>());
 	auto buffer_count = reader.Read<idx_t>();
 	auto buffers_with_free_space_count = reader.Read<idx_t>();
 
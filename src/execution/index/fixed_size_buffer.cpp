@@ -90,25 +90,25 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 	// now we write the changes, first get a partial block allocation
 	PartialBlockAllocation allocation =
 	    partial_block_manager.GetBlockAllocation(NumericCast<uint32_t>(allocation_size));
-	block_pointer.block_id = allocation.state.block_id;
-	block_pointer.offset = allocation.state.offset;
+	// we only set the block pointer once we no longer access the in-memory buffer, as Get() detaches on-disk buffers
+	BlockPointer new_block_pointer(allocation.state.block_id, allocation.state.offset);
 
 	auto &buffer_manager = block_manager.buffer_manager;
 
 	if (allocation.partial_block) {
 		// copy to an existing partial block
-		D_ASSERT(block_pointer.offset > 0);
+		D_ASSERT(new_block_pointer.offset > 0);
 		auto &p_block_for_index = allocation.partial_block->Cast<PartialBlockForIndex>();
 		auto dst_handle = buffer_manager.Pin(p_block_for_index.block_handle);
-		memcpy(dst_handle.Ptr() + block_pointer.offset, buffer_handle.Ptr(), allocation_size);
-		SetUninitializedRegions(p_block_for_index, segment_size, block_pointer.offset, bitmask_offset);
+		memcpy(dst_handle.Ptr() + new_block_pointer.offset, buffer_handle.Ptr(), allocation_size);
+		SetUninitializedRegions(p_block_for_index, segment_size, new_block_pointer.offset, bitmask_offset);
 
 	} else {
 		// create a new block that can potentially be used as a partial block
 		D_ASSERT(block_handle);
-		D_ASSERT(!block_pointer.offset);
+		D_ASSERT(!new_block_pointer.offset);
 		auto p_block_for_index = make_uniq<PartialBlockForIndex>(allocation.state, block_manager, block_handle);
-		SetUninitializedRegions(*p_block_for_index, segment_size, block_pointer.offset, bitmask_offset);
+		SetUninitializedRegions(*p_block_for_index, segment_size, new_block_pointer.offset, bitmask_offset);
 		allocation.partial_block = std::move(p_block_for_index);
 	}
 
@@ -116,6 +116,7 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 
 	// resetting this buffer
 	buffer_handle.Destroy();
+	block_pointer = new_block_pointer;
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 
@@ -130,8 +131,15 @@ void FixedSizeBuffer::Pin() {
 	D_ASSERT(!dirty);
 
 	buffer_handle = buffer_manager.Pin(block_handle);
+}
+
+void FixedSizeBuffer::Detach() {
+	auto &buffer_manager = block_manager.buffer_manager;
+	D_ASSERT(InMemory() && OnDisk());
+	D_ASSERT(!dirty);
 
-	// we need to copy the (partial) data into a new (not yet disk-backed) buffer handle
+	// we must not modify the on-disk block, as it belongs to the last checkpoint and might contain other
+	// (partial) buffers, so we copy the (partial) data into a new (not yet disk-backed) buffer handle
 	shared_ptr<BlockHandle> new_block_handle;
 	auto new_buffer_handle =
 	    buffer_manager.Allocate(MemoryTag::ART_INDEX, Storage::BLOCK_SIZE, false, &new_block_handle);
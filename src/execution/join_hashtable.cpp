@@ -18,7 +18,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0),
+      probing_slices(false) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -86,32 +87,64 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
+//! Prefetches the cache line that holds the given address
+static inline void Prefetch(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#endif
+}
+
+//! Entries of the pointer table hold a salt in the upper 16 bits and a pointer to a row in the lower 48 bits
+static constexpr const hash_t ENTRY_SALT_MASK = 0xFFFF000000000000;
+static constexpr const hash_t ENTRY_POINTER_MASK = 0x0000FFFFFFFFFFFF;
+
+static inline hash_t EntrySalt(const hash_t hash) {
+	return hash & ENTRY_SALT_MASK;
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+static inline data_ptr_t EntryPointer(const hash_t entry) {
+	return reinterpret_cast<data_ptr_t>(entry & ENTRY_POINTER_MASK);
+}
+
+static inline hash_t CreateEntry(const hash_t salt, const data_ptr_t pointer) {
+	// Pointer shouldn't use upper bits
+	D_ASSERT((reinterpret_cast<hash_t>(pointer) & ENTRY_SALT_MASK) == 0);
+	return salt | reinterpret_cast<hash_t>(pointer);
+}
+
+void JoinHashTable::GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
-	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
+	auto entries = reinterpret_cast<const hash_t *>(hash_map.get());
+
+	// First compute the positions of the entire batch and prefetch the entries, so the lookups below don't stall on
+	// each cache miss one by one
+	hash_t slots[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		auto hindex = hdata.sel->get_index(sel.get_index(i));
+		slots[i] = hash_data[hindex] & bitmask;
+		Prefetch(entries + slots[i]);
+	}
+
+	// Linear probing: skip entries that have a different salt, until we find the chain for our salt (or nothing)
 	for (idx_t i = 0; i < count; i++) {
 		auto rindex = sel.get_index(i);
 		auto hindex = hdata.sel->get_index(rindex);
-		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		const auto salt = EntrySalt(hash_data[hindex]);
+		auto slot = slots[i];
+		data_ptr_t row_pointer = nullptr;
+		while (entries[slot] != 0) {
+			if (EntrySalt(entries[slot]) == salt) {
+				row_pointer = EntryPointer(entries[slot]);
+				Prefetch(row_pointer);
+				break;
+			}
+			slot = (slot + 1) & bitmask;
+		}
+		result_data[rindex] = row_pointer;
 	}
 }
 
@@ -244,42 +277,49 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<hash_t> entries[], const hash_t hashes[], const idx_t count,
+                                    const data_ptr_t key_locations[], const idx_t pointer_offset,
+                                    const uint64_t bitmask) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
-		if (PARALLEL) {
-			data_ptr_t head;
-			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
-		} else {
-			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
-
-			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+		const auto salt = EntrySalt(hashes[i]);
+		const auto new_entry = CreateEntry(salt, key_locations[i]);
+		// Linear probing: find the first entry that is empty or that has the same salt. Rows with the same salt are
+		// chained together through their next pointer, the key comparisons happen when probing
+		auto slot = hashes[i] & bitmask;
+		while (true) {
+			auto entry = entries[slot].load();
+			if (entry != 0 && EntrySalt(entry) != salt) {
+				slot = (slot + 1) & bitmask;
+				continue;
+			}
+			if (PARALLEL) {
+				// set next in current key to the head of the chain (NOTE: this will be nullptr if there is none)
+				Store<data_ptr_t>(EntryPointer(entry), key_locations[i] + pointer_offset);
+				if (!std::atomic_compare_exchange_weak(&entries[slot], &entry, new_entry)) {
+					// another thread changed this entry, look at it again
+					continue;
+				}
+			} else {
+				Store<data_ptr_t>(EntryPointer(entry), key_locations[i] + pointer_offset);
+				entries[slot] = new_entry;
+			}
+			break;
 		}
 	}
 }
 
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
-
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto entries = reinterpret_cast<atomic<hash_t> *>(hash_map.get());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(entries, hash_data, count, key_locations, pointer_offset, bitmask);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(entries, hash_data, count, key_locations, pointer_offset, bitmask);
 	}
 }
 
@@ -289,19 +329,19 @@ void JoinHashTable::InitializePointerTable() {
 
 	if (hash_map.get()) {
 		// There is already a hash map
-		auto current_capacity = hash_map.GetSize() / sizeof(data_ptr_t);
+		auto current_capacity = hash_map.GetSize() / sizeof(hash_t);
 		if (capacity != current_capacity) {
 			// Different size, re-allocate
-			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(hash_t));
 		}
 	} else {
 		// Allocate a hash map
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(hash_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == capacity * sizeof(hash_t));
 
-	// initialize HT with all-zero entries
-	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
+	// initialize HT with all-zero (empty) entries
+	std::fill_n(reinterpret_cast<hash_t *>(hash_map.get()), capacity, hash_t(0));
 
 	bitmask = capacity - 1;
 }
@@ -353,14 +393,14 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -378,6 +418,10 @@ void ScanStructure::Next(DataChunk &keys, DataChunk &left, DataChunk &result) {
 	if (finished) {
 		return;
 	}
+	if (slice_matches_only) {
+		NextSliceMatches(keys, left, result);
+		return;
+	}
 	switch (ht.join_type) {
 	case JoinType::INNER:
 	case JoinType::RIGHT:
@@ -413,6 +457,16 @@ bool ScanStructure::PointersExhausted() {
 	return count == 0;
 }
 
+void ScanStructure::SetPreviousMatches(Vector &matches, idx_t count) {
+	D_ASSERT(found_match && matches.GetType() == LogicalType::BOOLEAN);
+	UnifiedVectorFormat mdata;
+	matches.ToUnifiedFormat(count, mdata);
+	auto match_data = UnifiedVectorFormat::GetData<bool>(mdata);
+	for (idx_t i = 0; i < count; i++) {
+		found_match[i] = match_data[mdata.sel->get_index(i)];
+	}
+}
+
 idx_t ScanStructure::ResolvePredicates(DataChunk &keys, SelectionVector &match_sel, SelectionVector *no_match_sel) {
 	// Start with the scan selection
 	for (idx_t i = 0; i < this->count; ++i) {
@@ -421,8 +475,11 @@ idx_t ScanStructure::ResolvePredicates(DataChunk &keys, SelectionVector &match_s
 	idx_t no_match_count = 0;
 
 	auto &matcher = no_match_sel ? ht.row_matcher_no_match_sel : ht.row_matcher;
-	return matcher.Match(keys, key_state.vector_data, match_sel, this->count, ht.layout, pointers, no_match_sel,
-	                     no_match_count);
+	auto match_count = matcher.Match(keys, key_state.vector_data, match_sel, this->count, ht.layout, pointers,
+	                                 no_match_sel, no_match_count);
+	comparisons += this->count;
+	matches += match_count;
+	return match_count;
 }
 
 idx_t ScanStructure::ScanInnerJoin(DataChunk &keys, SelectionVector &result_vector) {
@@ -456,6 +513,8 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		auto idx = sel.get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
 		if (ptrs[idx]) {
+			// the rows of the next batch are compared after this loop, fetch them already
+			Prefetch(ptrs[idx]);
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -468,7 +527,6 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	auto cnt = count;
 	for (idx_t i = 0; i < cnt; i++) {
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
 			sel_vector.set_index(non_empty_count++, idx);
 		}
@@ -789,6 +847,28 @@ void ScanStructure::NextSingleJoin(DataChunk &keys, DataChunk &input, DataChunk
 	finished = true;
 }
 
+void ScanStructure::NextSliceMatches(DataChunk &keys, DataChunk &left, DataChunk &result) {
+	switch (ht.join_type) {
+	case JoinType::OUTER:
+	case JoinType::LEFT:
+		// the tuples that did not find a match are only emitted with the last slice of the partition
+		NextInnerJoin(keys, left, result);
+		if (result.size() == 0) {
+			finished = true;
+		}
+		break;
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+	case JoinType::MARK:
+		// the result is only known with the last slice of the partition
+		ScanKeyMatches(keys);
+		finished = true;
+		break;
+	default:
+		throw InternalException("Unhandled join type for a slice of a partition in JoinHashTable");
+	}
+}
+
 void JoinHashTable::ScanFullOuter(JoinHTScanState &state, Vector &addresses, DataChunk &result) {
 	// scan the HT starting from the current position and check which rows from the build side did not find a match
 	auto key_locations = FlatVector::GetData<data_ptr_t>(addresses);
@@ -915,9 +995,12 @@ idx_t JoinHashTable::GetRemainingSize() {
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	auto &partitions = sink_collection->GetPartitions();
 
+	// If partition_start is built in slices, it has not been built entirely yet
+	const auto remaining_start = partition_slice_iterator ? partition_start : partition_end;
+
 	idx_t count = 0;
 	idx_t data_size = 0;
-	for (idx_t partition_idx = partition_end; partition_idx < num_partitions; partition_idx++) {
+	for (idx_t partition_idx = remaining_start; partition_idx < num_partitions; partition_idx++) {
 		count += partitions[partition_idx]->Count();
 		data_size += partitions[partition_idx]->SizeInBytes();
 	}
@@ -933,6 +1016,14 @@ void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &l
                                             const idx_t max_partition_size, const idx_t max_partition_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
 
+	radix_bits += GetAddedRadixBits(max_ht_size, max_partition_size, max_partition_count);
+	sink_collection =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	partition_spans.clear();
+}
+
+idx_t JoinHashTable::GetAddedRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
+                                       const idx_t max_partition_count) const {
 	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
 	idx_t added_bits = 1;
 	for (; added_bits < max_added_bits; added_bits++) {
@@ -947,9 +1038,7 @@ void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &l
 			break;
 		}
 	}
-	radix_bits += added_bits;
-	sink_collection =
-	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	return added_bits;
 }
 
 void JoinHashTable::Repartition(JoinHashTable &global_ht) {
@@ -965,21 +1054,145 @@ void JoinHashTable::Reset() {
 	finalized = false;
 }
 
+bool JoinHashTable::CanBuildPartitionInSlices() const {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return true;
+	default:
+		return SlicesTrackProbeMatches();
+	}
+}
+
+//! The probe tuples of these join types have to know whether they found a match in the entire partition. They are
+//! probed with every slice of the partition, and carry the matches they found so far to the next slice
+bool JoinHashTable::SlicesTrackProbeMatches() const {
+	switch (join_type) {
+	case JoinType::LEFT:
+	case JoinType::OUTER:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+	case JoinType::MARK:
+		return true;
+	default:
+		return false;
+	}
+}
+
+idx_t JoinHashTable::PartitionSpan(idx_t partition_idx) const {
+	return partition_spans.empty() ? 1 : partition_spans[partition_idx];
+}
+
+void JoinHashTable::RepartitionRemaining(const idx_t max_ht_size) {
+	D_ASSERT(partition_start == partition_end);
+	auto &partitions = sink_collection->GetPartitions();
+	auto &partition = *partitions[partition_start];
+
+	// If partition_start holds the data of several partitions, we split it without adding radix bits first
+	const auto span = PartitionSpan(partition_start);
+	D_ASSERT(span > 1 || radix_bits < RadixPartitioning::MAX_RADIX_BITS);
+	const auto added_bits =
+	    span == 1 ? GetAddedRadixBits(max_ht_size, partition.SizeInBytes(), partition.Count()) : idx_t(0);
+
+	// The radix bits are the upper bits of the hash, so partition i becomes partitions [i << added_bits,
+	// (i + 1) << added_bits). Only partition_start is repartitioned, the data of the other unbuilt partitions is moved
+	auto new_sink_collection = make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits + added_bits,
+	                                                                layout.ColumnCount() - 1);
+	vector<idx_t> new_partition_spans(RadixPartitioning::NumberOfPartitions(radix_bits + added_bits), 1);
+	sink_collection->Repartition(partition_start, *new_sink_collection);
+	for (idx_t partition_idx = partition_start + 1; partition_idx < partitions.size(); partition_idx++) {
+		if (partitions[partition_idx]->Count() == 0) {
+			continue;
+		}
+		const auto new_partition_idx = partition_idx << added_bits;
+		sink_collection->MovePartition(partition_idx, *new_sink_collection, new_partition_idx);
+		new_partition_spans[new_partition_idx] = PartitionSpan(partition_idx) << added_bits;
+	}
+	D_ASSERT(sink_collection->Count() == 0);
+	sink_collection = std::move(new_sink_collection);
+	partition_spans = std::move(new_partition_spans);
+
+	radix_bits += added_bits;
+	partition_start <<= added_bits;
+	partition_end <<= added_bits;
+}
+
+void JoinHashTable::BuildPartitionSlice(const idx_t max_ht_size) {
+	auto &partition = *sink_collection->GetPartitions()[partition_start];
+	if (!partition_slice_iterator) {
+		partition_slice_iterator =
+		    make_uniq<TupleDataChunkIterator>(partition, TupleDataPinProperties::DESTROY_AFTER_DONE, true);
+	}
+
+	TupleDataPinState pin_state;
+	data_collection->InitializeAppend(pin_state, TupleDataPinProperties::UNPIN_AFTER_DONE);
+	TupleDataChunkState chunk_state;
+	data_collection->InitializeChunkState(chunk_state);
+
+	// Copy chunks of the partition until the slice no longer fits (at least one chunk)
+	auto &input = partition_slice_iterator->GetChunkState();
+	do {
+		const auto append_count = partition_slice_iterator->GetCurrentChunkCount();
+		chunk_state.heap_sizes.Reference(input.heap_sizes);
+		data_collection->Build(pin_state, chunk_state, 0, append_count);
+		data_collection->CopyRows(chunk_state, input, *FlatVector::IncrementalSelectionVector(), append_count);
+		if (!partition_slice_iterator->Next()) {
+			// This was the last slice of the partition
+			partition_slice_iterator.reset();
+			partition.Reset();
+			break;
+		}
+	} while (data_collection->SizeInBytes() + PointerTableSize(data_collection->Count()) < max_ht_size);
+	data_collection->FinalizePinState(pin_state);
+}
+
 bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	if (finalized) {
 		Reset();
 	}
 
-	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	if (partition_slice_iterator) {
+		// Continue with the next slice of the partition that did not fit in memory
+		BuildPartitionSlice(max_ht_size);
+		return true;
+	}
+	probing_slices = false;
+
+	auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	if (partition_end == num_partitions) {
 		return false;
 	}
 
 	// Start where we left off
-	auto &partitions = sink_collection->GetPartitions();
 	partition_start = partition_end;
 
-	// Determine how many partitions we can do next (at least one)
+	// If the next partition does not fit by itself (e.g., due to skew), we recursively repartition it
+	while (true) {
+		auto &next_partition = *sink_collection->GetPartitions()[partition_start];
+		if (next_partition.SizeInBytes() + PointerTableSize(next_partition.Count()) <= max_ht_size) {
+			break;
+		}
+		if (PartitionSpan(partition_start) == 1 && radix_bits == RadixPartitioning::MAX_RADIX_BITS) {
+			break;
+		}
+		RepartitionRemaining(max_ht_size);
+		num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	}
+	auto &partitions = sink_collection->GetPartitions();
+
+	// If it still does not fit, the partition is dominated by few keys. We build and probe it in slices if we can
+	auto &partition = *partitions[partition_start];
+	if (partition.SizeInBytes() + PointerTableSize(partition.Count()) > max_ht_size && CanBuildPartitionInSlices()) {
+		partition_end = partition_start + 1;
+		probing_slices = true;
+		BuildPartitionSlice(max_ht_size);
+		return true;
+	}
+
+	// Determine how many partitions we can do next (at least one). Partitions that hold the data of several partitions
+	// are followed by empty ones, so we never stop in the middle of their span
 	idx_t count = 0;
 	idx_t data_size = 0;
 	idx_t partition_idx;
@@ -1027,18 +1240,32 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	Hash(keys, *FlatVector::IncrementalSelectionVector(), keys.size(), hashes);
 
 	// find out which keys we can match with the current pinned partitions
+	// if the probe tuples track their matches over the slices of partition_start, they are probed with the first slice
+	// together with the rest of the partition after this pipeline
+	const auto probe_end = ProbesSliceMatches() ? partition_start : partition_end;
 	SelectionVector true_sel;
 	SelectionVector false_sel;
 	true_sel.Initialize();
 	false_sel.Initialize();
 	auto true_count = RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(), keys.size(),
-	                                            radix_bits, partition_end, &true_sel, &false_sel);
-	auto false_count = keys.size() - true_count;
+	                                            radix_bits, probe_end, &true_sel, &false_sel);
 
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
 	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
+	idx_t spill_count;
+	if (partition_slice_iterator && !ProbesSliceMatches()) {
+		// the current partition is built in slices, values of this partition must be probed again with the next slices
+		SelectionVector spill_sel;
+		spill_sel.Initialize();
+		spill_count = keys.size() - RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(),
+		                                                      keys.size(), radix_bits, partition_start, nullptr,
+		                                                      &spill_sel);
+		spill_chunk.Slice(spill_sel, spill_count);
+	} else {
+		spill_count = keys.size() - true_count;
+		spill_chunk.Slice(false_sel, spill_count);
+	}
 	spill_chunk.Verify();
 	probe_spill.Append(spill_chunk, spill_state);
 
@@ -1054,7 +1281,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
@@ -1063,13 +1290,17 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 }
 
 ProbeSpill::ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types)
-    : ht(ht), context(context), probe_types(probe_types) {
+    : ht(ht), context(context), probe_types(probe_types), probes_slice_matches(false) {
 	global_partitions =
 	    make_uniq<RadixPartitionedColumnData>(context, probe_types, ht.radix_bits, probe_types.size() - 1);
 	column_ids.reserve(probe_types.size());
 	for (column_t column_id = 0; column_id < probe_types.size(); column_id++) {
 		column_ids.emplace_back(column_id);
 	}
+	slice_types = probe_types;
+	slice_types.emplace_back(LogicalType::BOOLEAN);
+	slice_column_ids = column_ids;
+	slice_column_ids.emplace_back(probe_types.size());
 }
 
 ProbeSpillLocalState ProbeSpill::RegisterThread() {
@@ -1100,17 +1331,145 @@ void ProbeSpill::Finalize() {
 	local_partition_append_states.clear();
 }
 
+void ProbeSpill::Repartition() {
+	// Like the HT, we do not copy the probe data. The data of each partition is moved to the first of the partitions it
+	// belongs to with the new radix bits, and is only split when a probe round ends in the middle of them
+	const auto added_bits = ht.radix_bits - global_partitions->GetRadixBits();
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(ht.radix_bits);
+	auto new_partitions =
+	    make_uniq<RadixPartitionedColumnData>(context, probe_types, ht.radix_bits, probe_types.size() - 1);
+	vector<idx_t> new_partition_spans(num_partitions, 1);
+
+	auto &partitions = global_partitions->GetPartitions();
+	if (!partitions.empty()) {
+		auto &new_partition_data = new_partitions->GetPartitions();
+		new_partition_data.resize(num_partitions);
+		for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+			auto &partition = partitions[partition_idx];
+			if (!partition || partition->Count() == 0) {
+				// Already probed, or empty
+				continue;
+			}
+			const auto new_partition_idx = partition_idx << added_bits;
+			const auto span = partition_spans.empty() ? 1 : partition_spans[partition_idx];
+			new_partition_data[new_partition_idx] = std::move(partition);
+			new_partition_spans[new_partition_idx] = span << added_bits;
+		}
+	}
+	global_partitions = std::move(new_partitions);
+	partition_spans = std::move(new_partition_spans);
+}
+
+void ProbeSpill::SplitPartition(idx_t partition_idx, idx_t cutoff) {
+	auto &partitions = global_partitions->GetPartitions();
+	const auto span = partition_spans[partition_idx];
+	D_ASSERT(partition_idx < cutoff && cutoff < partition_idx + span);
+	if (partitions[partition_idx]) {
+		// Split the data in the partitions before and after the cutoff
+		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		auto lower_partition = make_uniq<ColumnDataCollection>(buffer_manager, probe_types);
+		auto upper_partition = make_uniq<ColumnDataCollection>(buffer_manager, probe_types);
+		ColumnDataAppendState lower_append_state;
+		ColumnDataAppendState upper_append_state;
+		lower_partition->InitializeAppend(lower_append_state);
+		upper_partition->InitializeAppend(upper_append_state);
+
+		DataChunk split_chunk;
+		split_chunk.InitializeEmpty(probe_types);
+		SelectionVector lower_sel(STANDARD_VECTOR_SIZE);
+		SelectionVector upper_sel(STANDARD_VECTOR_SIZE);
+		for (auto &chunk : partitions[partition_idx]->Chunks()) {
+			const auto lower_count =
+			    RadixPartitioning::Select(chunk.data.back(), FlatVector::IncrementalSelectionVector(), chunk.size(),
+			                              ht.radix_bits, cutoff, &lower_sel, &upper_sel);
+			if (lower_count > 0) {
+				split_chunk.Slice(chunk, lower_sel, lower_count);
+				lower_partition->Append(lower_append_state, split_chunk);
+			}
+			if (lower_count < chunk.size()) {
+				split_chunk.Slice(chunk, upper_sel, chunk.size() - lower_count);
+				upper_partition->Append(upper_append_state, split_chunk);
+			}
+		}
+		partitions[partition_idx] = std::move(lower_partition);
+		partitions[cutoff] = std::move(upper_partition);
+	}
+	partition_spans[partition_idx] = cutoff - partition_idx;
+	partition_spans[cutoff] = partition_idx + span - cutoff;
+}
+
 void ProbeSpill::PrepareNextProbe() {
+	if (global_partitions->GetRadixBits() != ht.radix_bits) {
+		// The HT recursively repartitioned a partition that did not fit in memory, we have to do the same
+		D_ASSERT(global_partitions->GetRadixBits() < ht.radix_bits);
+		Repartition();
+	}
+
 	auto &partitions = global_partitions->GetPartitions();
-	if (partitions.empty() || ht.partition_start == partitions.size()) {
+	if (!partitions.empty() && !partition_spans.empty()) {
+		// Split the partition that holds data of partitions in this round and of partitions after it
+		for (idx_t partition_idx = ht.partition_start; partition_idx < ht.partition_end;
+		     partition_idx += partition_spans[partition_idx]) {
+			if (partition_idx + partition_spans[partition_idx] > ht.partition_end) {
+				SplitPartition(partition_idx, ht.partition_end);
+			}
+		}
+	}
+
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	probes_slice_matches = ht.ProbesSliceMatches();
+	if (probes_slice_matches) {
+		// The partition is built in slices, the probe data carries the matches it found in the previous slices
+		D_ASSERT(ht.partition_end == ht.partition_start + 1);
+		if (next_slice_collection) {
+			global_spill_collection = std::move(next_slice_collection);
+		} else {
+			// This is the first slice, no matches were found yet
+			global_spill_collection = make_uniq<ColumnDataCollection>(buffer_manager, slice_types);
+			if (ht.partition_start < partitions.size() && partitions[ht.partition_start]) {
+				DataChunk slice_chunk;
+				slice_chunk.InitializeEmpty(slice_types);
+				Vector no_matches(Value::BOOLEAN(false));
+				ColumnDataAppendState append_state;
+				global_spill_collection->InitializeAppend(append_state);
+				for (auto &chunk : partitions[ht.partition_start]->Chunks()) {
+					for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+						slice_chunk.data[col_idx].Reference(chunk.data[col_idx]);
+					}
+					slice_chunk.data.back().Reference(no_matches);
+					slice_chunk.SetCardinality(chunk);
+					global_spill_collection->Append(append_state, slice_chunk);
+				}
+				partitions[ht.partition_start].reset();
+			}
+		}
+		if (ht.partition_slice_iterator) {
+			// The probe data is probed again with the next slice
+			next_slice_collection = make_uniq<ColumnDataCollection>(buffer_manager, slice_types);
+			next_slice_collection->InitializeAppend(next_slice_append_state);
+		}
+	} else if (partitions.empty() || ht.partition_start == partitions.size()) {
 		// Can't probe, just make an empty one
-		global_spill_collection =
-		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
+		global_spill_collection = make_uniq<ColumnDataCollection>(buffer_manager, probe_types);
+	} else if (ht.partition_slice_iterator) {
+		// The partition is built in slices, copy the probe data so that we can probe it again with the next slice
+		D_ASSERT(ht.partition_end == ht.partition_start + 1);
+		global_spill_collection = make_uniq<ColumnDataCollection>(buffer_manager, probe_types);
+		if (partitions[ht.partition_start]) {
+			ColumnDataAppendState append_state;
+			global_spill_collection->InitializeAppend(append_state);
+			for (auto &chunk : partitions[ht.partition_start]->Chunks()) {
+				global_spill_collection->Append(append_state, chunk);
+			}
+		}
 	} else {
 		// Move specific partitions to the global spill collection
-		global_spill_collection = std::move(partitions[ht.partition_start]);
-		for (idx_t i = ht.partition_start + 1; i < ht.partition_end; i++) {
+		global_spill_collection = make_uniq<ColumnDataCollection>(buffer_manager, probe_types);
+		for (idx_t i = ht.partition_start; i < ht.partition_end; i++) {
 			auto &partition = partitions[i];
+			if (!partition || partition->Count() == 0) {
+				continue;
+			}
 			if (global_spill_collection->Count() == 0) {
 				global_spill_collection = std::move(partition);
 			} else {
@@ -1118,8 +1477,25 @@ void ProbeSpill::PrepareNextProbe() {
 			}
 		}
 	}
-	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
+	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection,
+	                                         probes_slice_matches ? slice_column_ids : column_ids);
 	consumer->InitializeScan();
 }
 
+void ProbeSpill::AppendSliceMatches(DataChunk &chunk, const bool found_match[]) {
+	D_ASSERT(next_slice_collection && chunk.ColumnCount() == slice_types.size());
+	DataChunk slice_chunk;
+	slice_chunk.InitializeEmpty(slice_types);
+	for (idx_t col_idx = 0; col_idx < probe_types.size(); col_idx++) {
+		slice_chunk.data[col_idx].Reference(chunk.data[col_idx]);
+	}
+	Vector matches(LogicalType::BOOLEAN);
+	memcpy(FlatVector::GetData<bool>(matches), found_match, chunk.size() * sizeof(bool));
+	slice_chunk.data.back().Reference(matches);
+	slice_chunk.SetCardinality(chunk);
+
+	lock_guard<mutex> guard(lock);
+	next_slice_collection->Append(next_slice_append_state, slice_chunk);
+}
+
 } // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -32,6 +33,10 @@ bool HashAggregateGroupingData::HasDistinct() const {
 	return distinct_data != nullptr;
 }
 
+bool HashAggregateGroupingData::IsDerived() const {
+	return source_grouping.IsValid();
+}
+
 HashAggregateGroupingGlobalState::HashAggregateGroupingGlobalState(const HashAggregateGroupingData &data,
                                                                    ClientContext &context) {
 	table_state = data.table_data.GetGlobalSinkState(context);
@@ -103,6 +108,52 @@ bool PhysicalHashAggregate::CanSkipRegularSink() const {
 	return true;
 }
 
+bool PhysicalHashAggregate::CanDeriveGroupings() const {
+	if (grouping_sets.size() < 2) {
+		return false;
+	}
+	if (distinct_collection_info) {
+		// Distinct aggregates are only added to the grouping sets during Finalize
+		return false;
+	}
+	for (auto &aggregate : grouped_aggregate_data.aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (!aggr.function.combine) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void PhysicalHashAggregate::InitializeDerivedGroupings() {
+	// Visit the grouping sets from finest to coarsest, so every source is computed before the sets derived from it
+	vector<idx_t> order;
+	for (idx_t i = 0; i < grouping_sets.size(); i++) {
+		order.push_back(i);
+	}
+	std::stable_sort(order.begin(), order.end(),
+	                 [&](idx_t lhs, idx_t rhs) { return grouping_sets[lhs].size() > grouping_sets[rhs].size(); });
+
+	for (idx_t i = 0; i < order.size(); i++) {
+		auto &grouping_set = grouping_sets[order[i]];
+		optional_idx source;
+		for (idx_t j = 0; j < i; j++) {
+			auto &candidate = grouping_sets[order[j]];
+			if (!std::includes(candidate.begin(), candidate.end(), grouping_set.begin(), grouping_set.end())) {
+				continue;
+			}
+			// The smallest superset has the fewest groups to re-aggregate
+			if (!source.IsValid() || candidate.size() < grouping_sets[source.GetIndex()].size()) {
+				source = order[j];
+			}
+		}
+		if (source.IsValid()) {
+			groupings[order[i]].source_grouping = source;
+			derived_groupings.push_back(order[i]);
+		}
+	}
+}
+
 PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<LogicalType> types,
                                              vector<unique_ptr<Expression>> expressions, idx_t estimated_cardinality)
     : PhysicalHashAggregate(context, std::move(types), std::move(expressions), {}, estimated_cardinality) {
@@ -173,6 +224,9 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
 	for (idx_t i = 0; i < grouping_sets.size(); i++) {
 		groupings.emplace_back(grouping_sets[i], grouped_aggregate_data, distinct_collection_info);
 	}
+	if (CanDeriveGroupings()) {
+		InitializeDerivedGroupings();
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -386,13 +440,17 @@ SinkResultType PhysicalHashAggregate::Sink(ExecutionContext &context, DataChunk
 
 	// For every grouping set there is one radix_table
 	for (idx_t i = 0; i < groupings.size(); i++) {
+		auto &grouping = groupings[i];
+		if (grouping.IsDerived()) {
+			// Computed from the aggregate states of a finer grouping set in Combine
+			continue;
+		}
 		auto &grouping_global_state = global_state.grouping_states[i];
 		auto &grouping_local_state = local_state.grouping_states[i];
 		InterruptState interrupt_state;
 		OperatorSinkInput sink_input {*grouping_global_state.table_state, *grouping_local_state.table_state,
 		                              interrupt_state};
 
-		auto &grouping = groupings[i];
 		auto &table = grouping.table_data;
 		table.Sink(context, chunk, sink_input, aggregate_input_chunk, non_distinct_filter);
 	}
@@ -442,6 +500,16 @@ SinkCombineResultType PhysicalHashAggregate::Combine(ExecutionContext &context,
 	if (CanSkipRegularSink()) {
 		return SinkCombineResultType::FINISHED;
 	}
+	// Compute the derived grouping sets from this thread's aggregate states of their finer grouping sets
+	for (auto &grouping_idx : derived_groupings) {
+		auto &grouping = groupings[grouping_idx];
+		const auto source_idx = grouping.source_grouping.GetIndex();
+		InterruptState interrupt_state;
+		OperatorSinkInput sink_input {*gstate.grouping_states[grouping_idx].table_state,
+		                              *llstate.grouping_states[grouping_idx].table_state, interrupt_state};
+		grouping.table_data.SinkStates(context, groupings[source_idx].table_data,
+		                               *llstate.grouping_states[source_idx].table_state, sink_input);
+	}
 	for (idx_t i = 0; i < groupings.size(); i++) {
 		auto &grouping_gstate = gstate.grouping_states[i];
 		auto &grouping_lstate = llstate.grouping_states[i];
@@ -0,0 +1,569 @@
+#include "duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp"
+
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalSortAggregate::PhysicalSortAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> expressions,
+                                             vector<unique_ptr<Expression>> groups_p, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::SORT_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(expressions)), state_size(0) {
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		state_offsets.push_back(state_size);
+		state_size += AlignValue(aggr.function.state_size());
+	}
+}
+
+PhysicalSortAggregate::~PhysicalSortAggregate() {
+	// the sink state can hold aggregate states, which have to be destroyed while the aggregates still exist
+	sink_state.reset();
+}
+
+//===--------------------------------------------------------------------===//
+// Aggregate States
+//===--------------------------------------------------------------------===//
+void PhysicalSortAggregate::InitializeStates(data_ptr_t states) const {
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		aggr.function.initialize(states + state_offsets[aggr_idx]);
+	}
+}
+
+void PhysicalSortAggregate::FinalizeStates(data_ptr_t states[], idx_t count, ArenaAllocator &allocator,
+                                           DataChunk &result, idx_t offset) const {
+	Vector addresses(LogicalType::POINTER);
+	auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (idx_t i = 0; i < count; i++) {
+			address_data[i] = states[i] + state_offsets[aggr_idx];
+		}
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+		aggr.function.finalize(addresses, aggr_input_data, result.data[groups.size() + aggr_idx], count, offset);
+	}
+}
+
+void PhysicalSortAggregate::CombineStates(data_ptr_t source, data_ptr_t target, ArenaAllocator &allocator) const {
+	Vector source_address(LogicalType::POINTER);
+	Vector target_address(LogicalType::POINTER);
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		FlatVector::GetData<data_ptr_t>(source_address)[0] = source + state_offsets[aggr_idx];
+		FlatVector::GetData<data_ptr_t>(target_address)[0] = target + state_offsets[aggr_idx];
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator, AggregateCombineType::ALLOW_DESTRUCTIVE);
+		aggr.function.combine(source_address, target_address, aggr_input_data, 1);
+	}
+}
+
+void PhysicalSortAggregate::DestroyStates(data_ptr_t states[], idx_t count, ArenaAllocator &allocator) const {
+	Vector addresses(LogicalType::POINTER);
+	auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		if (!aggr.function.destructor) {
+			continue;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			address_data[i] = states[i] + state_offsets[aggr_idx];
+		}
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+		aggr.function.destructor(addresses, aggr_input_data, count);
+	}
+}
+
+//! A group that is not complete yet: it is continued by the next chunk, or it is the first or last group of a batch
+//! and may continue in the neighbouring batch
+struct SortAggregateGroup {
+	SortAggregateGroup(const PhysicalSortAggregate &op, DataChunk &chunk, idx_t row, data_ptr_t states,
+	                   shared_ptr<ArenaAllocator> arena)
+	    : op(op), states(states) {
+		for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+			key.push_back(chunk.GetValue(group_idx, row));
+		}
+		arenas.push_back(std::move(arena));
+	}
+	~SortAggregateGroup() {
+		if (states) {
+			op.DestroyStates(&states, 1, *arenas.back());
+		}
+	}
+
+	const PhysicalSortAggregate &op;
+	//! The values of the groups
+	vector<Value> key;
+	//! The aggregate states of the group
+	data_ptr_t states;
+	//! The arenas that hold the states and everything that the states allocated
+	vector<shared_ptr<ArenaAllocator>> arenas;
+
+public:
+	bool IsSameGroup(DataChunk &chunk, idx_t row) const {
+		for (idx_t group_idx = 0; group_idx < key.size(); group_idx++) {
+			if (!Value::NotDistinctFrom(key[group_idx], chunk.GetValue(group_idx, row))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool IsSameGroup(const SortAggregateGroup &other) const {
+		for (idx_t group_idx = 0; group_idx < key.size(); group_idx++) {
+			if (!Value::NotDistinctFrom(key[group_idx], other.key[group_idx])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! Combines the states of another part of the same group into this group, and destroys the other part
+	void Absorb(unique_ptr<SortAggregateGroup> other) {
+		op.CombineStates(other->states, states, *arenas.back());
+		// the combine may link memory of the other arenas into our states
+		for (auto &arena : other->arenas) {
+			arenas.push_back(arena);
+		}
+	}
+
+	//! Finalizes the group into a row of the collection
+	void Finalize(DataChunk &result, ColumnDataCollection &collection) {
+		result.Reset();
+		for (idx_t group_idx = 0; group_idx < key.size(); group_idx++) {
+			result.SetValue(group_idx, 0, key[group_idx]);
+		}
+		op.FinalizeStates(&states, 1, *arenas.back(), result, 0);
+		result.SetCardinality(1);
+		collection.Append(result);
+	}
+};
+
+//! The first and the last group of a batch. These are combined with the groups of the neighbouring batches, as a group
+//! can span multiple batches.
+struct SortAggregateBatch {
+	unique_ptr<SortAggregateGroup> first;
+	unique_ptr<SortAggregateGroup> last;
+};
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class SortAggregateGlobalSinkState : public GlobalSinkState {
+public:
+	SortAggregateGlobalSinkState(ClientContext &context, const PhysicalSortAggregate &op) : data(context, op.types) {
+	}
+
+	mutex lock;
+	//! The aggregated groups
+	ColumnDataCollection data;
+	//! The incomplete groups of every batch, ordered by batch index
+	map<idx_t, SortAggregateBatch> batches;
+};
+
+class SortAggregateLocalSinkState : public LocalSinkState {
+public:
+	SortAggregateLocalSinkState(ClientContext &context, const PhysicalSortAggregate &op)
+	    : op(op), allocator(BufferAllocator::Get(context)), child_executor(context), data(context, op.types),
+	      left_sel(STANDARD_VECTOR_SIZE), right_sel(STANDARD_VECTOR_SIZE), candidate_sel(STANDARD_VECTOR_SIZE),
+	      equal_sel(STANDARD_VECTOR_SIZE), distinct_sel(STANDARD_VECTOR_SIZE), group_starts(STANDARD_VECTOR_SIZE),
+	      group_states(STANDARD_VECTOR_SIZE), new_group(STANDARD_VECTOR_SIZE, false),
+	      addresses(LogicalType::POINTER) {
+		vector<LogicalType> payload_types;
+		vector<AggregateObject> aggregate_objects;
+		for (auto &aggregate : op.aggregates) {
+			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+			for (auto &child : aggr.children) {
+				payload_types.push_back(child->return_type);
+				child_executor.AddExpression(*child);
+			}
+			aggregate_objects.emplace_back(&aggr);
+		}
+		if (!payload_types.empty()) {
+			aggregate_input_chunk.Initialize(allocator, payload_types);
+		}
+		filter_set.Initialize(context, aggregate_objects, op.children[0]->types);
+		result.Initialize(allocator, op.types);
+
+		// row i is compared with row i + 1 to find the group boundaries
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+			left_sel.set_index(i, i);
+			right_sel.set_index(i, i + 1);
+		}
+	}
+
+	const PhysicalSortAggregate &op;
+	Allocator &allocator;
+	//! The executor of the aggregate children
+	ExpressionExecutor child_executor;
+	//! The payload chunk, containing all the Vectors for the aggregates
+	DataChunk aggregate_input_chunk;
+	//! Aggregate filter data set
+	AggregateFilterDataSet filter_set;
+	//! The chunk that groups are finalized into
+	DataChunk result;
+	//! The aggregated groups of this thread
+	ColumnDataCollection data;
+
+	//! The batch that is currently aggregated
+	optional_idx batch_index;
+	//! Whether the first group of the current batch is still open
+	bool in_first_group = true;
+	//! The last group of the previous chunk, which may be continued by the next chunk
+	unique_ptr<SortAggregateGroup> open_group;
+	//! The incomplete groups of the batches of this thread
+	map<idx_t, SortAggregateBatch> batches;
+
+	//! Selection vectors to find the group boundaries
+	SelectionVector left_sel;
+	SelectionVector right_sel;
+	SelectionVector candidate_sel;
+	SelectionVector equal_sel;
+	SelectionVector distinct_sel;
+	//! The first row of every group in the chunk
+	SelectionVector group_starts;
+	//! The aggregate states of every group in the chunk
+	unsafe_vector<data_ptr_t> group_states;
+	//! Whether a row starts a new group
+	unsafe_vector<bool> new_group;
+	//! The aggregate states of every row in the chunk
+	Vector addresses;
+
+public:
+	//! Finds the groups in a sorted chunk, returns the number of groups
+	idx_t FindGroups(DataChunk &chunk) {
+		const auto count = chunk.size();
+		group_starts.set_index(0, 0);
+		if (count == 1) {
+			return 1;
+		}
+		// compare every row with the next row, one group column at a time
+		const SelectionVector *candidates = nullptr;
+		idx_t candidate_count = count - 1;
+		auto equal = &equal_sel;
+		auto spare = &candidate_sel;
+		for (idx_t group_idx = 0; group_idx < op.groups.size() && candidate_count > 0; group_idx++) {
+			Vector left(chunk.data[group_idx], left_sel, count - 1);
+			Vector right(chunk.data[group_idx], right_sel, count - 1);
+			if (candidates) {
+				// the comparison reads the i-th row of the vectors for the i-th candidate
+				left.Slice(*candidates, candidate_count);
+				right.Slice(*candidates, candidate_count);
+			}
+			auto equal_count =
+			    VectorOperations::NotDistinctFrom(left, right, candidates, candidate_count, equal, &distinct_sel);
+			for (idx_t i = 0; i < candidate_count - equal_count; i++) {
+				new_group[distinct_sel.get_index(i) + 1] = true;
+			}
+			// only rows that are equal so far can still be in the same group
+			candidates = equal;
+			candidate_count = equal_count;
+			std::swap(equal, spare);
+		}
+		idx_t group_count = 1;
+		for (idx_t row = 1; row < count; row++) {
+			if (new_group[row]) {
+				new_group[row] = false;
+				group_starts.set_index(group_count++, row);
+			}
+		}
+		return group_count;
+	}
+
+	//! Updates the aggregate states of the groups in the chunk
+	void Update(DataChunk &chunk, idx_t group_count, ArenaAllocator &arena) {
+		const auto count = chunk.size();
+		aggregate_input_chunk.Reset();
+
+		idx_t payload_idx = 0;
+		idx_t next_payload_idx = 0;
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggregate = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+			payload_idx = next_payload_idx;
+			next_payload_idx = payload_idx + aggregate.children.size();
+
+			// point every row to the state of its group
+			auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+			for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+				const auto begin = group_starts.get_index(group_idx);
+				const auto end = group_idx + 1 < group_count ? group_starts.get_index(group_idx + 1) : count;
+				const auto state = group_states[group_idx] + op.state_offsets[aggr_idx];
+				for (idx_t row = begin; row < end; row++) {
+					address_data[row] = state;
+				}
+			}
+
+			// resolve the filter (if any)
+			idx_t payload_count;
+			Vector filtered_addresses(LogicalType::POINTER);
+			if (aggregate.filter) {
+				auto &filtered_data = filter_set.GetFilterData(aggr_idx);
+				payload_count = filtered_data.ApplyFilter(chunk);
+				child_executor.SetChunk(filtered_data.filtered_payload);
+				filtered_addresses.Slice(addresses, filtered_data.true_sel, payload_count);
+				filtered_addresses.Flatten(payload_count);
+			} else {
+				payload_count = count;
+				child_executor.SetChunk(chunk);
+				filtered_addresses.Reference(addresses);
+			}
+			if (payload_count == 0) {
+				continue;
+			}
+
+			// resolve the child expressions of the aggregate (if any)
+			aggregate_input_chunk.SetCardinality(payload_count);
+			for (idx_t i = 0; i < aggregate.children.size(); i++) {
+				child_executor.ExecuteExpression(payload_idx + i, aggregate_input_chunk.data[payload_idx + i]);
+			}
+
+			auto start_of_input = aggregate.children.empty() ? nullptr : &aggregate_input_chunk.data[payload_idx];
+			AggregateInputData aggr_input_data(aggregate.bind_info.get(), arena);
+			if (group_count == 1 && aggregate.function.simple_update) {
+				aggregate.function.simple_update(start_of_input, aggr_input_data, aggregate.children.size(),
+				                                 group_states[0] + op.state_offsets[aggr_idx], payload_count);
+			} else {
+				aggregate.function.update(start_of_input, aggr_input_data, aggregate.children.size(),
+				                          filtered_addresses, payload_count);
+			}
+		}
+	}
+
+	//! Finalizes the groups [begin, end) of the chunk
+	void FinalizeGroups(DataChunk &chunk, idx_t begin, idx_t end, ArenaAllocator &arena) {
+		if (begin >= end) {
+			return;
+		}
+		const auto finalize_count = end - begin;
+		result.Reset();
+		SelectionVector first_rows(group_starts.data() + begin);
+		for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+			result.data[group_idx].Slice(chunk.data[group_idx], first_rows, finalize_count);
+		}
+		op.FinalizeStates(group_states.data() + begin, finalize_count, arena, result, 0);
+		result.SetCardinality(finalize_count);
+		data.Append(result);
+		op.DestroyStates(group_states.data() + begin, finalize_count, arena);
+	}
+
+	//! Completes the open group, which is not continued by the next chunk
+	void CompleteOpenGroup(bool last_in_batch) {
+		D_ASSERT(open_group);
+		auto &batch = batches[batch_index.GetIndex()];
+		if (in_first_group) {
+			batch.first = std::move(open_group);
+			in_first_group = false;
+		} else if (last_in_batch) {
+			batch.last = std::move(open_group);
+		} else {
+			open_group->Finalize(result, data);
+			open_group.reset();
+		}
+	}
+
+	//! Aggregates a sorted chunk of the current batch
+	void Aggregate(DataChunk &chunk) {
+		const auto count = chunk.size();
+		if (count == 0) {
+			return;
+		}
+		const auto group_count = FindGroups(chunk);
+
+		const bool continues_open_group = open_group && open_group->IsSameGroup(chunk, 0);
+		if (open_group && !continues_open_group) {
+			CompleteOpenGroup(false);
+		}
+
+		// the states of the groups in this chunk, and everything that they allocate, live in a fresh arena
+		// the arena is released once the last of these groups is complete
+		auto arena = make_shared<ArenaAllocator>(allocator);
+		for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+			if (group_idx == 0 && continues_open_group) {
+				group_states[group_idx] = open_group->states;
+				open_group->arenas.push_back(arena);
+				continue;
+			}
+			group_states[group_idx] = arena->AllocateAligned(op.state_size);
+			op.InitializeStates(group_states[group_idx]);
+		}
+		Update(chunk, group_count, *arena);
+
+		if (group_count == 1) {
+			if (!continues_open_group) {
+				open_group = make_uniq<SortAggregateGroup>(op, chunk, 0, group_states[0], arena);
+			}
+			return;
+		}
+
+		// all groups but the last one are complete
+		idx_t finalize_begin = 0;
+		if (in_first_group) {
+			auto &batch = batches[batch_index.GetIndex()];
+			if (continues_open_group) {
+				batch.first = std::move(open_group);
+			} else {
+				batch.first = make_uniq<SortAggregateGroup>(op, chunk, 0, group_states[0], arena);
+			}
+			in_first_group = false;
+			finalize_begin = 1;
+		}
+		FinalizeGroups(chunk, finalize_begin, group_count - 1, *arena);
+		if (open_group) {
+			// the open group was finalized with the other groups of this chunk
+			open_group->states = nullptr;
+			open_group.reset();
+		}
+		const auto last_start = group_starts.get_index(group_count - 1);
+		open_group = make_uniq<SortAggregateGroup>(op, chunk, last_start, group_states[group_count - 1], arena);
+	}
+
+	//! Completes the current batch
+	void FinishBatch() {
+		if (open_group) {
+			CompleteOpenGroup(true);
+		}
+		in_first_group = true;
+	}
+};
+
+SinkResultType PhysicalSortAggregate::Sink(ExecutionContext &context, DataChunk &chunk,
+                                           OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<SortAggregateLocalSinkState>();
+	auto batch_index = lstate.partition_info.batch_index.GetIndex();
+	if (!lstate.batch_index.IsValid() || lstate.batch_index.GetIndex() != batch_index) {
+		// groups only continue within a batch, the groups at the batch boundaries are combined in the Finalize
+		if (lstate.batch_index.IsValid()) {
+			lstate.FinishBatch();
+		}
+		lstate.batch_index = batch_index;
+	}
+	lstate.Aggregate(chunk);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalSortAggregate::Combine(ExecutionContext &context,
+                                                     OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<SortAggregateGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<SortAggregateLocalSinkState>();
+	if (lstate.batch_index.IsValid()) {
+		lstate.FinishBatch();
+	}
+
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.data.Combine(lstate.data);
+	for (auto &entry : lstate.batches) {
+		gstate.batches[entry.first] = std::move(entry.second);
+	}
+	lstate.batches.clear();
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalSortAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                 OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<SortAggregateGlobalSinkState>();
+
+	// walk over the batches in order, and combine the parts of the groups that span multiple batches
+	DataChunk result;
+	result.Initialize(Allocator::Get(context), types);
+	unique_ptr<SortAggregateGroup> current;
+	for (auto &entry : gstate.batches) {
+		auto &batch = entry.second;
+		D_ASSERT(batch.first);
+		if (current && current->IsSameGroup(*batch.first)) {
+			current->Absorb(std::move(batch.first));
+		} else {
+			if (current) {
+				current->Finalize(result, gstate.data);
+			}
+			current = std::move(batch.first);
+		}
+		if (batch.last) {
+			current->Finalize(result, gstate.data);
+			current = std::move(batch.last);
+		}
+	}
+	if (current) {
+		current->Finalize(result, gstate.data);
+	}
+	gstate.batches.clear();
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<LocalSinkState> PhysicalSortAggregate::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<SortAggregateLocalSinkState>(context.client, *this);
+}
+
+unique_ptr<GlobalSinkState> PhysicalSortAggregate::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<SortAggregateGlobalSinkState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class SortAggregateGlobalSourceState : public GlobalSourceState {
+public:
+	explicit SortAggregateGlobalSourceState(ColumnDataCollection &data) : data(data) {
+		data.InitializeScan(scan_state);
+	}
+
+	ColumnDataCollection &data;
+	ColumnDataParallelScanState scan_state;
+
+public:
+	idx_t MaxThreads() override {
+		return MaxValue<idx_t>(data.ChunkCount(), 1);
+	}
+};
+
+class SortAggregateLocalSourceState : public LocalSourceState {
+public:
+	ColumnDataLocalScanState scan_state;
+};
+
+unique_ptr<GlobalSourceState> PhysicalSortAggregate::GetGlobalSourceState(ClientContext &context) const {
+	auto &gstate = sink_state->Cast<SortAggregateGlobalSinkState>();
+	return make_uniq<SortAggregateGlobalSourceState>(gstate.data);
+}
+
+unique_ptr<LocalSourceState> PhysicalSortAggregate::GetLocalSourceState(ExecutionContext &context,
+                                                                        GlobalSourceState &gstate) const {
+	return make_uniq<SortAggregateLocalSourceState>();
+}
+
+SourceResultType PhysicalSortAggregate::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                OperatorSourceInput &input) const {
+	auto &sink = sink_state->Cast<SortAggregateGlobalSinkState>();
+	auto &gstate = input.global_state.Cast<SortAggregateGlobalSourceState>();
+	auto &lstate = input.local_state.Cast<SortAggregateLocalSourceState>();
+	sink.data.Scan(gstate.scan_state, lstate.scan_state, chunk);
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalSortAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
@@ -13,6 +14,104 @@ PhysicalStreamingWindow::PhysicalStreamingWindow(vector<LogicalType> types, vect
     : PhysicalOperator(type, std::move(types), estimated_cardinality), select_list(std::move(select_list)) {
 }
 
+//! The widest bounded frame that is streamed; wider frames are better served by the segment tree of PhysicalWindow
+static constexpr const idx_t MAX_FRAME_WIDTH = 64;
+
+//! Frame bounds and LEAD/LAG offsets are limited to a vector of rows, which bounds the rows that need to be buffered
+static bool GetStreamingOffset(ClientContext &context, const Expression &expr, int64_t &offset) {
+	if (!expr.IsFoldable()) {
+		return false;
+	}
+	Value value;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, expr, value) || value.IsNull()) {
+		return false;
+	}
+	if (!value.TryCastAs(context, LogicalType::BIGINT)) {
+		return false;
+	}
+	offset = value.GetValue<int64_t>();
+	const auto limit = NumericCast<int64_t>(STANDARD_VECTOR_SIZE);
+	return offset >= -limit && offset <= limit;
+}
+
+//! Get the offset of a ROWS frame boundary relative to the current row
+static bool GetFrameOffset(ClientContext &context, WindowBoundary boundary, const unique_ptr<Expression> &expr,
+                           int64_t &offset) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		offset = 0;
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+		if (!GetStreamingOffset(context, *expr, offset) || offset < 0) {
+			return false;
+		}
+		offset = -offset;
+		return true;
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		return GetStreamingOffset(context, *expr, offset) && offset >= 0;
+	default:
+		return false;
+	}
+}
+
+//! Get the offset of the row that LEAD/LAG returns relative to the current row
+static bool GetLeadLagOffset(ClientContext &context, const BoundWindowExpression &wexpr, int64_t &offset) {
+	offset = 1;
+	if (wexpr.offset_expr && !GetStreamingOffset(context, *wexpr.offset_expr, offset)) {
+		return false;
+	}
+	if (wexpr.default_expr && !wexpr.default_expr->IsFoldable()) {
+		return false;
+	}
+	if (wexpr.GetExpressionType() == ExpressionType::WINDOW_LAG) {
+		offset = -offset;
+	}
+	return true;
+}
+
+bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr) {
+	auto &wexpr = expr->Cast<BoundWindowExpression>();
+	// Without a PARTITION BY, the ORDER BY can be established by sorting the input before streaming it
+	if (!wexpr.partitions.empty() || wexpr.ignore_nulls || wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	int64_t offset;
+	switch (wexpr.GetExpressionType()) {
+	case ExpressionType::WINDOW_AGGREGATE:
+		// We can stream aggregates over ROWS frames with constant bounds if they don't use filters
+		if (wexpr.filter_expr || wexpr.distinct) {
+			return false;
+		}
+		if (!GetFrameOffset(context, wexpr.end, wexpr.end_expr, offset)) {
+			return false;
+		}
+		if (wexpr.start != WindowBoundary::UNBOUNDED_PRECEDING) {
+			// Bounded frames are aggregated row by row, which only pays off for narrow frames
+			int64_t begin;
+			if (!GetFrameOffset(context, wexpr.start, wexpr.start_expr, begin) ||
+			    offset - begin >= NumericCast<int64_t>(MAX_FRAME_WIDTH)) {
+				return false;
+			}
+		}
+		return true;
+	case ExpressionType::WINDOW_FIRST_VALUE:
+		// The frame has to start at the first row, which is then constant
+		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING;
+	case ExpressionType::WINDOW_PERCENT_RANK:
+	case ExpressionType::WINDOW_RANK:
+	case ExpressionType::WINDOW_RANK_DENSE:
+		// Without an ORDER BY all rows are peers
+		return wexpr.orders.empty();
+	case ExpressionType::WINDOW_ROW_NUMBER:
+		return true;
+	case ExpressionType::WINDOW_LEAD:
+	case ExpressionType::WINDOW_LAG:
+		return GetLeadLagOffset(context, wexpr, offset);
+	default:
+		return false;
+	}
+}
+
 class StreamingWindowGlobalState : public GlobalOperatorState {
 public:
 	StreamingWindowGlobalState() : row_number(1) {
@@ -26,9 +125,13 @@ class StreamingWindowState : public OperatorState {
 public:
 	using StateBuffer = vector<data_t>;
 
+	//! The frame of a running aggregate starts at the first row
+	static constexpr const int64_t UNBOUNDED = NumericLimits<int64_t>::Minimum();
+
 	StreamingWindowState()
-	    : initialized(false), allocator(Allocator::DefaultAllocator()),
-	      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)) {
+	    : initialized(false), allocator(Allocator::DefaultAllocator()), frame_allocator(Allocator::DefaultAllocator()),
+	      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), max_preceding(0), max_following(0), row_start(0),
+	      history(0) {
 	}
 
 	~StreamingWindowState() override {
@@ -47,18 +150,32 @@ public:
 		aggregate_states.resize(expressions.size());
 		aggregate_bind_data.resize(expressions.size(), nullptr);
 		aggregate_dtors.resize(expressions.size(), nullptr);
+		aggregate_fed.resize(expressions.size(), 0);
+		frame_begin.resize(expressions.size(), 0);
+		frame_end.resize(expressions.size(), 0);
+		argument_offsets.resize(expressions.size(), 0);
 
+		argument_executor = make_uniq<ExpressionExecutor>(context);
+		auto row_types = input.GetTypes();
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
 			switch (expr.GetExpressionType()) {
 			case ExpressionType::WINDOW_AGGREGATE: {
 				auto &aggregate = *wexpr.aggregate;
-				auto &state = aggregate_states[expr_idx];
 				aggregate_bind_data[expr_idx] = wexpr.bind_info.get();
-				aggregate_dtors[expr_idx] = aggregate.destructor;
-				state.resize(aggregate.state_size());
-				aggregate.initialize(state.data());
+				if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+					// Running aggregates keep a single state that is updated with every row
+					auto &state = aggregate_states[expr_idx];
+					aggregate_dtors[expr_idx] = aggregate.destructor;
+					state.resize(aggregate.state_size());
+					aggregate.initialize(state.data());
+					frame_begin[expr_idx] = UNBOUNDED;
+				} else {
+					GetFrameOffset(context, wexpr.start, wexpr.start_expr, frame_begin[expr_idx]);
+				}
+				GetFrameOffset(context, wexpr.end, wexpr.end_expr, frame_end[expr_idx]);
+				AddArguments(wexpr.children, row_types, expr_idx);
 				break;
 			}
 			case ExpressionType::WINDOW_FIRST_VALUE: {
@@ -81,24 +198,108 @@ public:
 				const_vectors[expr_idx] = make_uniq<Vector>(Value((int64_t)1));
 				break;
 			}
+			case ExpressionType::WINDOW_LEAD:
+			case ExpressionType::WINDOW_LAG: {
+				// The frame of LEAD/LAG is the single row at the offset
+				int64_t offset;
+				GetLeadLagOffset(context, wexpr, offset);
+				frame_begin[expr_idx] = frame_end[expr_idx] = offset;
+				Value default_value(wexpr.return_type);
+				if (wexpr.default_expr) {
+					default_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.default_expr)
+					                    .DefaultCastAs(wexpr.return_type);
+				}
+				const_vectors[expr_idx] = make_uniq<Vector>(default_value);
+				AddArguments(wexpr.children, row_types, expr_idx);
+				break;
+			}
 			default:
 				break;
 			}
 		}
+
+		// The rows that the frames reach around the current row have to be buffered
+		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
+			if (frame_begin[expr_idx] != UNBOUNDED) {
+				max_preceding =
+				    MaxValue<idx_t>(max_preceding, NumericCast<idx_t>(MaxValue<int64_t>(-frame_begin[expr_idx], 0)));
+				max_following =
+				    MaxValue<idx_t>(max_following, NumericCast<idx_t>(MaxValue<int64_t>(frame_begin[expr_idx], 0)));
+			}
+			max_preceding =
+			    MaxValue<idx_t>(max_preceding, NumericCast<idx_t>(MaxValue<int64_t>(-frame_end[expr_idx], 0)));
+			max_following =
+			    MaxValue<idx_t>(max_following, NumericCast<idx_t>(MaxValue<int64_t>(frame_end[expr_idx], 0)));
+		}
+
+		auto &allocator = Allocator::Get(context);
+		if (!argument_types.empty()) {
+			arguments.Initialize(allocator, argument_types);
+			frame_arguments.InitializeEmpty(argument_types);
+		}
+		row_types.insert(row_types.end(), argument_types.begin(), argument_types.end());
+		rows.InitializeEmpty(row_types);
+		if (IsDelayed()) {
+			delayed.Initialize(allocator, row_types);
+			shifted.Initialize(allocator, row_types);
+		}
 		initialized = true;
 	}
 
+	void AddArguments(const vector<unique_ptr<Expression>> &children, const vector<LogicalType> &input_types,
+	                  idx_t expr_idx) {
+		argument_offsets[expr_idx] = input_types.size() + argument_types.size();
+		for (auto &child : children) {
+			argument_types.push_back(child->return_type);
+			argument_executor->AddExpression(*child);
+		}
+	}
+
+	//! Whether rows have to be buffered before (or after) they are output
+	bool IsDelayed() const {
+		return max_preceding > 0 || max_following > 0;
+	}
+
 public:
 	bool initialized;
 	vector<unique_ptr<Vector>> const_vectors;
 	ArenaAllocator allocator;
+	//! The allocator of the aggregate states of bounded frames, which only live for a single chunk
+	ArenaAllocator frame_allocator;
 
 	// Aggregation
 	vector<StateBuffer> aggregate_states;
 	vector<FunctionData *> aggregate_bind_data;
 	vector<aggregate_destructor_t> aggregate_dtors;
+	//! The number of rows that have been added to the running aggregate states
+	vector<int64_t> aggregate_fed;
 	data_ptr_t state_ptr;
 	Vector statev;
+	//! The states of the frames of a chunk of bounded frame aggregates
+	StateBuffer frame_states;
+	DataChunk frame_arguments;
+
+	//! The (inclusive) frame offsets of each function relative to the current row
+	vector<int64_t> frame_begin;
+	vector<int64_t> frame_end;
+	//! The maximum number of rows before and after the current row that a frame reaches
+	idx_t max_preceding;
+	idx_t max_following;
+
+	//! The arguments of the functions, which are evaluated once for every input row
+	unique_ptr<ExpressionExecutor> argument_executor;
+	vector<LogicalType> argument_types;
+	vector<idx_t> argument_offsets;
+	DataChunk arguments;
+	//! The input rows with their function arguments
+	DataChunk rows;
+	//! The row number (0-based) of the first row in the rows that are evaluated
+	int64_t row_start;
+	//! The buffered rows: the preceding rows of the next row to output, followed by the rows that have not been output
+	DataChunk delayed;
+	DataChunk shifted;
+	//! The number of preceding rows at the start of the delayed rows
+	idx_t history;
 };
 
 unique_ptr<GlobalOperatorState> PhysicalStreamingWindow::GetGlobalOperatorState(ClientContext &context) const {
@@ -109,73 +310,195 @@ unique_ptr<OperatorState> PhysicalStreamingWindow::GetOperatorState(ExecutionCon
 	return make_uniq<StreamingWindowState>();
 }
 
-OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
-                                                    GlobalOperatorState &gstate_p, OperatorState &state_p) const {
-	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
-	auto &state = state_p.Cast<StreamingWindowState>();
+bool PhysicalStreamingWindow::RequiresFinalExecute() const {
+	for (auto &expr : select_list) {
+		auto &wexpr = expr->Cast<BoundWindowExpression>();
+		switch (wexpr.GetExpressionType()) {
+		case ExpressionType::WINDOW_LEAD:
+		case ExpressionType::WINDOW_LAG:
+			// Negative LAG offsets look at following rows as well
+			return true;
+		case ExpressionType::WINDOW_AGGREGATE:
+			if (wexpr.start == WindowBoundary::EXPR_FOLLOWING_ROWS ||
+			    wexpr.end == WindowBoundary::EXPR_FOLLOWING_ROWS) {
+				return true;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	return false;
+}
 
-	if (!state.initialized) {
-		state.Initialize(context.client, input, select_list);
+static void ExecuteRunningAggregate(ExecutionContext &context, BoundWindowExpression &wexpr,
+                                    StreamingWindowState &state, idx_t expr_idx, DataChunk &rows, idx_t begin,
+                                    idx_t count, Vector &result) {
+	auto &aggregate = *wexpr.aggregate;
+	auto &statev = state.statev;
+	state.state_ptr = state.aggregate_states[expr_idx].data();
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), state.allocator);
+
+	// The running state contains all rows before the end of the frame
+	auto &fed = state.aggregate_fed[expr_idx];
+	const auto frame_end = state.frame_end[expr_idx] + 1;
+	const auto row_end = state.row_start + NumericCast<int64_t>(rows.size());
+	const auto first_row = state.row_start + NumericCast<int64_t>(begin);
+
+	// Check for COUNT(*)
+	if (wexpr.children.empty()) {
+		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
+		auto data = FlatVector::GetData<int64_t>(result);
+		for (idx_t i = 0; i < count; ++i) {
+			const auto row_idx = first_row + NumericCast<int64_t>(i);
+			data[i] = MaxValue<int64_t>(MinValue<int64_t>(row_idx + frame_end, row_end), 0);
+		}
+		return;
 	}
-	// Put payload columns in place
-	for (idx_t col_idx = 0; col_idx < input.data.size(); col_idx++) {
-		chunk.data[col_idx].Reference(input.data[col_idx]);
+
+	// Iterate through the arguments using a single SV
+	auto &allocator = Allocator::Get(context.client);
+	vector<LogicalType> payload_types;
+	for (auto &child : wexpr.children) {
+		payload_types.push_back(child->return_type);
+	}
+	DataChunk row;
+	row.Initialize(allocator, payload_types);
+	sel_t s = 0;
+	SelectionVector sel(&s);
+	row.Slice(sel, 1);
+	for (size_t col_idx = 0; col_idx < row.ColumnCount(); ++col_idx) {
+		DictionaryVector::Child(row.data[col_idx]).Reference(rows.data[state.argument_offsets[expr_idx] + col_idx]);
+	}
+
+	// Update the state and finalize it one row at a time.
+	for (idx_t i = 0; i < count; ++i) {
+		const auto row_idx = first_row + NumericCast<int64_t>(i);
+		for (const auto fed_end = MinValue<int64_t>(row_idx + frame_end, row_end); fed < fed_end; ++fed) {
+			D_ASSERT(fed >= state.row_start);
+			sel.set_index(0, NumericCast<idx_t>(fed - state.row_start));
+			aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), statev, 1);
+		}
+		aggregate.finalize(statev, aggr_input_data, result, 1, i);
 	}
+}
+
+static void ExecuteFrameAggregate(BoundWindowExpression &wexpr, StreamingWindowState &state, idx_t expr_idx,
+                                  DataChunk &rows, idx_t begin, idx_t count, Vector &result) {
+	const auto frame_begin = state.frame_begin[expr_idx];
+	const auto frame_end = state.frame_end[expr_idx];
+	const auto row_count = NumericCast<int64_t>(rows.size());
+
+	// Check for COUNT(*)
+	if (wexpr.children.empty()) {
+		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
+		auto data = FlatVector::GetData<int64_t>(result);
+		for (idx_t i = 0; i < count; ++i) {
+			const auto row_idx = NumericCast<int64_t>(begin + i);
+			const auto lo = MaxValue<int64_t>(row_idx + frame_begin, 0);
+			const auto hi = MinValue<int64_t>(row_idx + frame_end + 1, row_count);
+			data[i] = MaxValue<int64_t>(hi - lo, 0);
+		}
+		return;
+	}
+
+	// Initialize a state for every frame
+	auto &aggregate = *wexpr.aggregate;
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), state.frame_allocator);
+	const auto state_size = AlignValue(aggregate.state_size());
+	state.frame_states.resize(state_size * count);
+	Vector statesv(LogicalType::POINTER, count);
+	auto states = FlatVector::GetData<data_ptr_t>(statesv);
+	for (idx_t i = 0; i < count; ++i) {
+		states[i] = state.frame_states.data() + i * state_size;
+		aggregate.initialize(states[i]);
+	}
+
+	// Update the frames with the rows at each offset in a single vectorised update
+	auto &frame_arguments = state.frame_arguments;
+	const auto argument_offset = state.argument_offsets[expr_idx];
+	const auto argument_count = wexpr.children.size();
+	auto arguments =
+	    frame_arguments.data.data() + argument_offset - (rows.ColumnCount() - frame_arguments.ColumnCount());
+	SelectionVector sel(count);
+	Vector framev(LogicalType::POINTER, count);
+	auto frames = FlatVector::GetData<data_ptr_t>(framev);
+	for (auto offset = frame_begin; offset <= frame_end; ++offset) {
+		idx_t frame_count = 0;
+		for (idx_t i = 0; i < count; ++i) {
+			const auto row_idx = NumericCast<int64_t>(begin + i) + offset;
+			if (row_idx < 0 || row_idx >= row_count) {
+				continue;
+			}
+			sel.set_index(frame_count, NumericCast<idx_t>(row_idx));
+			frames[frame_count++] = states[i];
+		}
+		if (!frame_count) {
+			continue;
+		}
+		for (idx_t col_idx = 0; col_idx < argument_count; ++col_idx) {
+			arguments[col_idx].Slice(rows.data[argument_offset + col_idx], sel, frame_count);
+		}
+		aggregate.update(arguments, aggr_input_data, argument_count, framev, frame_count);
+	}
+
+	aggregate.finalize(statesv, aggr_input_data, result, count, 0);
+	if (aggregate.destructor) {
+		aggregate.destructor(statesv, aggr_input_data, count);
+	}
+	state.frame_allocator.Reset();
+}
+
+static void ExecuteLeadLag(StreamingWindowState &state, idx_t expr_idx, DataChunk &rows, idx_t begin, idx_t count,
+                           Vector &result) {
+	const auto offset = state.frame_begin[expr_idx];
+	const auto row_count = NumericCast<int64_t>(rows.size());
+	auto &source = rows.data[state.argument_offsets[expr_idx]];
+
+	// Copy the shifted values, and fill in the default where the offset lies outside of the rows
+	SelectionVector sel(count);
+	bool has_default = false;
+	for (idx_t i = 0; i < count; ++i) {
+		const auto row_idx = NumericCast<int64_t>(begin + i) + offset;
+		if (row_idx < 0 || row_idx >= row_count) {
+			sel.set_index(i, begin + i);
+			has_default = true;
+		} else {
+			sel.set_index(i, NumericCast<idx_t>(row_idx));
+		}
+	}
+	VectorOperations::Copy(source, result, sel, count, 0, 0);
+	if (!has_default) {
+		return;
+	}
+	const auto default_value = state.const_vectors[expr_idx]->GetValue(0);
+	for (idx_t i = 0; i < count; ++i) {
+		const auto row_idx = NumericCast<int64_t>(begin + i) + offset;
+		if (row_idx < 0 || row_idx >= row_count) {
+			result.SetValue(i, default_value);
+		}
+	}
+}
+
+void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataChunk &chunk, DataChunk &rows,
+                                               idx_t begin, idx_t count, GlobalOperatorState &gstate_p,
+                                               OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
+	auto &state = state_p.Cast<StreamingWindowState>();
+
 	// Compute window function
-	const idx_t count = input.size();
+	const auto input_width = chunk.ColumnCount() - select_list.size();
 	for (idx_t expr_idx = 0; expr_idx < select_list.size(); expr_idx++) {
-		idx_t col_idx = input.data.size() + expr_idx;
+		idx_t col_idx = input_width + expr_idx;
 		auto &expr = *select_list[expr_idx];
 		auto &result = chunk.data[col_idx];
 		switch (expr.GetExpressionType()) {
 		case ExpressionType::WINDOW_AGGREGATE: {
-			//	Establish the aggregation environment
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
-			auto &aggregate = *wexpr.aggregate;
-			auto &statev = state.statev;
-			state.state_ptr = state.aggregate_states[expr_idx].data();
-			AggregateInputData aggr_input_data(wexpr.bind_info.get(), state.allocator);
-
-			// Check for COUNT(*)
-			if (wexpr.children.empty()) {
-				D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
-				auto data = FlatVector::GetData<int64_t>(result);
-				int64_t start_row = gstate.row_number;
-				for (idx_t i = 0; i < input.size(); ++i) {
-					data[i] = start_row + i;
-				}
-				break;
-			}
-
-			// Compute the arguments
-			auto &allocator = Allocator::Get(context.client);
-			ExpressionExecutor executor(context.client);
-			vector<LogicalType> payload_types;
-			for (auto &child : wexpr.children) {
-				payload_types.push_back(child->return_type);
-				executor.AddExpression(*child);
-			}
-
-			DataChunk payload;
-			payload.Initialize(allocator, payload_types);
-			executor.Execute(input, payload);
-
-			// Iterate through them using a single SV
-			payload.Flatten();
-			DataChunk row;
-			row.Initialize(allocator, payload_types);
-			sel_t s = 0;
-			SelectionVector sel(&s);
-			row.Slice(sel, 1);
-			for (size_t col_idx = 0; col_idx < payload.ColumnCount(); ++col_idx) {
-				DictionaryVector::Child(row.data[col_idx]).Reference(payload.data[col_idx]);
-			}
-
-			// Update the state and finalize it one row at a time.
-			for (idx_t i = 0; i < input.size(); ++i) {
-				sel.set_index(0, i);
-				aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), statev, 1);
-				aggregate.finalize(statev, aggr_input_data, result, 1, i);
+			if (state.frame_begin[expr_idx] == StreamingWindowState::UNBOUNDED) {
+				ExecuteRunningAggregate(context, wexpr, state, expr_idx, rows, begin, count, result);
+			} else {
+				ExecuteFrameAggregate(wexpr, state, expr_idx, rows, begin, count, result);
 			}
 			break;
 		}
@@ -196,15 +519,105 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			}
 			break;
 		}
+		case ExpressionType::WINDOW_LEAD:
+		case ExpressionType::WINDOW_LAG:
+			ExecuteLeadLag(state, expr_idx, rows, begin, count, result);
+			break;
 		default:
 			throw NotImplementedException("%s for StreamingWindow", ExpressionTypeToString(expr.GetExpressionType()));
 		}
 	}
 	gstate.row_number += count;
 	chunk.SetCardinality(count);
+}
+
+void PhysicalStreamingWindow::ExecuteDelayed(ExecutionContext &context, DataChunk &chunk, idx_t count,
+                                             GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingWindowState>();
+	auto &delayed = state.delayed;
+	if (!count) {
+		return;
+	}
+
+	// Put payload columns in place
+	const auto begin = state.history;
+	const auto input_width = chunk.ColumnCount() - select_list.size();
+	for (idx_t col_idx = 0; col_idx < input_width; col_idx++) {
+		VectorOperations::Copy(delayed.data[col_idx], chunk.data[col_idx], begin + count, begin, 0);
+	}
+	ExecuteFunctions(context, chunk, delayed, begin, count, gstate, state);
+
+	// Only keep the preceding rows of the next row and the rows that have not been output
+	const auto next = begin + count;
+	const auto keep_begin = next - MinValue(next, state.max_preceding);
+	if (keep_begin > 0) {
+		const auto keep_count = delayed.size() - keep_begin;
+		SelectionVector sel(keep_count);
+		for (idx_t i = 0; i < keep_count; ++i) {
+			sel.set_index(i, keep_begin + i);
+		}
+		auto &shifted = state.shifted;
+		shifted.Reset();
+		shifted.Append(delayed, true, &sel, keep_count);
+		delayed.Reset();
+		delayed.Append(shifted, true);
+	}
+	state.history = next - keep_begin;
+	state.row_start += NumericCast<int64_t>(keep_begin);
+}
+
+OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                    GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingWindowState>();
+
+	if (!state.initialized) {
+		state.Initialize(context.client, input, select_list);
+	}
+
+	// Evaluate the function arguments alongside the input rows
+	auto &rows = state.rows;
+	for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
+		rows.data[col_idx].Reference(input.data[col_idx]);
+	}
+	if (!state.argument_types.empty()) {
+		state.arguments.Reset();
+		state.argument_executor->Execute(input, state.arguments);
+		state.arguments.Flatten();
+		for (idx_t col_idx = 0; col_idx < state.arguments.ColumnCount(); col_idx++) {
+			rows.data[input.ColumnCount() + col_idx].Reference(state.arguments.data[col_idx]);
+		}
+	}
+	rows.SetCardinality(input);
+
+	if (state.IsDelayed()) {
+		// Output the rows whose following rows have all been seen
+		state.delayed.Append(rows, true);
+		const auto pending = state.delayed.size() - state.history;
+		const auto count = pending > state.max_following ? pending - state.max_following : 0;
+		ExecuteDelayed(context, chunk, count, gstate, state);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// Put payload columns in place
+	for (idx_t col_idx = 0; col_idx < input.data.size(); col_idx++) {
+		chunk.data[col_idx].Reference(input.data[col_idx]);
+	}
+	ExecuteFunctions(context, chunk, rows, 0, input.size(), gstate, state);
+	state.row_start += NumericCast<int64_t>(input.size());
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
+OperatorFinalizeResultType PhysicalStreamingWindow::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                 GlobalOperatorState &gstate,
+                                                                 OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingWindowState>();
+	if (state.initialized && state.IsDelayed()) {
+		// The remaining rows are at the end of the input, so their frames are complete
+		ExecuteDelayed(context, chunk, state.delayed.size() - state.history, gstate, state);
+	}
+	return OperatorFinalizeResultType::FINISHED;
+}
+
 string PhysicalStreamingWindow::ParamsToString() const {
 	string result;
 	for (idx_t i = 0; i < select_list.size(); i++) {
@@ -259,13 +259,16 @@ public:
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
 
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0), ready(false),
+	      builders(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
 	unique_ptr<RowDataCollectionScanner> GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	//! Build the executors' data structures, together with any other threads that call this
+	void Build();
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -292,6 +295,10 @@ public:
 	mutable atomic<idx_t> read_block_idx;
 	//! The number of remaining unscanned blocks.
 	atomic<idx_t> unscanned;
+	//! Whether the executors have been built, so the partition can be scanned
+	atomic<bool> ready;
+	//! The number of threads that are building the partition (protected by the built_lock)
+	idx_t builders;
 };
 
 void WindowPartitionSourceState::MaterializeSortedData() {
@@ -334,6 +341,9 @@ void WindowPartitionSourceState::MaterializeSortedData() {
 }
 
 unique_ptr<RowDataCollectionScanner> WindowPartitionSourceState::GetScanner() const {
+	if (!ready) {
+		return nullptr;
+	}
 	auto &gsink = *gsource.gsink.global_partition;
 	if ((gsink.rows && !hash_bin) || hash_bin < gsink.hash_groups.size()) {
 		const auto block_idx = read_block_idx++;
@@ -435,7 +445,6 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
 	for (auto &wexec : executors) {
 		wexec->Finalize();
 	}
@@ -447,6 +456,15 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 	unscanned = rows->blocks.size();
 }
 
+void WindowPartitionSourceState::Build() {
+	//	Each executor returns once it has been completely built,
+	//	so whichever thread gets here first can release the partition for scanning.
+	for (auto &wexec : executors) {
+		wexec->Build();
+	}
+	ready = true;
+}
+
 // Per-thread scan state
 class WindowLocalSourceState : public LocalSourceState {
 public:
@@ -493,30 +511,47 @@ WindowLocalSourceState::WindowLocalSourceState(WindowGlobalSourceState &gsource)
 }
 
 WindowGlobalSourceState::Task WindowGlobalSourceState::CreateTask(idx_t hash_bin) {
-	//	Build outside the lock so no one tries to steal before we are done.
+	//	Sink the partition outside the lock so no one tries to steal before we are done.
 	auto partition_source = make_uniq<WindowPartitionSourceState>(context, *this);
 	partition_source->BuildPartition(gsink, hash_bin);
-	Task result(partition_source.get(), partition_source->GetScanner());
 
 	//	Is there any data to scan?
-	if (result.second) {
+	if (!partition_source->unscanned) {
+		return Task();
+	}
+
+	//	Publish the partition so threads looking for work can help to build it
+	auto &source = *partition_source;
+	{
 		lock_guard<mutex> built_guard(built_lock);
 		built[hash_bin] = std::move(partition_source);
-
-		return result;
+		++source.builders;
 	}
+	source.Build();
 
-	return Task();
+	lock_guard<mutex> built_guard(built_lock);
+	--source.builders;
+	return Task(&source, source.GetScanner());
 }
 
 WindowGlobalSourceState::Task WindowGlobalSourceState::StealWork() {
 	for (idx_t hash_bin = 0; hash_bin < built.size(); ++hash_bin) {
-		lock_guard<mutex> built_guard(built_lock);
+		unique_lock<mutex> built_guard(built_lock);
 		auto &partition_source = built[hash_bin];
 		if (!partition_source) {
 			continue;
 		}
 
+		//	Help to build a partition that is not ready for scanning yet
+		if (!partition_source->ready) {
+			auto &source = *partition_source;
+			++source.builders;
+			built_guard.unlock();
+			source.Build();
+			built_guard.lock();
+			--source.builders;
+		}
+
 		Task result(partition_source.get(), partition_source->GetScanner());
 
 		//	Is there any data to scan?
@@ -544,7 +579,7 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 		HashGroupSourcePtr killed;
 		lock_guard<mutex> built_guard(built_lock);
 		auto &partition_source = built[hash_bin];
-		if (partition_source && !partition_source->unscanned) {
+		if (partition_source && !partition_source->unscanned && !partition_source->builders) {
 			killed = std::move(partition_source);
 		}
 	}
@@ -19,6 +19,7 @@ void PhysicalSet::SetExtensionVariable(ClientContext &context, ExtensionOption &
 	} else {
 		auto &client_config = ClientConfig::GetConfig(context);
 		client_config.set_variables[name] = std::move(target_value);
+		client_config.local_settings_modified = true;
 	}
 }
 
@@ -64,6 +65,7 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 			throw CatalogException("option \"%s\" cannot be set locally", name);
 		}
 		option->set_local(context.client, input_val);
+		ClientConfig::GetConfig(context.client).local_settings_modified = true;
 		break;
 	default:
 		throw InternalException("Unsupported SetScope for variable");
@@ -0,0 +1,220 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+bool JoinFilterPushdownInfo::CanPushFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	case LogicalTypeId::VARCHAR:
+		// collated strings are compared through an expression, so they are never a plain column reference
+		return StringType::GetCollation(type).empty();
+	default:
+		return false;
+	}
+}
+
+void JoinFilterPushdownInfo::InitializeState(JoinFilterLocalState &state, const vector<LogicalType> &condition_types,
+                                             idx_t build_cardinality) const {
+	// bloom filters are only worth building if the build side is small enough to make them selective
+	const auto bloom_filter_threshold =
+	    BloomFilter::MAXIMUM_BLOCK_COUNT * 64 / BloomFilter::MINIMUM_BITS_PER_VALUE;
+	for (auto &cond_idx : join_condition) {
+		auto &type = condition_types[cond_idx];
+		state.min.emplace_back(type);
+		state.max.emplace_back(type);
+		if (build_cardinality <= bloom_filter_threshold) {
+			state.bloom_filters.push_back(BloomFilter::Create(build_cardinality));
+		} else {
+			state.bloom_filters.push_back(nullptr);
+		}
+	}
+}
+
+unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(const vector<LogicalType> &condition_types,
+                                                                         idx_t build_cardinality) const {
+	auto result = make_uniq<JoinFilterGlobalState>();
+	InitializeState(*result, condition_types, build_cardinality);
+	return result;
+}
+
+unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(const vector<LogicalType> &condition_types,
+                                                                       idx_t build_cardinality) const {
+	auto result = make_uniq<JoinFilterLocalState>();
+	InitializeState(*result, condition_types, build_cardinality);
+	return result;
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(Vector &input, idx_t count, Value &min_value, Value &max_value) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	bool has_value = false;
+	T min = T();
+	T max = T();
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (!has_value) {
+			min = data[idx];
+			max = data[idx];
+			has_value = true;
+			continue;
+		}
+		if (LessThan::Operation(data[idx], min)) {
+			min = data[idx];
+		}
+		if (GreaterThan::Operation(data[idx], max)) {
+			max = data[idx];
+		}
+	}
+	if (!has_value) {
+		return;
+	}
+	auto chunk_min = Value::CreateValue<T>(min);
+	chunk_min.Reinterpret(input.GetType());
+	if (min_value.IsNull() || chunk_min < min_value) {
+		min_value = std::move(chunk_min);
+	}
+	auto chunk_max = Value::CreateValue<T>(max);
+	chunk_max.Reinterpret(input.GetType());
+	if (max_value.IsNull() || chunk_max > max_value) {
+		max_value = std::move(chunk_max);
+	}
+}
+
+static void UpdateMinMax(Vector &input, idx_t count, Value &min_value, Value &max_value) {
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateMinMax<int8_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateMinMax<int16_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateMinMax<int32_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateMinMax<int64_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateMinMax<hugeint_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateMinMax<uint8_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateMinMax<uint16_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateMinMax<uint32_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateMinMax<uint64_t>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedUpdateMinMax<float>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedUpdateMinMax<double>(input, count, min_value, max_value);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedUpdateMinMax<string_t>(input, count, min_value, max_value);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
+static void MergeMinMax(const Value &min_value, const Value &max_value, Value &target_min, Value &target_max) {
+	if (!min_value.IsNull() && (target_min.IsNull() || min_value < target_min)) {
+		target_min = min_value;
+	}
+	if (!max_value.IsNull() && (target_max.IsNull() || max_value > target_max)) {
+		target_max = max_value;
+	}
+}
+
+void JoinFilterPushdownInfo::Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const {
+	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
+		auto &keys = join_keys.data[join_condition[filter_idx]];
+		UpdateMinMax(keys, join_keys.size(), lstate.min[filter_idx], lstate.max[filter_idx]);
+		if (lstate.bloom_filters[filter_idx]) {
+			lstate.bloom_filters[filter_idx]->Insert(keys, join_keys.size());
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
+	lock_guard<mutex> guard(gstate.lock);
+	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
+		MergeMinMax(lstate.min[filter_idx], lstate.max[filter_idx], gstate.min[filter_idx], gstate.max[filter_idx]);
+		if (gstate.bloom_filters[filter_idx]) {
+			gstate.bloom_filters[filter_idx]->Merge(*lstate.bloom_filters[filter_idx]);
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(const PhysicalOperator &op, JoinFilterGlobalState &gstate,
+                                         idx_t build_count) const {
+	for (auto &info : probe_info) {
+		// clear any filters we pushed in a previous execution (e.g., in a recursive CTE)
+		info.dynamic_filters->ClearFilters(op);
+		for (auto &column : info.columns) {
+			auto filter_idx = column.filter_idx;
+			auto column_index = column.probe_column_index;
+			auto &min_value = gstate.min[filter_idx];
+			auto &max_value = gstate.max[filter_idx];
+			if (min_value.IsNull() || max_value.IsNull()) {
+				// no non-NULL values on the build side
+				continue;
+			}
+			if (min_value == max_value) {
+				// single value: push an equality filter
+				info.dynamic_filters->PushFilter(op, column_index,
+				                                 make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, min_value));
+			} else {
+				// push the min/max range, which can be used to prune row groups through their zonemaps
+				info.dynamic_filters->PushFilter(
+				    op, column_index,
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, min_value));
+				info.dynamic_filters->PushFilter(
+				    op, column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, max_value));
+				// the bloom filter removes the rows that fall within the range but have no match on the build side
+				auto &bloom_filter = gstate.bloom_filters[filter_idx];
+				if (bloom_filter && bloom_filter->IsSelective(build_count)) {
+					info.dynamic_filters->PushFilter(op, column_index, bloom_filter->Copy());
+				}
+			}
+		}
+	}
+}
+
+} // namespace duckdb
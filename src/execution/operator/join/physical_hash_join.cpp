@@ -103,6 +103,11 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			global_filter_state =
+			    op.filter_pushdown->GetGlobalState(op.condition_types, op.children[1]->estimated_cardinality);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -136,6 +141,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! The join filters that are collected from the build side (if any)
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +163,11 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			local_filter_state =
+			    op.filter_pushdown->GetLocalState(op.condition_types, op.children[1]->estimated_cardinality);
+		}
 	}
 
 public:
@@ -168,6 +181,9 @@ public:
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
 
+	//! The join filters that are collected from the build side by this thread (if any)
+	unique_ptr<JoinFilterLocalState> local_filter_state;
+
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
@@ -238,6 +254,9 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	// resolve the join keys for the right chunk
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
+	if (filter_pushdown) {
+		filter_pushdown->Sink(lstate.join_keys, *lstate.local_filter_state);
+	}
 
 	// build the HT
 	auto &ht = *lstate.hash_table;
@@ -275,6 +294,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	}
+	if (filter_pushdown) {
+		filter_pushdown->Combine(*gstate.global_filter_state, *lstate.local_filter_state);
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -460,6 +482,15 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (filter_pushdown) {
+		// the build side is complete: push the join filters into the scans on the probe side
+		idx_t build_count = 0;
+		for (auto &local_ht : sink.local_hash_tables) {
+			build_count += local_ht->GetSinkCollection().Count();
+		}
+		filter_pushdown->PushFilters(*this, *sink.global_filter_state, build_count);
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
@@ -536,9 +567,27 @@ public:
 	//! Chunk to sink data into for external join
 	DataChunk spill_chunk;
 
+	//! Probe statistics for the profiler
+	idx_t probe_rows = 0;
+	idx_t probe_comparisons = 0;
+	idx_t probe_matches = 0;
+
 public:
+	void ResetScanStructure() {
+		if (scan_structure) {
+			probe_comparisons += scan_structure->comparisons;
+			probe_matches += scan_structure->matches;
+			scan_structure = nullptr;
+		}
+	}
+
 	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
-		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+		ResetScanStructure();
+		auto &profiler = context.thread.profiler;
+		profiler.AddCounter(op, "probe_rows", probe_rows);
+		profiler.AddCounter(op, "probe_comparisons", probe_comparisons);
+		profiler.AddCounter(op, "probe_collisions", probe_comparisons - probe_matches);
+		profiler.Flush(op, probe_executor, "probe_executor", 0);
 	}
 };
 
@@ -585,6 +634,7 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 
 	if (sink.perfect_join_executor) {
 		D_ASSERT(!sink.external);
+		state.probe_rows += input.size();
 		return sink.perfect_join_executor->ProbePerfectHashTable(context, input, chunk, *state.perfect_hash_join_state);
 	}
 
@@ -594,7 +644,7 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 		if (!state.scan_structure->PointersExhausted() || chunk.size() > 0) {
 			return OperatorResultType::HAVE_MORE_OUTPUT;
 		}
-		state.scan_structure = nullptr;
+		state.ResetScanStructure();
 		return OperatorResultType::NEED_MORE_INPUT;
 	}
 
@@ -615,6 +665,8 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 	} else {
 		state.scan_structure = sink.hash_table->Probe(state.join_keys, state.join_key_state);
 	}
+	// the join keys only hold the rows that were probed now, spilled rows are counted by the external probe
+	state.probe_rows += state.join_keys.size();
 	state.scan_structure->Next(state.join_keys, input, chunk);
 	return OperatorResultType::HAVE_MORE_OUTPUT;
 }
@@ -698,6 +750,8 @@ public:
 	void ExternalBuild(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate);
 	void ExternalProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
 	void ExternalScanHT(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
+	//! Adds the probe statistics gathered since the last call to the profiler
+	void FlushProbeStatistics(const PhysicalOperator &op, ExecutionContext &context);
 
 public:
 	//! The stage that this thread was assigned work for
@@ -711,8 +765,9 @@ public:
 
 	//! Local scan state for probe spill
 	ColumnDataConsumerScanState probe_local_scan;
-	//! Chunks for holding the scanned probe collection
+	//! Chunks for holding the scanned probe collection (slice_chunk if it has the matches of the previous slices)
 	DataChunk probe_chunk;
+	DataChunk slice_chunk;
 	DataChunk join_keys;
 	DataChunk payload;
 	TupleDataChunkState join_key_state;
@@ -722,6 +777,10 @@ public:
 	//! Scan structure for the external probe
 	unique_ptr<JoinHashTable::ScanStructure> scan_structure;
 	bool empty_ht_probe_in_progress;
+	//! Probe statistics of the external probe for the profiler
+	idx_t probe_rows = 0;
+	idx_t probe_comparisons = 0;
+	idx_t probe_matches = 0;
 
 	//! Chunks assigned to this thread for a full/outer scan
 	idx_t full_outer_chunk_idx_from;
@@ -757,6 +816,12 @@ void HashJoinGlobalSourceState::Initialize(HashJoinGlobalSinkState &sink) {
 	}
 
 	global_stage = HashJoinSourceStage::PROBE;
+	if (sink.probe_spill && sink.hash_table->ProbesSliceMatches()) {
+		// The first slice of a partition is built, but the probe tuples of the partition were all spilled so that they
+		// can carry their matches from slice to slice: probe them now
+		PrepareProbe(sink);
+		return;
+	}
 	TryPrepareNextStage(sink);
 }
 
@@ -968,6 +1033,14 @@ void HashJoinLocalSourceState::ExternalProbe(HashJoinGlobalSinkState &sink, Hash
 
 	if (scan_structure || empty_ht_probe_in_progress) {
 		// Previous probe is done
+		if (scan_structure) {
+			probe_comparisons += scan_structure->comparisons;
+			probe_matches += scan_structure->matches;
+			if (scan_structure->slice_matches_only) {
+				// Probe the tuples again with the next slice of the partition, together with their matches so far
+				sink.probe_spill->AppendSliceMatches(slice_chunk, scan_structure->found_match.get());
+			}
+		}
 		scan_structure = nullptr;
 		empty_ht_probe_in_progress = false;
 		sink.probe_spill->consumer->FinishChunk(probe_local_scan);
@@ -977,12 +1050,19 @@ void HashJoinLocalSourceState::ExternalProbe(HashJoinGlobalSinkState &sink, Hash
 	}
 
 	// Scan input chunk for next probe
-	sink.probe_spill->consumer->ScanChunk(probe_local_scan, probe_chunk);
+	auto &probe_spill = *sink.probe_spill;
+	const auto probes_slice_matches = probe_spill.ProbesSliceMatches();
+	if (probes_slice_matches && slice_chunk.ColumnCount() == 0) {
+		slice_chunk.Initialize(BufferAllocator::Get(sink.context), probe_spill.GetSliceTypes());
+	}
+	auto &input = probes_slice_matches ? slice_chunk : probe_chunk;
+	probe_spill.consumer->ScanChunk(probe_local_scan, input);
 
 	// Get the probe chunk columns/hashes
-	join_keys.ReferenceColumns(probe_chunk, join_key_indices);
-	payload.ReferenceColumns(probe_chunk, payload_indices);
-	auto precomputed_hashes = &probe_chunk.data.back();
+	join_keys.ReferenceColumns(input, join_key_indices);
+	payload.ReferenceColumns(input, payload_indices);
+	auto precomputed_hashes = &input.data[sink.probe_types.size() - 1];
+	probe_rows += join_keys.size();
 
 	if (sink.hash_table->Count() == 0 && !gstate.op.EmptyResultIfRHSIsEmpty()) {
 		gstate.op.ConstructEmptyJoinResult(sink.hash_table->join_type, sink.hash_table->has_null, payload, chunk);
@@ -992,9 +1072,23 @@ void HashJoinLocalSourceState::ExternalProbe(HashJoinGlobalSinkState &sink, Hash
 
 	// Perform the probe
 	scan_structure = sink.hash_table->Probe(join_keys, join_key_state, precomputed_hashes);
+	if (probes_slice_matches) {
+		scan_structure->SetPreviousMatches(input.data.back(), input.size());
+		scan_structure->slice_matches_only = probe_spill.HasNextSlice();
+	}
 	scan_structure->Next(join_keys, payload, chunk);
 }
 
+void HashJoinLocalSourceState::FlushProbeStatistics(const PhysicalOperator &op, ExecutionContext &context) {
+	auto &profiler = context.thread.profiler;
+	profiler.AddCounter(op, "probe_rows", probe_rows);
+	profiler.AddCounter(op, "probe_comparisons", probe_comparisons);
+	profiler.AddCounter(op, "probe_collisions", probe_comparisons - probe_matches);
+	probe_rows = 0;
+	probe_comparisons = 0;
+	probe_matches = 0;
+}
+
 void HashJoinLocalSourceState::ExternalScanHT(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
                                               DataChunk &chunk) {
 	D_ASSERT(local_stage == HashJoinSourceStage::SCAN_HT);
@@ -1050,6 +1144,7 @@ SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk
 			}
 		}
 	}
+	lstate.FlushProbeStatistics(*this, context);
 
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
@@ -2,6 +2,7 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -13,18 +14,23 @@ PhysicalTableScan::PhysicalTableScan(vector<LogicalType> types, TableFunction fu
                                      unique_ptr<FunctionData> bind_data_p, vector<LogicalType> returned_types_p,
                                      vector<column_t> column_ids_p, vector<idx_t> projection_ids_p,
                                      vector<string> names_p, unique_ptr<TableFilterSet> table_filters_p,
-                                     idx_t estimated_cardinality, ExtraOperatorInfo extra_info)
+                                     idx_t estimated_cardinality, ExtraOperatorInfo extra_info,
+                                     shared_ptr<DynamicTableFilterSet> dynamic_filters_p)
     : PhysicalOperator(PhysicalOperatorType::TABLE_SCAN, std::move(types), estimated_cardinality),
       function(std::move(function_p)), bind_data(std::move(bind_data_p)), returned_types(std::move(returned_types_p)),
       column_ids(std::move(column_ids_p)), projection_ids(std::move(projection_ids_p)), names(std::move(names_p)),
-      table_filters(std::move(table_filters_p)), extra_info(extra_info) {
+      table_filters(std::move(table_filters_p)), extra_info(extra_info), dynamic_filters(std::move(dynamic_filters_p)) {
 }
 
 class TableScanGlobalSourceState : public GlobalSourceState {
 public:
 	TableScanGlobalSourceState(ClientContext &context, const PhysicalTableScan &op) {
+		if (op.dynamic_filters && op.dynamic_filters->HasFilters()) {
+			// the scan is initialized after the operators that push dynamic filters into it have finished their sink
+			table_filters = op.dynamic_filters->GetFinalTableFilters(op.table_filters.get());
+		}
 		if (op.function.init_global) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, GetTableFilters(op));
 			global_state = op.function.init_global(context, input);
 			if (global_state) {
 				max_threads = global_state->MaxThreads();
@@ -36,6 +42,12 @@ public:
 
 	idx_t max_threads = 0;
 	unique_ptr<GlobalTableFunctionState> global_state;
+	//! The table filters (including the dynamic filters) of this scan, if there are any dynamic filters
+	unique_ptr<TableFilterSet> table_filters;
+
+	optional_ptr<TableFilterSet> GetTableFilters(const PhysicalTableScan &op) const {
+		return table_filters ? table_filters.get() : op.table_filters.get();
+	}
 
 	idx_t MaxThreads() override {
 		return max_threads;
@@ -47,7 +59,8 @@ public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids,
+			                             gstate.GetTableFilters(op));
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
@@ -72,6 +85,10 @@ SourceResultType PhysicalTableScan::GetData(ExecutionContext &context, DataChunk
 
 	TableFunctionInput data(bind_data.get(), state.local_state.get(), gstate.global_state.get());
 	function.function(context.client, data, chunk);
+	if (function.get_pruned_rows) {
+		auto pruned_rows = function.get_pruned_rows(context.client, bind_data.get(), state.local_state.get());
+		context.thread.profiler.AddCounter(*this, "zonemap_pruned_rows", pruned_rows);
+	}
 
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
@@ -140,6 +157,21 @@ string PhysicalTableScan::ParamsToString() const {
 			}
 		}
 	}
+	if (dynamic_filters && dynamic_filters->HasFilters()) {
+		auto filters = dynamic_filters->GetFinalTableFilters(nullptr);
+		if (filters) {
+			result += "\n[INFOSEPARATOR]\n";
+			result += "Dynamic Filters: ";
+			for (auto &f : filters->filters) {
+				auto &column_index = f.first;
+				auto &filter = f.second;
+				if (column_index < column_ids.size() && column_ids[column_index] < names.size()) {
+					result += filter->ToString(names[column_ids[column_index]]);
+					result += "\n";
+				}
+			}
+		}
+	}
 	if (!extra_info.file_filters.empty()) {
 		result += "\n[INFOSEPARATOR]\n";
 		result += "File Filters: " + extra_info.file_filters;
@@ -163,6 +195,10 @@ bool PhysicalTableScan::Equals(const PhysicalOperator &other_p) const {
 	if (!FunctionData::Equals(bind_data.get(), other.bind_data.get())) {
 		return false;
 	}
+	if (dynamic_filters || other.dynamic_filters) {
+		// scans with run-time filters are never considered equal
+		return false;
+	}
 	return true;
 }
 
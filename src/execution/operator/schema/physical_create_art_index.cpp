@@ -3,9 +3,14 @@
 #include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/array.hpp"
 #include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/index.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -35,6 +40,20 @@ class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	//! Global index to be added to the table
 	unique_ptr<Index> global_index;
+
+	//! Lock for the thread-local indexes
+	mutex lock;
+	//! The thread-local indexes, which we merge in parallel during Finalize
+	vector<unique_ptr<Index>> local_indexes;
+
+	//! The number of key ranges, each thread builds a separate index for each key range. One, if we do not partition
+	idx_t partition_count = 1;
+	//! The position of the key byte that determines the key range of a key. All keys share the bytes before it
+	idx_t partition_depth = 0;
+	//! The key range of each value of the key byte at partition_depth
+	array<idx_t, 256> byte_partitions;
+	//! The thread-local indexes of each key range
+	vector<vector<unique_ptr<Index>>> partition_indexes;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
@@ -42,12 +61,70 @@ public:
 	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
 
 	unique_ptr<Index> local_index;
+	//! The index of each key range, if the keys are partitioned by key ranges
+	vector<unique_ptr<Index>> partition_indexes;
 	ArenaAllocator arena_allocator;
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
 };
 
+//! Partitions large index builds into key ranges on the first key byte that differs between the keys. Each thread
+//! builds a separate index for each key range, and the indexes of a key range are merged independently of the other
+//! key ranges. The merged indexes hold disjoint key ranges, so attaching them below the common key prefix is cheap
+static void InitializePartitions(ClientContext &context, const PhysicalCreateARTIndex &op,
+                                 CreateARTIndexGlobalSinkState &state) {
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	auto min_rows = thread_count * PhysicalCreateARTIndex::PARTITION_MIN_ROWS;
+	auto partition_count = MinValue<idx_t>(thread_count, op.estimated_cardinality / min_rows);
+	if (partition_count < 2) {
+		return;
+	}
+
+	// by default, we partition on the first key byte
+	idx_t depth = 0;
+	idx_t min_byte = 0;
+	idx_t max_byte = NumericLimits<uint8_t>::Maximum();
+
+	// if the first key column has min/max statistics, then all keys share the key prefix of its min and max value
+	auto &expr = *op.unbound_expressions[0];
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		D_ASSERT(colref.binding.column_index < op.storage_ids.size());
+		auto stats = op.table.GetStorage().GetStatistics(context, op.storage_ids[colref.binding.column_index]);
+		if (stats && stats->GetStatsType() == StatisticsType::NUMERIC_STATS && NumericStats::HasMinMax(*stats)) {
+			DataChunk bounds;
+			bounds.Initialize(Allocator::Get(context), {expr.return_type}, 2);
+			bounds.SetValue(0, 0, NumericStats::Min(*stats));
+			bounds.SetValue(0, 1, NumericStats::Max(*stats));
+			bounds.SetCardinality(2);
+
+			ArenaAllocator arena_allocator(Allocator::Get(context));
+			vector<ARTKey> keys(2);
+			ART::GenerateKeys(arena_allocator, bounds, keys);
+			while (depth + 1 < keys[0].len && keys[0].data[depth] == keys[1].data[depth]) {
+				depth++;
+			}
+			min_byte = keys[0].data[depth];
+			max_byte = keys[1].data[depth];
+		}
+	}
+
+	// split the values of the key byte evenly into the key ranges
+	auto byte_count = max_byte - min_byte + 1;
+	partition_count = MinValue<idx_t>(partition_count, byte_count);
+	if (partition_count < 2) {
+		return;
+	}
+	state.partition_count = partition_count;
+	state.partition_depth = depth;
+	for (idx_t byte = 0; byte < state.byte_partitions.size(); byte++) {
+		auto clamped_byte = MinValue<idx_t>(MaxValue<idx_t>(byte, min_byte), max_byte);
+		state.byte_partitions[byte] = (clamped_byte - min_byte) * partition_count / byte_count;
+	}
+	state.partition_indexes.resize(partition_count);
+}
+
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
 	auto state = make_uniq<CreateARTIndexGlobalSinkState>();
 
@@ -56,6 +133,7 @@ unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientCon
 	state->global_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
 	                                     TableIOManager::Get(storage), unbound_expressions, storage.db);
 
+	InitializePartitions(context, *this, *state);
 	return (std::move(state));
 }
 
@@ -119,6 +197,39 @@ SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, Opera
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkResultType PhysicalCreateARTIndex::SinkPartitioned(Vector &row_identifiers, OperatorSinkInput &input) const {
+
+	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto &storage = table.GetStorage();
+	auto count = l_state.key_chunk.size();
+
+	// get the corresponding row IDs
+	row_identifiers.Flatten(count);
+	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+
+	// insert the row IDs into the index of their key range
+	auto &partition_indexes = l_state.partition_indexes;
+	if (partition_indexes.empty()) {
+		partition_indexes.resize(g_state.partition_count);
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto &key = l_state.keys[i];
+		auto byte = key.len > g_state.partition_depth ? key.data[g_state.partition_depth] : 0;
+		auto &partition_index = partition_indexes[g_state.byte_partitions[byte]];
+		if (!partition_index) {
+			partition_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
+			                                 TableIOManager::Get(storage), unbound_expressions, storage.db);
+		}
+		auto &art = partition_index->Cast<ART>();
+		if (!art.Insert(art.tree, key, 0, row_ids[i])) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
+
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
                                             OperatorSinkInput &input) const {
 
@@ -132,6 +243,9 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 
 	// insert the keys and their corresponding row IDs
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
+	if (input.global_state.Cast<CreateARTIndexGlobalSinkState>().partition_count > 1) {
+		return SinkPartitioned(row_identifiers, input);
+	}
 	if (sorted) {
 		return SinkSorted(row_identifiers, input);
 	}
@@ -144,19 +258,264 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 	auto &gstate = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
-	// merge the local index into the global index
-	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	if (gstate.partition_count > 1) {
+		// hand the indexes of the key ranges to the global state
+		lock_guard<mutex> guard(gstate.lock);
+		for (idx_t i = 0; i < lstate.partition_indexes.size(); i++) {
+			if (lstate.partition_indexes[i]) {
+				gstate.partition_indexes[i].push_back(std::move(lstate.partition_indexes[i]));
+			}
+		}
+		return SinkCombineResultType::FINISHED;
 	}
 
+	// hand the local index to the global state, we merge all local indexes in parallel during Finalize
+	if (!lstate.local_index->Cast<ART>().tree.HasMetadata()) {
+		return SinkCombineResultType::FINISHED;
+	}
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.local_indexes.push_back(std::move(lstate.local_index));
 	return SinkCombineResultType::FINISHED;
 }
 
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+
+class CreateARTIndexMergeTask : public ExecutorTask {
+public:
+	CreateARTIndexMergeTask(shared_ptr<Event> event_p, ClientContext &context, Index &target_p, Index &source_p)
+	    : ExecutorTask(context, std::move(event_p)), target(target_p), source(source_p) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		if (!target.MergeIndexes(source)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	Index &target;
+	Index &source;
+};
+
+//! Merges the thread-local indexes pairwise: each round halves the number of indexes, and all merges of a round
+//! run in parallel, as they operate on disjoint indexes and fixed-size allocators. The key ranges of the indexes
+//! generally overlap (e.g., for unsorted input), so a merge recurses into all shared key prefixes. Each merge runs on a
+//! single thread, i.e., the last round, which merges the two remaining indexes, is serial
+class CreateARTIndexMergeEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexMergeEvent(const PhysicalCreateARTIndex &op_p, CreateARTIndexGlobalSinkState &gstate_p,
+	                         Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p) {
+	}
+
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		vector<shared_ptr<Task>> merge_tasks;
+		auto &indexes = gstate.local_indexes;
+		for (idx_t i = 0; i + 1 < indexes.size(); i += 2) {
+			merge_tasks.push_back(
+			    make_uniq<CreateARTIndexMergeTask>(shared_from_this(), context, *indexes[i], *indexes[i + 1]));
+		}
+		SetTasks(std::move(merge_tasks));
+	}
+
+	void FinishEvent() override {
+		// keep the merged indexes, and the last index of an odd number of indexes
+		auto &indexes = gstate.local_indexes;
+		idx_t remaining = 0;
+		for (idx_t i = 0; i < indexes.size(); i += 2) {
+			indexes[remaining++] = std::move(indexes[i]);
+		}
+		indexes.resize(remaining);
+
+		if (indexes.size() > 1) {
+			// schedule the next round
+			auto new_event = make_shared<CreateARTIndexMergeEvent>(op, gstate, *pipeline);
+			InsertEvent(std::move(new_event));
+			return;
+		}
+		gstate.global_index = std::move(indexes[0]);
+		indexes.clear();
+		op.FinalizeIndex(pipeline->GetClientContext(), gstate);
+	}
+};
+
+//! Merges the thread-local indexes of a key range into the first of them
+class CreateARTIndexPartitionMergeTask : public ExecutorTask {
+public:
+	CreateARTIndexPartitionMergeTask(shared_ptr<Event> event_p, ClientContext &context,
+	                                 vector<unique_ptr<Index>> &indexes_p)
+	    : ExecutorTask(context, std::move(event_p)), indexes(indexes_p) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		for (idx_t i = 1; i < indexes.size(); i++) {
+			if (!indexes[0]->MergeIndexes(*indexes[i])) {
+				throw ConstraintException("Data contains duplicates on indexed column(s)");
+			}
+		}
+		indexes.resize(1);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	vector<unique_ptr<Index>> &indexes;
+};
+
+//! Increments the buffer IDs of the index of a key range past the buffers of all preceding key ranges
+class CreateARTIndexPartitionIncrementTask : public ExecutorTask {
+public:
+	CreateARTIndexPartitionIncrementTask(shared_ptr<Event> event_p, ClientContext &context, Index &index_p,
+	                                     ARTFlags flags_p)
+	    : ExecutorTask(context, std::move(event_p)), index(index_p), flags(std::move(flags_p)) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		index.Cast<ART>().IncrementBufferIds(flags);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	Index &index;
+	ARTFlags flags;
+};
+
+//! Attaches the indexes of the key ranges to the global index. Incrementing their buffer IDs traverses each index,
+//! which runs in parallel. The key ranges are disjoint, so the final merges only touch the nodes along the common key
+//! prefix, and the node at the partition depth, which grows into a Node256 for many key ranges
+class CreateARTIndexPartitionAttachEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexPartitionAttachEvent(const PhysicalCreateARTIndex &op_p, CreateARTIndexGlobalSinkState &gstate_p,
+	                                   Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p) {
+	}
+
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		// the buffers of each key range follow the buffers of the global index and of all preceding key ranges
+		auto &global_art = gstate.global_index->Cast<ART>();
+		ARTFlags flags;
+		for (auto &allocator : *global_art.allocators) {
+			flags.merge_buffer_counts.push_back(allocator->GetUpperBoundBufferId());
+		}
+
+		vector<shared_ptr<Task>> increment_tasks;
+		for (auto &indexes : gstate.partition_indexes) {
+			if (indexes.empty()) {
+				continue;
+			}
+			auto &art = indexes[0]->Cast<ART>();
+			increment_tasks.push_back(
+			    make_uniq<CreateARTIndexPartitionIncrementTask>(shared_from_this(), context, art, flags));
+			for (idx_t i = 0; i < art.allocators->size(); i++) {
+				flags.merge_buffer_counts[i] += (*art.allocators)[i]->GetUpperBoundBufferId();
+			}
+		}
+		if (!increment_tasks.empty()) {
+			SetTasks(std::move(increment_tasks));
+		}
+	}
+
+	void FinishEvent() override {
+		auto &global_art = gstate.global_index->Cast<ART>();
+		for (auto &indexes : gstate.partition_indexes) {
+			if (indexes.empty()) {
+				continue;
+			}
+			if (!global_art.MergeIncrementedIndex(indexes[0]->Cast<ART>())) {
+				throw ConstraintException("Data contains duplicates on indexed column(s)");
+			}
+		}
+		gstate.partition_indexes.clear();
+		op.FinalizeIndex(pipeline->GetClientContext(), gstate);
+	}
+};
+
+//! Merges the thread-local indexes of each key range. All key ranges merge in parallel
+class CreateARTIndexPartitionMergeEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexPartitionMergeEvent(const PhysicalCreateARTIndex &op_p, CreateARTIndexGlobalSinkState &gstate_p,
+	                                  Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p) {
+	}
+
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		vector<shared_ptr<Task>> merge_tasks;
+		for (auto &indexes : gstate.partition_indexes) {
+			if (indexes.size() > 1) {
+				merge_tasks.push_back(
+				    make_uniq<CreateARTIndexPartitionMergeTask>(shared_from_this(), context, indexes));
+			}
+		}
+		if (!merge_tasks.empty()) {
+			SetTasks(std::move(merge_tasks));
+		}
+	}
+
+	void FinishEvent() override {
+		auto new_event = make_shared<CreateARTIndexPartitionAttachEvent>(op, gstate, *pipeline);
+		InsertEvent(std::move(new_event));
+	}
+};
+
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
 
-	// here, we set the resulting global index as the newly created index of the table
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	auto &local_indexes = state.local_indexes;
+
+	if (state.partition_count > 1) {
+		// merge the indexes of each key range in parallel, then attach them to the global index
+		auto new_event = make_shared<CreateARTIndexPartitionMergeEvent>(*this, state, pipeline);
+		event.InsertEvent(std::move(new_event));
+		return SinkFinalizeType::READY;
+	}
+
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (local_indexes.size() > 1 && scheduler.NumberOfThreads() > 1) {
+		// merge the local indexes in parallel, the last merge round sets the global index
+		auto new_event = make_shared<CreateARTIndexMergeEvent>(*this, state, pipeline);
+		event.InsertEvent(std::move(new_event));
+		return SinkFinalizeType::READY;
+	}
+
+	// merge the local indexes into the global index
+	for (auto &local_index : local_indexes) {
+		if (!state.global_index->MergeIndexes(*local_index)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
+	local_indexes.clear();
+	FinalizeIndex(context, state);
+	return SinkFinalizeType::READY;
+}
+
+void PhysicalCreateARTIndex::FinalizeIndex(ClientContext &context, GlobalSinkState &gstate) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = gstate.Cast<CreateARTIndexGlobalSinkState>();
 
 	// vacuum excess memory and verify
 	state.global_index->Vacuum();
@@ -173,7 +532,7 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 	if (!index_entry) {
 		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
 		// index already exists, but error ignored because of IF NOT EXISTS
-		return SinkFinalizeType::READY;
+		return;
 	}
 	auto &index = index_entry->Cast<DuckIndexEntry>();
 	index.initial_index_size = state.global_index->GetInMemorySize();
@@ -185,7 +544,6 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 
 	// add index to storage
 	storage.info->indexes.AddIndex(std::move(state.global_index));
-	return SinkFinalizeType::READY;
 }
 
 //===--------------------------------------------------------------------===//
@@ -2,7 +2,9 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
@@ -149,6 +151,25 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool CanUseSortAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (op.grouping_sets.size() == 1 && op.grouping_sets[0].size() != op.groups.size()) {
+		return false;
+	}
+	bool has_holistic_aggregate = false;
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || !aggregate.function.combine) {
+			return false;
+		}
+		has_holistic_aggregate = has_holistic_aggregate || aggregate.function.holistic;
+	}
+	// holistic aggregates keep every value of a group: sort on the groups, so that only one group is kept at a time
+	return has_holistic_aggregate;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -178,9 +199,24 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// use a sort aggregate for holistic aggregates, or a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (CanUseSortAggregate(op)) {
+			vector<BoundOrderByNode> orders;
+			vector<idx_t> projections;
+			for (auto &group : op.groups) {
+				orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, group->Copy());
+			}
+			for (idx_t col_idx = 0; col_idx < plan->types.size(); col_idx++) {
+				projections.push_back(col_idx);
+			}
+			auto order = make_uniq<PhysicalOrder>(plan->types, std::move(orders), std::move(projections),
+			                                      plan->estimated_cardinality);
+			order->children.push_back(std::move(plan));
+			plan = std::move(order);
+			groupby = make_uniq_base<PhysicalOperator, PhysicalSortAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -193,9 +193,29 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		if (op.filter_pushdown) {
+			// the physical join moves the equality conditions to the front: remap the condition indexes
+			vector<idx_t> condition_map(op.conditions.size());
+			idx_t equal_position = 0;
+			idx_t other_position = op.conditions.size() - 1;
+			for (idx_t i = 0; i < op.conditions.size(); i++) {
+				auto comparison = op.conditions[i].comparison;
+				if (comparison == ExpressionType::COMPARE_EQUAL ||
+				    comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+					condition_map[i] = equal_position++;
+				} else {
+					condition_map[i] = other_position--;
+				}
+			}
+			for (auto &cond_idx : op.filter_pushdown->join_condition) {
+				cond_idx = condition_map[cond_idx];
+			}
+		}
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->filter_pushdown = std::move(op.filter_pushdown);
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
@@ -1,5 +1,7 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/order/physical_top_n.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -10,26 +12,69 @@
 
 namespace duckdb {
 
-static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
-	auto &wexpr = expr->Cast<BoundWindowExpression>();
-	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls ||
-	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+static bool OrdersMatch(const vector<BoundOrderByNode> &sort_orders, const vector<idx_t> &sort_columns,
+                        const vector<BoundOrderByNode> &orders) {
+	if (sort_orders.size() < orders.size()) {
 		return false;
 	}
-	switch (wexpr.type) {
-	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
-		// We can stream aggregates if they are "running totals" and don't use filters
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS &&
-		       !wexpr.filter_expr;
-	case ExpressionType::WINDOW_FIRST_VALUE:
-	case ExpressionType::WINDOW_PERCENT_RANK:
-	case ExpressionType::WINDOW_RANK:
-	case ExpressionType::WINDOW_RANK_DENSE:
-	case ExpressionType::WINDOW_ROW_NUMBER:
-		return true;
-	default:
-		return false;
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto &sort_order = sort_orders[i];
+		if (sort_order.type != orders[i].type || sort_order.null_order != orders[i].null_order ||
+		    sort_order.expression->GetExpressionType() != ExpressionType::BOUND_REF ||
+		    sort_order.expression->Cast<BoundReferenceExpression>().index != sort_columns[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Returns true if the plan is known to produce its rows sorted on the given orders: this is the case if the orders
+// are input columns that are passed through (by projections, filters and streaming windows) from a sort
+static bool IsSortedOn(PhysicalOperator &plan, const vector<BoundOrderByNode> &orders) {
+	vector<idx_t> columns;
+	for (auto &order : orders) {
+		if (order.expression->GetExpressionType() != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(order.expression->Cast<BoundReferenceExpression>().index);
+	}
+	reference<PhysicalOperator> op(plan);
+	while (true) {
+		switch (op.get().type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &projection = op.get().Cast<PhysicalProjection>();
+			for (auto &column : columns) {
+				auto &expr = *projection.select_list[column];
+				if (expr.GetExpressionType() != ExpressionType::BOUND_REF) {
+					return false;
+				}
+				column = expr.Cast<BoundReferenceExpression>().index;
+			}
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			break;
+		case PhysicalOperatorType::STREAMING_WINDOW:
+			// the window results are appended to the input columns
+			for (auto &column : columns) {
+				if (column >= op.get().children[0]->types.size()) {
+					return false;
+				}
+			}
+			break;
+		case PhysicalOperatorType::ORDER_BY: {
+			auto &order = op.get().Cast<PhysicalOrder>();
+			for (auto &column : columns) {
+				column = order.projections[column];
+			}
+			return OrdersMatch(order.orders, columns, orders);
+		}
+		case PhysicalOperatorType::TOP_N:
+			return OrdersMatch(op.get().Cast<PhysicalTopN>().orders, columns, orders);
+		default:
+			return false;
+		}
+		op = *op.get().children[0];
 	}
 }
 
@@ -54,7 +99,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
-		if (IsStreamingWindow(op.expressions[expr_idx])) {
+		if (PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx])) {
 			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
@@ -64,6 +109,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	// Process the window functions by sharing the partition/order definitions
 	unordered_map<idx_t, idx_t> projection_map;
 	vector<vector<idx_t>> window_expressions;
+	vector<vector<BoundOrderByNode>> streaming_orders;
 	idx_t blocking_count = 0;
 	auto output_pos = input_width;
 	while (!blocking_windows.empty() || !streaming_windows.empty()) {
@@ -129,6 +175,16 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 		}
 
 		window_expressions.emplace_back(std::move(matching));
+
+		// Streaming windows with an ORDER BY stream over the sorted input
+		if (process_streaming) {
+			auto &over_expr = op.expressions[over_idx]->Cast<BoundWindowExpression>();
+			vector<BoundOrderByNode> orders;
+			for (auto &order : over_expr.orders) {
+				orders.emplace_back(order.Copy());
+			}
+			streaming_orders.emplace_back(std::move(orders));
+		}
 	}
 
 	// Build the window operators
@@ -146,6 +202,17 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 		if (i < blocking_count) {
 			window = make_uniq<PhysicalWindow>(types, std::move(select_list), op.estimated_cardinality);
 		} else {
+			auto &orders = streaming_orders[i - blocking_count];
+			if (!orders.empty() && !IsSortedOn(*plan, orders)) {
+				vector<idx_t> projections;
+				for (idx_t col_idx = 0; col_idx < plan->types.size(); col_idx++) {
+					projections.push_back(col_idx);
+				}
+				auto order = make_uniq<PhysicalOrder>(plan->types, std::move(orders), std::move(projections),
+				                                      op.estimated_cardinality);
+				order->children.push_back(std::move(plan));
+				plan = std::move(order);
+			}
 			window = make_uniq<PhysicalStreamingWindow>(types, std::move(select_list), op.estimated_cardinality);
 		}
 		window->children.push_back(std::move(plan));
@@ -420,21 +420,8 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
-void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
-                                     DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
-	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
-	auto &lstate = input.local_state.Cast<RadixHTLocalSinkState>();
-	if (!lstate.ht) {
-		lstate.ht = CreateHT(context.client, gstate.config.sink_capacity, gstate.config.GetRadixBits());
-		gstate.active_threads++;
-	}
-
-	auto &group_chunk = lstate.group_chunk;
-	PopulateGroupChunk(group_chunk, chunk);
-
+void MaybeResetHT(ClientContext &context, RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lstate) {
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
-
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
@@ -449,7 +436,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	}
 
 	// Check if we need to repartition
-	auto repartitioned = MaybeRepartition(context.client, gstate, lstate, active_threads);
+	auto repartitioned = MaybeRepartition(context, gstate, lstate, active_threads);
 
 	if (repartitioned && ht.Count() != 0) {
 		// We repartitioned, but we didn't clear the pointer table / reset the count because we're on 1 or 2 threads
@@ -460,6 +447,93 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	// TODO: combine early and often
 }
 
+void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
+                                     DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
+	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<RadixHTLocalSinkState>();
+	if (!lstate.ht) {
+		lstate.ht = CreateHT(context.client, gstate.config.sink_capacity, gstate.config.GetRadixBits());
+		gstate.active_threads++;
+	}
+
+	auto &group_chunk = lstate.group_chunk;
+	PopulateGroupChunk(group_chunk, chunk);
+
+	auto &ht = *lstate.ht;
+	ht.AddChunk(group_chunk, payload_input, filter);
+
+	MaybeResetHT(context.client, gstate, lstate);
+}
+
+void RadixPartitionedHashTable::SinkStates(ExecutionContext &context, const RadixPartitionedHashTable &finer,
+                                           LocalSinkState &finer_lstate_p, OperatorSinkInput &input) const {
+	auto &finer_lstate = finer_lstate_p.Cast<RadixHTLocalSinkState>();
+	if (!finer_lstate.ht) {
+		return; // This thread did not sink anything into the finer grouping set
+	}
+
+	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<RadixHTLocalSinkState>();
+	if (!lstate.ht) {
+		lstate.ht = CreateHT(context.client, gstate.config.sink_capacity, gstate.config.GetRadixBits());
+		gstate.active_threads++;
+	}
+
+	// The columns of the finer grouping set that we group on
+	vector<column_t> column_ids;
+	idx_t finer_col_idx = 0;
+	for (auto &group_idx : finer.grouping_set) {
+		if (grouping_set.find(group_idx) != grouping_set.end()) {
+			column_ids.push_back(finer_col_idx);
+		}
+		finer_col_idx++;
+	}
+	D_ASSERT(column_ids.size() == grouping_set.size());
+	if (grouping_set.empty()) {
+		// The group chunk holds a constant fake group, but we still need to scan something
+		column_ids.push_back(0);
+	}
+
+	// The finer HT has to flush its appends before its data can be scanned
+	auto &finer_ht = *finer_lstate.ht;
+	finer_ht.UnpinData();
+
+	vector<reference<TupleDataCollection>> collections;
+	if (finer_lstate.abandoned_data) {
+		for (auto &partition : finer_lstate.abandoned_data->GetPartitions()) {
+			collections.emplace_back(*partition);
+		}
+	}
+	for (auto &partition : finer_ht.GetPartitionedData()->GetPartitions()) {
+		collections.emplace_back(*partition);
+	}
+
+	auto &group_chunk = lstate.group_chunk;
+	auto &ht = *lstate.ht;
+	for (auto &collection_ref : collections) {
+		auto &collection = collection_ref.get();
+		if (collection.Count() == 0) {
+			continue;
+		}
+		TupleDataScanState scan_state;
+		collection.InitializeScan(scan_state, column_ids, TupleDataPinProperties::UNPIN_AFTER_DONE);
+		DataChunk scan_chunk;
+		collection.InitializeScanChunk(scan_state, scan_chunk);
+		while (collection.Scan(scan_state, scan_chunk)) {
+			if (!grouping_set.empty()) {
+				for (idx_t col_idx = 0; col_idx < scan_chunk.ColumnCount(); col_idx++) {
+					group_chunk.data[col_idx].Reference(scan_chunk.data[col_idx]);
+				}
+			}
+			group_chunk.SetCardinality(scan_chunk.size());
+			group_chunk.Verify();
+
+			ht.AddStates(group_chunk, scan_state.chunk_state.row_locations, finer.GetLayout());
+			MaybeResetHT(context.client, gstate, lstate);
+		}
+	}
+}
+
 void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
                                         LocalSinkState &lstate_p) const {
 	auto &gstate = gstate_p.Cast<RadixHTGlobalSinkState>();
@@ -74,23 +74,26 @@ static idx_t FindPrevStart(const ValidityMask &mask, const idx_t l, idx_t r, idx
 }
 
 template <typename T>
-static T GetCell(const DataChunk &chunk, idx_t column, idx_t index) {
-	D_ASSERT(chunk.ColumnCount() > column);
-	auto &source = chunk.data[column];
+static T GetCell(WindowCursor &cursor, idx_t column, idx_t index) {
+	D_ASSERT(cursor.chunk.ColumnCount() > column);
+	const auto chunk_idx = cursor.Seek(index);
+	auto &source = cursor.chunk.data[column];
 	const auto data = FlatVector::GetData<T>(source);
-	return data[index];
+	return data[chunk_idx];
 }
 
-static bool CellIsNull(const DataChunk &chunk, idx_t column, idx_t index) {
-	D_ASSERT(chunk.ColumnCount() > column);
-	auto &source = chunk.data[column];
-	return FlatVector::IsNull(source, index);
+static bool CellIsNull(WindowCursor &cursor, idx_t column, idx_t index) {
+	D_ASSERT(cursor.chunk.ColumnCount() > column);
+	const auto chunk_idx = cursor.Seek(index);
+	auto &source = cursor.chunk.data[column];
+	return FlatVector::IsNull(source, chunk_idx);
 }
 
-static void CopyCell(const DataChunk &chunk, idx_t column, idx_t index, Vector &target, idx_t target_offset) {
-	D_ASSERT(chunk.ColumnCount() > column);
-	auto &source = chunk.data[column];
-	VectorOperations::Copy(source, target, index + 1, index, target_offset);
+static void CopyCell(WindowCursor &cursor, idx_t column, idx_t index, Vector &target, idx_t target_offset) {
+	D_ASSERT(cursor.chunk.ColumnCount() > column);
+	const auto chunk_idx = cursor.Seek(index);
+	auto &source = cursor.chunk.data[column];
+	VectorOperations::Copy(source, target, chunk_idx + 1, chunk_idx, target_offset);
 }
 
 //===--------------------------------------------------------------------===//
@@ -754,10 +757,18 @@ class WindowValueState : public WindowExecutorBoundsState {
 public:
 	WindowValueState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t count,
 	                 const ValidityMask &partition_mask_p, const ValidityMask &order_mask_p,
-	                 const ValidityMask &ignore_nulls)
+	                 const ValidityMask &ignore_nulls, optional_ptr<const ColumnDataCollection> payload_collection)
 	    : WindowExecutorBoundsState(wexpr, context, count, partition_mask_p, order_mask_p)
 
 	{
+		if (payload_collection) {
+			cursor = make_uniq<WindowCursor>(*payload_collection);
+			//	NTH_VALUE reads its argument at the current row and its value at the nth row
+			if (wexpr.type == ExpressionType::WINDOW_NTH_VALUE) {
+				row_cursor = make_uniq<WindowCursor>(*payload_collection);
+			}
+		}
+
 		if (wexpr.exclude_clause == WindowExcludeMode::NO_OTHER) {
 			exclusion_filter = nullptr;
 			ignore_nulls_exclude = &ignore_nulls;
@@ -772,6 +783,10 @@ public:
 	unique_ptr<ExclusionFilter> exclusion_filter;
 	//! The validity mask that combines both the NULLs and exclusion information
 	const ValidityMask *ignore_nulls_exclude;
+	//! The cursor over the payload values
+	unique_ptr<WindowCursor> cursor;
+	//! The cursor over the payload arguments of the current row
+	unique_ptr<WindowCursor> row_cursor;
 };
 
 //===--------------------------------------------------------------------===//
@@ -798,18 +813,13 @@ static void PrepareInputExpressions(vector<unique_ptr<Expression>> &exprs, Expre
 WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
                                const ValidityMask &partition_mask, const ValidityMask &order_mask)
     : wexpr(wexpr), context(context), payload_count(payload_count), partition_mask(partition_mask),
-      order_mask(order_mask), payload_collection(), payload_executor(context),
+      order_mask(order_mask), payload_executor(context),
       range((HasPrecedingRange(wexpr) || HasFollowingRange(wexpr)) ? wexpr.orders[0].expression.get() : nullptr,
             context, payload_count) {
 	// TODO: child may be a scalar, don't need to materialize the whole collection then
 
 	// evaluate inner expressions of window functions, could be more complex
 	PrepareInputExpressions(wexpr.children, payload_executor, payload_chunk);
-
-	auto types = payload_chunk.GetTypes();
-	if (!types.empty()) {
-		payload_collection.Initialize(Allocator::Get(context), types);
-	}
 }
 
 unique_ptr<WindowExecutorState> WindowExecutor::GetExecutorState() const {
@@ -918,20 +928,21 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 	    !ClientConfig::GetConfig(context).enable_optimizer || mode == WindowAggregationMode::SEPARATE;
 	AggregateObject aggr(wexpr);
 	if (force_naive || (wexpr.distinct && wexpr.exclude_clause != WindowExcludeMode::NO_OTHER)) {
-		aggregator = make_uniq<WindowNaiveAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+		aggregator = make_uniq<WindowNaiveAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count, context);
 	} else if (IsDistinctAggregate()) {
 		// build a merge sort tree
 		// see https://dl.acm.org/doi/pdf/10.1145/3514221.3526184
 		aggregator = make_uniq<WindowDistinctAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count, context);
 	} else if (IsConstantAggregate()) {
-		aggregator =
-		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
+		aggregator = make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause,
+		                                                 count, context);
 	} else if (IsCustomAggregate()) {
-		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count, context);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
-		aggregator = make_uniq<WindowSegmentTree>(aggr, wexpr.return_type, mode, wexpr.exclude_clause, count);
+		aggregator =
+		    make_uniq<WindowSegmentTree>(aggr, wexpr.return_type, mode, wexpr.exclude_clause, count, context);
 	}
 
 	// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
@@ -1029,7 +1040,7 @@ void WindowAggregateExecutor::Finalize() {
 	//	Estimate the frame statistics
 	//	Default to the entire partition if we don't know anything
 	FrameStats stats;
-	const int64_t count = aggregator->GetInputs().size();
+	const int64_t count = aggregator->GetInputCount();
 
 	//	First entry is the frame start
 	stats[0] = FrameDelta(-count, count);
@@ -1044,6 +1055,11 @@ void WindowAggregateExecutor::Finalize() {
 	aggregator->Finalize(stats);
 }
 
+void WindowAggregateExecutor::Build() {
+	D_ASSERT(aggregator);
+	aggregator->Build();
+}
+
 class WindowAggregateState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
@@ -1273,6 +1289,10 @@ WindowValueExecutor::WindowValueExecutor(BoundWindowExpression &wexpr, ClientCon
                                          const idx_t payload_count, const ValidityMask &partition_mask,
                                          const ValidityMask &order_mask)
     : WindowExecutor(wexpr, context, payload_count, partition_mask, order_mask) {
+	auto types = payload_chunk.GetTypes();
+	if (!types.empty()) {
+		payload_collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), types);
+	}
 }
 
 WindowNtileExecutor::WindowNtileExecutor(BoundWindowExpression &wexpr, ClientContext &context,
@@ -1305,7 +1325,7 @@ void WindowValueExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, co
 		payload_chunk.Reset();
 		payload_executor.Execute(input_chunk, payload_chunk);
 		payload_chunk.Verify();
-		payload_collection.Append(payload_chunk, true);
+		payload_collection->Append(payload_chunk);
 
 		// process payload chunks while they are still piping hot
 		if (check_nulls) {
@@ -1341,26 +1361,23 @@ void WindowValueExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, co
 }
 
 unique_ptr<WindowExecutorState> WindowValueExecutor::GetExecutorState() const {
-	if (wexpr.type == ExpressionType::WINDOW_FIRST_VALUE || wexpr.type == ExpressionType::WINDOW_LAST_VALUE ||
-	    wexpr.type == ExpressionType::WINDOW_NTH_VALUE) {
-		return make_uniq<WindowValueState>(wexpr, context, payload_count, partition_mask, order_mask, ignore_nulls);
-	} else {
-		return make_uniq<WindowExecutorBoundsState>(wexpr, context, payload_count, partition_mask, order_mask);
-	}
+	return make_uniq<WindowValueState>(wexpr, context, payload_count, partition_mask, order_mask, ignore_nulls,
+	                                   payload_collection.get());
 }
 
 void WindowNtileExecutor::EvaluateInternal(WindowExecutorState &lstate, Vector &result, idx_t count,
                                            idx_t row_idx) const {
-	D_ASSERT(payload_collection.ColumnCount() == 1);
-	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
-	auto partition_begin = FlatVector::GetData<const idx_t>(lbstate.bounds.data[PARTITION_BEGIN]);
-	auto partition_end = FlatVector::GetData<const idx_t>(lbstate.bounds.data[PARTITION_END]);
+	D_ASSERT(payload_collection->ColumnCount() == 1);
+	auto &lvstate = lstate.Cast<WindowValueState>();
+	auto &cursor = *lvstate.cursor;
+	auto partition_begin = FlatVector::GetData<const idx_t>(lvstate.bounds.data[PARTITION_BEGIN]);
+	auto partition_end = FlatVector::GetData<const idx_t>(lvstate.bounds.data[PARTITION_END]);
 	auto rdata = FlatVector::GetData<int64_t>(result);
 	for (idx_t i = 0; i < count; ++i, ++row_idx) {
-		if (CellIsNull(payload_collection, 0, row_idx)) {
+		if (CellIsNull(cursor, 0, row_idx)) {
 			FlatVector::SetNull(result, i, true);
 		} else {
-			auto n_param = GetCell<int64_t>(payload_collection, 0, row_idx);
+			auto n_param = GetCell<int64_t>(cursor, 0, row_idx);
 			if (n_param < 1) {
 				throw InvalidInputException("Argument for ntile must be greater than zero");
 			}
@@ -1397,11 +1414,12 @@ void WindowNtileExecutor::EvaluateInternal(WindowExecutorState &lstate, Vector &
 //===--------------------------------------------------------------------===//
 // WindowLeadLagState
 //===--------------------------------------------------------------------===//
-class WindowLeadLagState : public WindowExecutorBoundsState {
+class WindowLeadLagState : public WindowValueState {
 public:
 	WindowLeadLagState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
-	                   const ValidityMask &partition_mask, const ValidityMask &order_mask)
-	    : WindowExecutorBoundsState(wexpr, context, payload_count, partition_mask, order_mask),
+	                   const ValidityMask &partition_mask, const ValidityMask &order_mask,
+	                   const ValidityMask &ignore_nulls, optional_ptr<const ColumnDataCollection> payload_collection)
+	    : WindowValueState(wexpr, context, payload_count, partition_mask, order_mask, ignore_nulls, payload_collection),
 	      leadlag_offset(wexpr.offset_expr.get(), context), leadlag_default(wexpr.default_expr.get(), context) {
 	}
 
@@ -1428,7 +1446,8 @@ WindowLeadLagExecutor::WindowLeadLagExecutor(BoundWindowExpression &wexpr, Clien
 }
 
 unique_ptr<WindowExecutorState> WindowLeadLagExecutor::GetExecutorState() const {
-	return make_uniq<WindowLeadLagState>(wexpr, context, payload_count, partition_mask, order_mask);
+	return make_uniq<WindowLeadLagState>(wexpr, context, payload_count, partition_mask, order_mask, ignore_nulls,
+	                                     payload_collection.get());
 }
 
 void WindowLeadLagExecutor::EvaluateInternal(WindowExecutorState &lstate, Vector &result, idx_t count,
@@ -1461,7 +1480,7 @@ void WindowLeadLagExecutor::EvaluateInternal(WindowExecutorState &lstate, Vector
 		// else offset is zero, so don't move.
 
 		if (!delta) {
-			CopyCell(payload_collection, 0, val_idx, result, i);
+			CopyCell(*llstate.cursor, 0, val_idx, result, i);
 		} else if (wexpr.default_expr) {
 			llstate.leadlag_default.CopyCell(result, i);
 		} else {
@@ -1495,7 +1514,7 @@ void WindowFirstValueExecutor::EvaluateInternal(WindowExecutorState &lstate, Vec
 		idx_t n = 1;
 		const auto first_idx = FindNextStart(*lvstate.ignore_nulls_exclude, window_begin[i], window_end[i], n);
 		if (!n) {
-			CopyCell(payload_collection, 0, first_idx, result, i);
+			CopyCell(*lvstate.cursor, 0, first_idx, result, i);
 		} else {
 			FlatVector::SetNull(result, i, true);
 		}
@@ -1530,7 +1549,7 @@ void WindowLastValueExecutor::EvaluateInternal(WindowExecutorState &lstate, Vect
 		idx_t n = 1;
 		const auto last_idx = FindPrevStart(*lvstate.ignore_nulls_exclude, window_begin[i], window_end[i], n);
 		if (!n) {
-			CopyCell(payload_collection, 0, last_idx, result, i);
+			CopyCell(*lvstate.cursor, 0, last_idx, result, i);
 		} else {
 			FlatVector::SetNull(result, i, true);
 		}
@@ -1549,7 +1568,7 @@ WindowNthValueExecutor::WindowNthValueExecutor(BoundWindowExpression &wexpr, Cli
 
 void WindowNthValueExecutor::EvaluateInternal(WindowExecutorState &lstate, Vector &result, idx_t count,
                                               idx_t row_idx) const {
-	D_ASSERT(payload_collection.ColumnCount() == 2);
+	D_ASSERT(payload_collection->ColumnCount() == 2);
 
 	auto &lvstate = lstate.Cast<WindowValueState>();
 	auto window_begin = FlatVector::GetData<const idx_t>(lvstate.bounds.data[WINDOW_BEGIN]);
@@ -1566,17 +1585,17 @@ void WindowNthValueExecutor::EvaluateInternal(WindowExecutorState &lstate, Vecto
 		}
 		// Returns value evaluated at the row that is the n'th row of the window frame (counting from 1);
 		// returns NULL if there is no such row.
-		if (CellIsNull(payload_collection, 1, row_idx)) {
+		if (CellIsNull(*lvstate.row_cursor, 1, row_idx)) {
 			FlatVector::SetNull(result, i, true);
 		} else {
-			auto n_param = GetCell<int64_t>(payload_collection, 1, row_idx);
+			auto n_param = GetCell<int64_t>(*lvstate.row_cursor, 1, row_idx);
 			if (n_param < 1) {
 				FlatVector::SetNull(result, i, true);
 			} else {
 				auto n = idx_t(n_param);
 				const auto nth_index = FindNextStart(*lvstate.ignore_nulls_exclude, window_begin[i], window_end[i], n);
 				if (!n) {
-					CopyCell(payload_collection, 0, nth_index, result, i);
+					CopyCell(*lvstate.cursor, 0, nth_index, result, i);
 				} else {
 					FlatVector::SetNull(result, i, true);
 				}
@@ -6,12 +6,55 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer/buffer_handle.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 #include <numeric>
 #include <utility>
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// WindowStateArray
+//===--------------------------------------------------------------------===//
+data_ptr_t WindowStateArray::Allocate(ClientContext &context, idx_t size, BufferHandle &pin) {
+	if (size < Storage::BLOCK_SIZE) {
+		data = make_unsafe_uniq_array<data_t>(size);
+		return data.get();
+	}
+	buffer_manager = &BufferManager::GetBufferManager(context);
+	pin = buffer_manager->Allocate(MemoryTag::WINDOW, size, false, &block);
+	return pin.Ptr();
+}
+
+data_ptr_t WindowStateArray::Pin(BufferHandle &pin) const {
+	if (!block) {
+		return data.get();
+	}
+	pin = buffer_manager->Pin(block);
+	return pin.Ptr();
+}
+
+//===--------------------------------------------------------------------===//
+// WindowCursor
+//===--------------------------------------------------------------------===//
+WindowCursor::WindowCursor(const ColumnDataCollection &collection)
+    : collection(collection), chunk_begin(0), chunk_end(0) {
+	collection.InitializeScanChunk(chunk);
+}
+
+void WindowCursor::FetchChunk(idx_t row) {
+	//	Every chunk but the last one is full
+	D_ASSERT(row < collection.Count());
+	const auto chunk_idx = row / STANDARD_VECTOR_SIZE;
+	chunk.Reset();
+	collection.FetchChunk(chunk_idx, chunk);
+	chunk_begin = chunk_idx * STANDARD_VECTOR_SIZE;
+	chunk_end = chunk_begin + chunk.size();
+	D_ASSERT(RowIsVisible(row));
+}
+
 //===--------------------------------------------------------------------===//
 // WindowAggregator
 //===--------------------------------------------------------------------===//
@@ -19,20 +62,31 @@ WindowAggregatorState::WindowAggregatorState() : allocator(Allocator::DefaultAll
 }
 
 WindowAggregator::WindowAggregator(AggregateObject aggr_p, const LogicalType &result_type_p,
-                                   const WindowExcludeMode exclude_mode_p, idx_t partition_count_p)
+                                   const WindowExcludeMode exclude_mode_p, idx_t partition_count_p,
+                                   ClientContext &context)
     : aggr(std::move(aggr_p)), result_type(result_type_p), partition_count(partition_count_p),
-      state_size(aggr.function.state_size()), filter_pos(0), exclude_mode(exclude_mode_p) {
+      state_size(aggr.function.state_size()), context(context), use_flat_inputs(false), filter_pos(0), build_stage(0),
+      build_tasks(0), build_started(0), build_completed(0), build_failed(false), exclude_mode(exclude_mode_p) {
 }
 
 WindowAggregator::~WindowAggregator() {
 }
 
 void WindowAggregator::Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) {
-	if (!inputs.ColumnCount() && payload_chunk.ColumnCount()) {
-		inputs.Initialize(Allocator::DefaultAllocator(), payload_chunk.GetTypes());
-	}
-	if (inputs.ColumnCount()) {
-		inputs.Append(payload_chunk, true);
+	if (use_flat_inputs) {
+		if (!flat_inputs.ColumnCount() && payload_chunk.ColumnCount()) {
+			//	Allocate the whole partition up front so it is accounted for and never reallocated
+			flat_inputs.Initialize(BufferAllocator::Get(context), payload_chunk.GetTypes(), partition_count);
+		}
+		if (flat_inputs.ColumnCount()) {
+			flat_inputs.Append(payload_chunk, true);
+		}
+	} else if (payload_chunk.ColumnCount()) {
+		if (!inputs) {
+			auto &buffer_manager = BufferManager::GetBufferManager(context);
+			inputs = make_uniq<ColumnDataCollection>(buffer_manager, payload_chunk.GetTypes());
+		}
+		inputs->Append(payload_chunk);
 	}
 	if (filter_sel) {
 		//	Lazy instantiation
@@ -51,14 +105,79 @@ void WindowAggregator::Sink(DataChunk &payload_chunk, SelectionVector *filter_se
 void WindowAggregator::Finalize(const FrameStats &stats) {
 }
 
+void WindowAggregator::StartBuild(idx_t task_count) {
+	lock_guard<mutex> guard(build_lock);
+	build_stage = 0;
+	build_tasks = task_count;
+	build_started = 0;
+	build_completed = 0;
+}
+
+void WindowAggregator::Build() {
+	//	The states are created lazily, so threads that arrive late do not allocate anything
+	unique_ptr<WindowAggregatorState> build_state;
+	unique_lock<mutex> guard(build_lock);
+	while (true) {
+		//	Wait until there is a task to claim, the build is complete or another thread has failed
+		build_cv.wait(guard, [&]() { return build_failed || !build_tasks || build_started < build_tasks; });
+		if (build_failed) {
+			build_error.Throw();
+		}
+		if (!build_tasks) {
+			//	Keep the state alive, as it owns the memory of the aggregate states it built
+			if (build_state) {
+				build_states.emplace_back(std::move(build_state));
+			}
+			return;
+		}
+		const auto stage = build_stage;
+		const auto task_idx = build_started++;
+		guard.unlock();
+
+		ErrorData error;
+		try {
+			if (!build_state) {
+				build_state = GetLocalState();
+			}
+			BuildTask(*build_state, stage, task_idx);
+
+			guard.lock();
+			if (++build_completed == build_tasks) {
+				build_tasks = FinishBuildStage(build_stage++);
+				build_started = 0;
+				build_completed = 0;
+				build_cv.notify_all();
+			}
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		} catch (...) { // LCOV_EXCL_START
+			error = ErrorData("Unknown exception in window build");
+		} // LCOV_EXCL_STOP
+
+		if (error.HasError()) {
+			//	Only the first error is reported, by this thread and by all the others
+			if (!guard.owns_lock()) {
+				guard.lock();
+			}
+			if (!build_failed) {
+				build_failed = true;
+				build_error = std::move(error);
+			}
+			build_cv.notify_all();
+			build_error.Throw();
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // WindowConstantAggregate
 //===--------------------------------------------------------------------===//
 WindowConstantAggregator::WindowConstantAggregator(AggregateObject aggr, const LogicalType &result_type,
                                                    const ValidityMask &partition_mask,
-                                                   const WindowExcludeMode exclude_mode_p, const idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), partition(0), row(0), state(state_size),
-      statep(Value::POINTER(CastPointerToValue(state.data()))),
+                                                   const WindowExcludeMode exclude_mode_p, const idx_t count,
+                                                   ClientContext &context)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count, context), partition(0), row(0),
+      state(state_size), statep(Value::POINTER(CastPointerToValue(state.data()))),
       statef(Value::POINTER(CastPointerToValue(state.data()))) {
 
 	statef.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
@@ -117,8 +236,8 @@ void WindowConstantAggregator::Sink(DataChunk &payload_chunk, SelectionVector *f
 	const auto chunk_begin = row;
 	const auto chunk_end = chunk_begin + payload_chunk.size();
 
-	if (!inputs.ColumnCount() && payload_chunk.ColumnCount()) {
-		inputs.Initialize(Allocator::DefaultAllocator(), payload_chunk.GetTypes());
+	if (!slice.ColumnCount() && payload_chunk.ColumnCount()) {
+		slice.Initialize(Allocator::DefaultAllocator(), payload_chunk.GetTypes());
 	}
 
 	AggregateInputData aggr_input_data(aggr.GetFunctionData(), gstate->allocator);
@@ -134,7 +253,7 @@ void WindowConstantAggregator::Sink(DataChunk &payload_chunk, SelectionVector *f
 		partition_end = MinValue(partition_end, chunk_end);
 		auto end = partition_end - chunk_begin;
 
-		inputs.Reset();
+		slice.Reset();
 		if (filter_sel) {
 			// 	Slice to any filtered rows in [begin, end)
 			SelectionVector sel;
@@ -157,27 +276,27 @@ void WindowConstantAggregator::Sink(DataChunk &payload_chunk, SelectionVector *f
 				}
 			}
 
-			if (nsel != inputs.size()) {
-				inputs.Slice(payload_chunk, sel, nsel);
+			if (nsel != slice.size()) {
+				slice.Slice(payload_chunk, sel, nsel);
 			}
 		} else {
 			//	Slice to [begin, end)
 			if (begin) {
 				for (idx_t c = 0; c < payload_chunk.ColumnCount(); ++c) {
-					inputs.data[c].Slice(payload_chunk.data[c], begin, end);
+					slice.data[c].Slice(payload_chunk.data[c], begin, end);
 				}
 			} else {
-				inputs.Reference(payload_chunk);
+				slice.Reference(payload_chunk);
 			}
-			inputs.SetCardinality(end - begin);
+			slice.SetCardinality(end - begin);
 		}
 
 		//	Aggregate the filtered rows into a single state
-		const auto count = inputs.size();
+		const auto count = slice.size();
 		if (aggr.function.simple_update) {
-			aggr.function.simple_update(inputs.data.data(), aggr_input_data, inputs.ColumnCount(), state.data(), count);
+			aggr.function.simple_update(slice.data.data(), aggr_input_data, slice.ColumnCount(), state.data(), count);
 		} else {
-			aggr.function.update(inputs.data.data(), aggr_input_data, inputs.ColumnCount(), statep, count);
+			aggr.function.update(slice.data.data(), aggr_input_data, slice.ColumnCount(), statep, count);
 		}
 
 		//	Skip filtered rows too!
@@ -242,8 +361,11 @@ void WindowConstantAggregator::Evaluate(WindowAggregatorState &lstate, const Dat
 // WindowCustomAggregator
 //===--------------------------------------------------------------------===//
 WindowCustomAggregator::WindowCustomAggregator(AggregateObject aggr, const LogicalType &result_type,
-                                               const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count) {
+                                               const WindowExcludeMode exclude_mode_p, idx_t count,
+                                               ClientContext &context)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count, context) {
+	//	The window API reads the partition through flat vectors
+	use_flat_inputs = true;
 }
 
 WindowCustomAggregator::~WindowCustomAggregator() {
@@ -301,8 +423,8 @@ WindowCustomAggregatorState::~WindowCustomAggregatorState() {
 
 void WindowCustomAggregator::Finalize(const FrameStats &stats) {
 	WindowAggregator::Finalize(stats);
-	partition_input =
-	    make_uniq<WindowPartitionInput>(inputs.data.data(), inputs.ColumnCount(), inputs.size(), filter_mask, stats);
+	partition_input = make_uniq<WindowPartitionInput>(flat_inputs.data.data(), flat_inputs.ColumnCount(),
+	                                                  flat_inputs.size(), filter_mask, stats);
 
 	if (aggr.function.window_init) {
 		gstate = GetLocalState();
@@ -395,8 +517,9 @@ void WindowCustomAggregator::Evaluate(WindowAggregatorState &lstate, const DataC
 // WindowNaiveAggregator
 //===--------------------------------------------------------------------===//
 WindowNaiveAggregator::WindowNaiveAggregator(AggregateObject aggr, const LogicalType &result_type,
-                                             const WindowExcludeMode exclude_mode_p, idx_t partition_count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, partition_count) {
+                                             const WindowExcludeMode exclude_mode_p, idx_t partition_count,
+                                             ClientContext &context)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, partition_count, context) {
 }
 
 WindowNaiveAggregator::~WindowNaiveAggregator() {
@@ -449,6 +572,11 @@ protected:
 	Vector statef;
 	//! A vector of pointers to "state", used for buffering intermediate aggregates
 	Vector statep;
+	//! The cursor over the partition rows being aggregated
+	unique_ptr<WindowCursor> cursor;
+	//! The cursors over the partition rows being hashed and compared for DISTINCT
+	unique_ptr<WindowCursor> lhs_cursor;
+	unique_ptr<WindowCursor> rhs_cursor;
 	//! Input data chunk, used for leaf segment aggregation
 	DataChunk leaves;
 	//! The rows beging updated.
@@ -470,9 +598,14 @@ WindowNaiveState::WindowNaiveState(const WindowNaiveAggregator &gstate)
       row_set(STANDARD_VECTOR_SIZE, hash_row, equal_row) {
 	InitSubFrames(frames, gstate.exclude_mode);
 
-	auto &inputs = gstate.GetInputs();
-	if (inputs.ColumnCount() > 0) {
-		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	auto inputs = gstate.GetInputs();
+	if (inputs) {
+		cursor = make_uniq<WindowCursor>(*inputs);
+		if (gstate.aggr.IsDistinct()) {
+			lhs_cursor = make_uniq<WindowCursor>(*inputs);
+			rhs_cursor = make_uniq<WindowCursor>(*inputs);
+		}
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs->Types());
 	}
 
 	update_sel.Initialize();
@@ -494,8 +627,9 @@ void WindowNaiveState::FlushStates() {
 		return;
 	}
 
-	auto &inputs = gstate.GetInputs();
-	leaves.Slice(inputs, update_sel, flush_count);
+	if (cursor) {
+		leaves.Slice(cursor->chunk, update_sel, flush_count);
+	}
 
 	auto &aggr = gstate.aggr;
 	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
@@ -505,31 +639,29 @@ void WindowNaiveState::FlushStates() {
 }
 
 size_t WindowNaiveState::Hash(idx_t rid) {
-	auto &inputs = gstate.GetInputs();
-
-	auto s = UnsafeNumericCast<sel_t>(rid);
+	D_ASSERT(lhs_cursor);
+	auto s = UnsafeNumericCast<sel_t>(lhs_cursor->Seek(rid));
 	SelectionVector sel(&s);
-	leaves.Slice(inputs, sel, 1);
+	leaves.Slice(lhs_cursor->chunk, sel, 1);
 	leaves.Hash(hashes);
 
 	return *FlatVector::GetData<hash_t>(hashes);
 }
 
 bool WindowNaiveState::KeyEqual(const idx_t &lhs, const idx_t &rhs) {
-	auto &inputs = gstate.GetInputs();
-
-	auto l = UnsafeNumericCast<sel_t>(lhs);
+	D_ASSERT(lhs_cursor && rhs_cursor);
+	auto l = UnsafeNumericCast<sel_t>(lhs_cursor->Seek(lhs));
 	SelectionVector lsel(&l);
 
-	auto r = UnsafeNumericCast<sel_t>(rhs);
+	auto r = UnsafeNumericCast<sel_t>(rhs_cursor->Seek(rhs));
 	SelectionVector rsel(&r);
 
 	sel_t f = 0;
 	SelectionVector fsel(&f);
 
-	for (auto &input : inputs.data) {
-		Vector left(input, lsel, 1);
-		Vector right(input, rsel, 1);
+	for (column_t c = 0; c < lhs_cursor->chunk.ColumnCount(); ++c) {
+		Vector left(lhs_cursor->chunk.data[c], lsel, 1);
+		Vector right(rhs_cursor->chunk.data[c], rsel, 1);
 		if (!VectorOperations::NotDistinctFrom(left, right, nullptr, 1, nullptr, &fsel)) {
 			return false;
 		}
@@ -562,8 +694,17 @@ void WindowNaiveState::Evaluate(const DataChunk &bounds, Vector &result, idx_t c
 					continue;
 				}
 
+				//	The buffered rows must all come from the same chunk
+				auto f_idx = f;
+				if (cursor) {
+					if (!cursor->RowIsVisible(f)) {
+						FlushStates();
+					}
+					f_idx = cursor->Seek(f);
+				}
+
 				pdata[flush_count] = agg_state;
-				update_sel[flush_count++] = UnsafeNumericCast<sel_t>(f);
+				update_sel[flush_count++] = UnsafeNumericCast<sel_t>(f_idx);
 				if (flush_count >= STANDARD_VECTOR_SIZE) {
 					FlushStates();
 				}
@@ -598,15 +739,16 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
-                                     const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+                                     const WindowExcludeMode exclude_mode_p, idx_t count, ClientContext &context)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count, context), internal_nodes(0),
+      mode(mode_p) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
 	WindowAggregator::Finalize(stats);
 
 	gstate = GetLocalState();
-	if (inputs.ColumnCount() > 0) {
+	if (inputs) {
 		if (aggr.function.combine && UseCombineAPI()) {
 			ConstructTree();
 		}
@@ -620,11 +762,13 @@ WindowSegmentTree::~WindowSegmentTree() {
 	}
 	AggregateInputData aggr_input_data(aggr.GetFunctionData(), gstate->allocator);
 	// call the destructor for all the intermediate states
+	BufferHandle levels_pin;
+	auto levels = levels_flat_native.Pin(levels_pin);
 	data_ptr_t address_data[STANDARD_VECTOR_SIZE];
 	Vector addresses(LogicalType::POINTER, data_ptr_cast(address_data));
 	idx_t count = 0;
 	for (idx_t i = 0; i < internal_nodes; i++) {
-		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state_size);
+		address_data[count++] = data_ptr_t(levels + i * state_size);
 		if (count == STANDARD_VECTOR_SIZE) {
 			aggr.function.destructor(addresses, aggr_input_data, count);
 			count = 0;
@@ -642,12 +786,14 @@ public:
 
 	enum FramePart : uint8_t { FULL = 0, LEFT = 1, RIGHT = 2 };
 
-	WindowSegmentTreePart(ArenaAllocator &allocator, const AggregateObject &aggr, const DataChunk &inputs,
-	                      const ValidityMask &filter_mask);
+	WindowSegmentTreePart(ArenaAllocator &allocator, const AggregateObject &aggr,
+	                      optional_ptr<const ColumnDataCollection> inputs, const ValidityMask &filter_mask);
 	~WindowSegmentTreePart();
 
 	unique_ptr<WindowSegmentTreePart> Copy() const {
-		return make_uniq<WindowSegmentTreePart>(allocator, aggr, inputs, filter_mask);
+		auto result = make_uniq<WindowSegmentTreePart>(allocator, aggr, inputs, filter_mask);
+		result->levels = levels;
+		return result;
 	}
 
 	void FlushStates(bool combining);
@@ -679,16 +825,20 @@ public:
 	//! Order insensitive aggregate (we can optimise internal combines)
 	const bool order_insensitive;
 	//! The partition arguments
-	const DataChunk &inputs;
+	optional_ptr<const ColumnDataCollection> inputs;
 	//! The filtered rows in inputs
 	const ValidityMask &filter_mask;
 	//! The size of a single aggregate state
 	const idx_t state_size;
+	//! The cursor over the partition arguments
+	unique_ptr<WindowCursor> cursor;
+	//! The (pinned) internal nodes of the tree
+	data_ptr_t levels;
 	//! Data pointer that contains a vector of states, used for intermediate window segment aggregation
 	vector<data_t> state;
 	//! Input data chunk, used for leaf segment aggregation
 	DataChunk leaves;
-	//! The filtered rows in inputs.
+	//! The filtered rows in the cursor chunk
 	SelectionVector filter_sel;
 	//! A vector of pointers to "state", used for intermediate window segment aggregation
 	Vector statep;
@@ -704,14 +854,15 @@ public:
 
 class WindowSegmentTreeState : public WindowAggregatorState {
 public:
-	WindowSegmentTreeState(const AggregateObject &aggr, const DataChunk &inputs, const ValidityMask &filter_mask)
+	WindowSegmentTreeState(const AggregateObject &aggr, optional_ptr<const ColumnDataCollection> inputs,
+	                       const ValidityMask &filter_mask)
 	    : aggr(aggr), inputs(inputs), filter_mask(filter_mask), part(allocator, aggr, inputs, filter_mask) {
 	}
 
 	//! The aggregate function
 	const AggregateObject &aggr;
-	//! The aggregate function
-	const DataChunk &inputs;
+	//! The partition arguments
+	optional_ptr<const ColumnDataCollection> inputs;
 	//! The filtered rows in inputs
 	const ValidityMask &filter_mask;
 	//! The left (default) segment tree part
@@ -721,13 +872,16 @@ public:
 };
 
 WindowSegmentTreePart::WindowSegmentTreePart(ArenaAllocator &allocator, const AggregateObject &aggr,
-                                             const DataChunk &inputs, const ValidityMask &filter_mask)
+                                             optional_ptr<const ColumnDataCollection> inputs,
+                                             const ValidityMask &filter_mask)
     : allocator(allocator), aggr(aggr),
       order_insensitive(aggr.function.order_dependent == AggregateOrderDependent::NOT_ORDER_DEPENDENT), inputs(inputs),
-      filter_mask(filter_mask), state_size(aggr.function.state_size()), state(state_size * STANDARD_VECTOR_SIZE),
+      filter_mask(filter_mask), state_size(aggr.function.state_size()), levels(nullptr),
+      state(state_size * STANDARD_VECTOR_SIZE),
       statep(LogicalType::POINTER), statel(LogicalType::POINTER), statef(LogicalType::POINTER), flush_count(0) {
-	if (inputs.ColumnCount() > 0) {
-		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	if (inputs) {
+		cursor = make_uniq<WindowCursor>(*inputs);
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs->Types());
 		filter_sel.Initialize();
 	}
 
@@ -747,7 +901,7 @@ WindowSegmentTreePart::~WindowSegmentTreePart() {
 }
 
 unique_ptr<WindowAggregatorState> WindowSegmentTree::GetLocalState() const {
-	return make_uniq<WindowSegmentTreeState>(aggr, inputs, filter_mask);
+	return make_uniq<WindowSegmentTreeState>(aggr, inputs.get(), filter_mask);
 }
 
 void WindowSegmentTreePart::FlushStates(bool combining) {
@@ -760,7 +914,7 @@ void WindowSegmentTreePart::FlushStates(bool combining) {
 		statel.Verify(flush_count);
 		aggr.function.combine(statel, statep, aggr_input_data, flush_count);
 	} else {
-		leaves.Slice(inputs, filter_sel, flush_count);
+		leaves.Slice(cursor->chunk, filter_sel, flush_count);
 		aggr.function.update(&leaves.data[0], aggr_input_data, leaves.ColumnCount(), statep, flush_count);
 	}
 
@@ -773,29 +927,20 @@ void WindowSegmentTreePart::Combine(WindowSegmentTreePart &other, idx_t count) {
 }
 
 void WindowSegmentTreePart::ExtractFrame(idx_t begin, idx_t end, data_ptr_t state_ptr) {
-	const auto count = end - begin;
-
-	//	If we are not filtering,
-	//	just update the shared dictionary selection to the range
-	//	Otherwise set it to the input rows that pass the filter
+	//	Set the shared dictionary selection to the input rows that pass the filter.
+	//	The buffered rows must all come from the same chunk, so flush them before moving to another one.
 	auto states = FlatVector::GetData<data_ptr_t>(statep);
-	if (filter_mask.AllValid()) {
-		for (idx_t i = 0; i < count; ++i) {
-			states[flush_count] = state_ptr;
-			filter_sel.set_index(flush_count++, begin + i);
-			if (flush_count >= STANDARD_VECTOR_SIZE) {
-				FlushStates(false);
-			}
+	for (idx_t i = begin; i < end; ++i) {
+		if (!filter_mask.RowIsValid(i)) {
+			continue;
 		}
-	} else {
-		for (idx_t i = begin; i < end; ++i) {
-			if (filter_mask.RowIsValid(i)) {
-				states[flush_count] = state_ptr;
-				filter_sel.set_index(flush_count++, i);
-				if (flush_count >= STANDARD_VECTOR_SIZE) {
-					FlushStates(false);
-				}
-			}
+		if (!cursor->RowIsVisible(i)) {
+			FlushStates(false);
+		}
+		states[flush_count] = state_ptr;
+		filter_sel.set_index(flush_count++, cursor->Seek(i));
+		if (flush_count >= STANDARD_VECTOR_SIZE) {
+			FlushStates(false);
 		}
 	}
 }
@@ -803,7 +948,7 @@ void WindowSegmentTreePart::ExtractFrame(idx_t begin, idx_t end, data_ptr_t stat
 void WindowSegmentTreePart::WindowSegmentValue(const WindowSegmentTree &tree, idx_t l_idx, idx_t begin, idx_t end,
                                                data_ptr_t state_ptr) {
 	D_ASSERT(begin <= end);
-	if (begin == end || inputs.ColumnCount() == 0) {
+	if (begin == end || !inputs) {
 		return;
 	}
 
@@ -812,7 +957,7 @@ void WindowSegmentTreePart::WindowSegmentValue(const WindowSegmentTree &tree, id
 		ExtractFrame(begin, end, state_ptr);
 	} else {
 		// find out where the states begin
-		auto begin_ptr = tree.levels_flat_native.get() + state_size * (begin + tree.levels_flat_start[l_idx - 1]);
+		auto begin_ptr = levels + state_size * (begin + tree.levels_flat_start[l_idx - 1]);
 		// set up a vector of pointers that point towards the set of states
 		auto ldata = FlatVector::GetData<data_ptr_t>(statel);
 		auto pdata = FlatVector::GetData<data_ptr_t>(statep);
@@ -838,46 +983,71 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 }
 
 void WindowSegmentTree::ConstructTree() {
-	D_ASSERT(inputs.ColumnCount() > 0);
-
-	//	Use a temporary scan state to build the tree
-	auto &gtstate = gstate->Cast<WindowSegmentTreeState>().part;
+	D_ASSERT(inputs);
 
 	// compute space required to store internal nodes of segment tree
+	// level 0 is data itself, and levels_flat_start[l] is where level l + 1 begins
 	internal_nodes = 0;
-	idx_t level_nodes = inputs.size();
+	levels_flat_start.push_back(0);
+	idx_t level_nodes = inputs->Count();
 	do {
 		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
 		internal_nodes += level_nodes;
+		if (level_nodes) {
+			levels_flat_start.push_back(internal_nodes);
+		}
 	} while (level_nodes > 1);
-	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
-	levels_flat_start.push_back(0);
+	BufferHandle levels_pin;
+	auto levels = levels_flat_native.Allocate(context, internal_nodes * state_size, levels_pin);
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
+	// Corner case: single element in the window
+	if (inputs->Count() <= 1) {
+		levels_flat_start.resize(1);
+		if (internal_nodes) {
+			aggr.function.initialize(levels);
 		}
+		return;
+	}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+	//	The levels are built bottom up, each one in parallel
+	StartBuild(LevelTasks(0));
+}
+
+idx_t WindowSegmentTree::LevelTasks(idx_t level) const {
+	const auto level_nodes = levels_flat_start[level + 1] - levels_flat_start[level];
+	return (level_nodes + BUILD_NODES - 1) / BUILD_NODES;
+}
+
+void WindowSegmentTree::BuildTask(WindowAggregatorState &build_state, idx_t stage, idx_t task_idx) {
+	auto &gtstate = build_state.Cast<WindowSegmentTreeState>().part;
+	BufferHandle levels_pin;
+	auto levels = levels_flat_native.Pin(levels_pin);
+	gtstate.levels = levels;
+
+	//	Stage l builds level l + 1 from level l
+	const auto level_current = stage;
+	const auto level_size =
+	    level_current == 0 ? inputs->Count() : levels_flat_start[level_current] - levels_flat_start[level_current - 1];
+	const auto level_nodes = levels_flat_start[level_current + 1] - levels_flat_start[level_current];
+	const auto node_begin = task_idx * BUILD_NODES;
+	const auto node_end = MinValue(level_nodes, node_begin + BUILD_NODES);
+	for (auto node = node_begin; node < node_end; ++node) {
+		// compute the aggregate for this entry in the segment tree
+		const auto pos = node * TREE_FANOUT;
+		data_ptr_t state_ptr = levels + ((levels_flat_start[level_current] + node) * state_size);
+		aggr.function.initialize(state_ptr);
+		gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
+		gtstate.FlushStates(level_current > 0);
 	}
+	gtstate.levels = nullptr;
+}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggr.function.initialize(levels_flat_native.get());
+idx_t WindowSegmentTree::FinishBuildStage(idx_t stage) {
+	const auto next_level = stage + 1;
+	if (next_level + 1 >= levels_flat_start.size()) {
+		return 0;
 	}
+	return LevelTasks(next_level);
 }
 
 void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -889,7 +1059,10 @@ void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk
 	auto peer_begin = FlatVector::GetData<const idx_t>(bounds.data[PEER_BEGIN]);
 	auto peer_end = FlatVector::GetData<const idx_t>(bounds.data[PEER_END]);
 
+	//	Only keep the tree pinned while we are using it
+	BufferHandle levels_pin;
 	auto &part = ltstate.part;
+	part.levels = levels_flat_native.Pin(levels_pin);
 	if (exclude_mode != WindowExcludeMode::NO_OTHER) {
 		// 1. evaluate the tree left of the excluded part
 		part.Evaluate(*this, window_begin, peer_begin, result, count, row_idx, WindowSegmentTreePart::LEFT);
@@ -899,6 +1072,7 @@ void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk
 			ltstate.right_part = part.Copy();
 		}
 		auto &right_part = *ltstate.right_part;
+		right_part.levels = part.levels;
 
 		// 3. evaluate the tree right of the excluded part
 		right_part.Evaluate(*this, peer_end, window_end, result, count, row_idx, WindowSegmentTreePart::RIGHT);
@@ -922,8 +1096,10 @@ void WindowSegmentTreePart::Evaluate(const WindowSegmentTree &tree, const idx_t
 		//	First pass: aggregate the segment tree nodes with sharing
 		EvaluateUpperLevels(tree, begins, ends, count, row_idx, frame_part);
 
-		//	Second pass: aggregate the ragged leaves
-		EvaluateLeaves(tree, begins, ends, count, row_idx, frame_part, FramePart::FULL);
+		//	Second pass: aggregate the ragged leaves.
+		//	The left and right sides are aggregated separately so each side reads the partition in order.
+		EvaluateLeaves(tree, begins, ends, count, row_idx, frame_part, FramePart::LEFT);
+		EvaluateLeaves(tree, begins, ends, count, row_idx, frame_part, FramePart::RIGHT);
 	} else {
 		//	Evaluate leaves in order
 		EvaluateLeaves(tree, begins, ends, count, row_idx, frame_part, FramePart::LEFT);
@@ -1090,9 +1266,9 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTree &tree, const
 WindowDistinctAggregator::WindowDistinctAggregator(AggregateObject aggr, const LogicalType &result_type,
                                                    const WindowExcludeMode exclude_mode_p, idx_t count,
                                                    ClientContext &context)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), context(context),
-      allocator(Allocator::DefaultAllocator()) {
-
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count, context),
+      allocator(Allocator::DefaultAllocator()), distinct_stage(DistinctBuildStage::MERGE), build_level(0),
+      state_tasks(0), internal_nodes(0) {
 	payload_types.emplace_back(LogicalType::UBIGINT);
 	payload_chunk.Initialize(Allocator::DefaultAllocator(), payload_types);
 }
@@ -1104,11 +1280,13 @@ WindowDistinctAggregator::~WindowDistinctAggregator() {
 	}
 	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
 	// call the destructor for all the intermediate states
+	BufferHandle levels_pin;
+	auto levels = levels_flat_native.Pin(levels_pin);
 	data_ptr_t address_data[STANDARD_VECTOR_SIZE];
 	Vector addresses(LogicalType::POINTER, data_ptr_cast(address_data));
 	idx_t count = 0;
 	for (idx_t i = 0; i < internal_nodes; i++) {
-		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state_size);
+		address_data[count++] = data_ptr_t(levels + i * state_size);
 		if (count == STANDARD_VECTOR_SIZE) {
 			aggr.function.destructor(addresses, aggr_input_data, count);
 			count = 0;
@@ -1186,19 +1364,125 @@ public:
 	using ZippedTuple = std::tuple<idx_t, idx_t>;
 	using ZippedElements = vector<ZippedTuple>;
 
-	DistinctSortTree(ZippedElements &&prev_idcs, WindowDistinctAggregator &wda);
+	//! Compute the previous indices from the sorted arguments
+	void BuildPrevIdcs(WindowDistinctAggregator &wda);
+	//! Allocate the levels of the tree and of the aggregate states, returning the number of state tasks
+	idx_t AllocateStates(WindowDistinctAggregator &wda);
+	//! Build the aggregate states of a range of runs of a level
+	void BuildStates(WindowDistinctAggregator &wda, ArenaAllocator &allocator, idx_t level_nr, idx_t begin, idx_t end);
+	//! Build the aggregate states of a range of the leaf level, which each hold a single input row
+	void BuildLeafStates(WindowDistinctAggregator &wda, ArenaAllocator &allocator, idx_t begin, idx_t end);
+
+	//! Build the runs of a level of the zipped tree that belong to a task
+	void BuildZipped(idx_t level_nr, idx_t task_idx);
+	//! The number of tasks needed to build a level of the zipped tree
+	idx_t ZippedTasks(idx_t level_nr) const;
+	//! The number of elements of a level handled by a single task
+	idx_t TaskSize(idx_t level_nr) const;
+
+	//! The tree of (prev_idx, input_idx) pairs, which is only needed while building
+	MergeSortTree<ZippedTuple> zipped_tree;
+
+	//! The (approximate) number of elements handled by a single build task
+	static constexpr idx_t BUILD_ELEMENTS = 16 * STANDARD_VECTOR_SIZE;
 };
 
 void WindowDistinctAggregator::Finalize(const FrameStats &stats) {
 	//	5: Sort sorted lexicographically increasing
 	global_sort->AddLocalState(local_sort);
 	global_sort->PrepareMergePhase();
-	while (global_sort->sorted_blocks.size() > 1) {
+
+	//	The merge rounds and the tree levels are built by all the threads that call Build
+	merge_sort_tree = make_uniq<DistinctSortTree>();
+	if (global_sort->sorted_blocks.size() > 1) {
+		distinct_stage = DistinctBuildStage::MERGE;
 		global_sort->InitializeMergeRound();
+		StartBuild(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	} else {
+		distinct_stage = DistinctBuildStage::PREV_IDCS;
+		StartBuild(1);
+	}
+}
+
+void WindowDistinctAggregator::BuildTask(WindowAggregatorState &build_state, idx_t stage, idx_t task_idx) {
+	switch (distinct_stage) {
+	case DistinctBuildStage::MERGE: {
 		MergeSorter merge_sorter(*global_sort, global_sort->buffer_manager);
 		merge_sorter.PerformInMergeRound();
+		break;
+	}
+	case DistinctBuildStage::PREV_IDCS:
+		merge_sort_tree->BuildPrevIdcs(*this);
+		break;
+	case DistinctBuildStage::ZIPPED:
+		merge_sort_tree->BuildZipped(build_level, task_idx);
+		break;
+	case DistinctBuildStage::LEAF_STATES:
+	case DistinctBuildStage::STATES: {
+		//	The other levels combine the leaf states, so the leaves are built in a stage of their own
+		if (distinct_stage == DistinctBuildStage::STATES) {
+			task_idx += build_level_tasks[1];
+		}
+		//	Find the level of the task
+		auto level_nr = idx_t(std::upper_bound(build_level_tasks.begin(), build_level_tasks.end(), task_idx) -
+		                      build_level_tasks.begin()) -
+		                1;
+		const auto count = GetInputCount();
+		const auto task_size = merge_sort_tree->TaskSize(level_nr);
+		const auto begin = (task_idx - build_level_tasks[level_nr]) * task_size;
+		const auto end = MinValue(count, begin + task_size);
+		merge_sort_tree->BuildStates(*this, build_state.allocator, level_nr, begin, end);
+		break;
+	}
+	}
+}
+
+idx_t WindowDistinctAggregator::FinishBuildStage(idx_t stage) {
+	auto &zipped_tree = merge_sort_tree->zipped_tree;
+	switch (distinct_stage) {
+	case DistinctBuildStage::MERGE:
 		global_sort->CompleteMergeRound(true);
+		if (global_sort->sorted_blocks.size() > 1) {
+			global_sort->InitializeMergeRound();
+			return TaskScheduler::GetScheduler(context).NumberOfThreads();
+		}
+		distinct_stage = DistinctBuildStage::PREV_IDCS;
+		return 1;
+	case DistinctBuildStage::PREV_IDCS:
+		build_level = 1;
+		if (build_level < zipped_tree.tree.size()) {
+			distinct_stage = DistinctBuildStage::ZIPPED;
+			return merge_sort_tree->ZippedTasks(build_level);
+		}
+		distinct_stage = DistinctBuildStage::LEAF_STATES;
+		return merge_sort_tree->AllocateStates(*this);
+	case DistinctBuildStage::ZIPPED:
+		++build_level;
+		if (build_level < zipped_tree.tree.size()) {
+			return merge_sort_tree->ZippedTasks(build_level);
+		}
+		distinct_stage = DistinctBuildStage::LEAF_STATES;
+		return merge_sort_tree->AllocateStates(*this);
+	case DistinctBuildStage::LEAF_STATES:
+		if (build_level_tasks.size() > 1) {
+			distinct_stage = DistinctBuildStage::STATES;
+			return state_tasks - build_level_tasks[1];
+		}
+		//	The zipped tree is no longer needed
+		zipped_tree.tree.clear();
+		return 0;
+	case DistinctBuildStage::STATES:
+		//	The zipped tree is no longer needed
+		zipped_tree.tree.clear();
+		return 0;
 	}
+	return 0;
+}
+
+void WindowDistinctAggregator::DistinctSortTree::BuildPrevIdcs(WindowDistinctAggregator &wda) {
+	auto &global_sort = wda.global_sort;
+	auto &payload_types = wda.payload_types;
+	auto &sort_chunk = wda.sort_chunk;
 
 	DataChunk scan_chunk;
 	scan_chunk.Initialize(Allocator::DefaultAllocator(), payload_types);
@@ -1210,9 +1494,8 @@ void WindowDistinctAggregator::Finalize(const FrameStats &stats) {
 
 	//	6:	prevIdcs ← []
 	//	7:	prevIdcs[0] ← “-”
-	const auto count = inputs.size();
-	using ZippedTuple = DistinctSortTree::ZippedTuple;
-	DistinctSortTree::ZippedElements prev_idcs;
+	const auto count = wda.GetInputCount();
+	ZippedElements prev_idcs;
 	prev_idcs.resize(count);
 
 	//	To handle FILTER clauses we make the missing elements
@@ -1264,22 +1547,83 @@ void WindowDistinctAggregator::Finalize(const FrameStats &stats) {
 	}
 	//	13:	return prevIdcs
 
-	merge_sort_tree = make_uniq<DistinctSortTree>(std::move(prev_idcs), *this);
+	//	The upper levels of the zipped tree are built a range of runs at a time
+	zipped_tree.tree.emplace_back(std::move(prev_idcs), Offsets());
+	zipped_tree.AllocateLevels();
 }
 
-WindowDistinctAggregator::DistinctSortTree::DistinctSortTree(ZippedElements &&prev_idcs,
-                                                             WindowDistinctAggregator &wda) {
-	auto &inputs = wda.inputs;
-	auto &aggr = wda.aggr;
-	auto &allocator = wda.allocator;
+idx_t WindowDistinctAggregator::DistinctSortTree::TaskSize(idx_t level_nr) const {
+	//	Tasks consist of whole runs
+	idx_t level_width = 1;
+	for (idx_t i = 0; i < level_nr; ++i) {
+		level_width *= FANOUT;
+	}
+	const auto task_size = MaxValue<idx_t>(level_width, BUILD_ELEMENTS);
+	return ((task_size + level_width - 1) / level_width) * level_width;
+}
+
+void WindowDistinctAggregator::DistinctSortTree::BuildZipped(idx_t level_nr, idx_t task_idx) {
+	//	The runs of a level are as wide as the level, which divides the task size
+	idx_t run_length = 1;
+	for (idx_t i = 0; i < level_nr; ++i) {
+		run_length *= FANOUT;
+	}
+	const auto runs_per_task = TaskSize(level_nr) / run_length;
+	const auto run_end = MinValue(zipped_tree.RunCount(level_nr), (task_idx + 1) * runs_per_task);
+	for (auto run_idx = task_idx * runs_per_task; run_idx < run_end; ++run_idx) {
+		zipped_tree.BuildRun(level_nr, run_idx);
+	}
+}
+
+idx_t WindowDistinctAggregator::DistinctSortTree::ZippedTasks(idx_t level_nr) const {
+	const auto count = zipped_tree.tree.front().first.size();
+	const auto task_size = TaskSize(level_nr);
+	return (count + task_size - 1) / task_size;
+}
+
+idx_t WindowDistinctAggregator::DistinctSortTree::AllocateStates(WindowDistinctAggregator &wda) {
 	const auto state_size = wda.state_size;
 	auto &internal_nodes = wda.internal_nodes;
 	auto &levels_flat_native = wda.levels_flat_native;
 	auto &levels_flat_start = wda.levels_flat_start;
+	auto &build_level_tasks = wda.build_level_tasks;
 
-	//! Input data chunk, used for leaf segment aggregation
+	// compute space required to store aggregation states of merge sort tree
+	// this is one aggregate state per entry per level
+	internal_nodes = 0;
+	levels_flat_start.push_back(0);
+	tree.reserve(zipped_tree.tree.size());
+	idx_t task_count = 0;
+	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
+		auto &zipped_level = zipped_tree.tree[level_nr];
+		const auto level_size = zipped_level.first.size();
+		internal_nodes += level_size;
+		levels_flat_start.push_back(internal_nodes);
+
+		//	The tasks fill in the elements, but the cascading pointers are the same
+		tree.emplace_back(Elements(level_size), std::move(zipped_level.second));
+
+		build_level_tasks.push_back(task_count);
+		const auto task_size = TaskSize(level_nr);
+		task_count += (level_size + task_size - 1) / task_size;
+	}
+	BufferHandle levels_pin;
+	levels_flat_native.Allocate(wda.context, internal_nodes * state_size, levels_pin);
+
+	//	The leaf states are built first
+	wda.state_tasks = task_count;
+	return build_level_tasks.size() > 1 ? build_level_tasks[1] : task_count;
+}
+
+void WindowDistinctAggregator::DistinctSortTree::BuildLeafStates(WindowDistinctAggregator &wda,
+                                                                 ArenaAllocator &allocator, idx_t begin, idx_t end) {
+	auto &aggr = wda.aggr;
+	const auto state_size = wda.state_size;
+
+	//	The leaves are read in order, so only the chunk being aggregated has to be in memory
+	WindowCursor cursor(*wda.GetInputs());
 	DataChunk leaves;
-	leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	leaves.Initialize(Allocator::DefaultAllocator(), cursor.chunk.GetTypes());
 	SelectionVector sel;
 	sel.Initialize();
 
@@ -1288,90 +1632,104 @@ WindowDistinctAggregator::DistinctSortTree::DistinctSortTree(ZippedElements &&pr
 	//! The states to update
 	Vector update_v(LogicalType::POINTER);
 	auto updates = FlatVector::GetData<data_ptr_t>(update_v);
-	idx_t nupdate = 0;
 
+	BufferHandle levels_pin;
+	auto levels = wda.levels_flat_native.Pin(levels_pin);
+
+	auto &zipped_level = zipped_tree.tree[0].first;
+	auto &level = tree[0].first;
+	for (auto j = begin; j < end;) {
+		cursor.Seek(j);
+		const auto chunk_end = MinValue(end, cursor.chunk_end);
+		idx_t nupdate = 0;
+		for (; j < chunk_end; ++j) {
+			auto curr_state = levels + (wda.levels_flat_start[0] + j) * state_size;
+			aggr.function.initialize(curr_state);
+
+			//	Filtered rows point to themselves and are not aggregated
+			const auto prev_idx = std::get<0>(zipped_level[j]);
+			level[j] = prev_idx;
+			if (prev_idx < j + 1) {
+				updates[nupdate] = curr_state;
+				sel[nupdate] = UnsafeNumericCast<sel_t>(j - cursor.chunk_begin);
+				++nupdate;
+			}
+		}
+		leaves.Reference(cursor.chunk);
+		leaves.Slice(sel, nupdate);
+		aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
+	}
+}
+
+void WindowDistinctAggregator::DistinctSortTree::BuildStates(WindowDistinctAggregator &wda, ArenaAllocator &allocator,
+                                                             idx_t level_nr, idx_t begin, idx_t end) {
+	if (!level_nr) {
+		BuildLeafStates(wda, allocator, begin, end);
+		return;
+	}
+
+	auto &aggr = wda.aggr;
+	const auto state_size = wda.state_size;
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+
+	//	The states are combined in order, so a state is complete before it is combined into the next one
 	Vector source_v(LogicalType::POINTER);
 	auto sources = FlatVector::GetData<data_ptr_t>(source_v);
 	Vector target_v(LogicalType::POINTER);
 	auto targets = FlatVector::GetData<data_ptr_t>(target_v);
 	idx_t ncombine = 0;
 
-	// compute space required to store aggregation states of merge sort tree
-	// this is one aggregate state per entry per level
-	MergeSortTree<ZippedTuple> zipped_tree(std::move(prev_idcs));
-	internal_nodes = 0;
-	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
-		internal_nodes += zipped_tree.tree[level_nr].first.size();
-	}
-	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
-	levels_flat_start.push_back(0);
-	idx_t levels_flat_offset = 0;
+	BufferHandle levels_pin;
+	auto levels = wda.levels_flat_native.Pin(levels_pin);
+	auto levels_flat_offset = wda.levels_flat_start[level_nr] + begin;
+	//	Instead of reading the input rows in random order, the leaf states that aggregate them are combined
+	auto leaf_states = levels + wda.levels_flat_start[0] * state_size;
 
 	//	Walk the distinct value tree building the intermediate aggregates
-	tree.reserve(zipped_tree.tree.size());
 	idx_t level_width = 1;
-	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
-		auto &zipped_level = zipped_tree.tree[level_nr].first;
-		vector<ElementType> level;
-		level.reserve(zipped_level.size());
-
-		for (idx_t i = 0; i < zipped_level.size(); i += level_width) {
-			//	Reset the combine state
-			data_ptr_t prev_state = nullptr;
-			auto next_limit = MinValue<idx_t>(zipped_level.size(), i + level_width);
-			for (auto j = i; j < next_limit; ++j) {
-				//	Initialise the next aggregate
-				auto curr_state = levels_flat_native.get() + (levels_flat_offset++ * state_size);
-				aggr.function.initialize(curr_state);
-
-				//	Update this state (if it matches)
-				const auto prev_idx = std::get<0>(zipped_level[j]);
-				level.emplace_back(prev_idx);
-				if (prev_idx < i + 1) {
-					updates[nupdate] = curr_state;
-					//	input_idx
-					sel[nupdate] = UnsafeNumericCast<sel_t>(std::get<1>(zipped_level[j]));
-					++nupdate;
-				}
-
-				//	Merge the previous state (if any)
-				if (prev_state) {
-					sources[ncombine] = prev_state;
-					targets[ncombine] = curr_state;
-					++ncombine;
-				}
-				prev_state = curr_state;
-
-				//	Flush the states if one is maxed out.
-				if (MaxValue<idx_t>(ncombine, nupdate) >= STANDARD_VECTOR_SIZE) {
-					//	Push the updates first so they propagate
-					leaves.Reference(inputs);
-					leaves.Slice(sel, nupdate);
-					aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
-					nupdate = 0;
-
-					//	Combine the states sequentially
-					aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
-					ncombine = 0;
-				}
+	for (idx_t i = 0; i < level_nr; ++i) {
+		level_width *= FANOUT;
+	}
+	auto &zipped_level = zipped_tree.tree[level_nr].first;
+	auto &level = tree[level_nr].first;
+	for (idx_t i = begin; i < end; i += level_width) {
+		//	Reset the combine state
+		data_ptr_t prev_state = nullptr;
+		auto next_limit = MinValue<idx_t>(end, i + level_width);
+		for (auto j = i; j < next_limit; ++j) {
+			//	Initialise the next aggregate
+			auto curr_state = levels + (levels_flat_offset++ * state_size);
+			aggr.function.initialize(curr_state);
+
+			//	Update this state (if it matches)
+			const auto prev_idx = std::get<0>(zipped_level[j]);
+			level[j] = prev_idx;
+			if (prev_idx < i + 1) {
+				//	input_idx
+				sources[ncombine] = leaf_states + std::get<1>(zipped_level[j]) * state_size;
+				targets[ncombine] = curr_state;
+				++ncombine;
 			}
-		}
 
-		tree.emplace_back(std::move(level), std::move(zipped_tree.tree[level_nr].second));
+			//	Merge the previous state (if any)
+			if (prev_state) {
+				sources[ncombine] = prev_state;
+				targets[ncombine] = curr_state;
+				++ncombine;
+			}
+			prev_state = curr_state;
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_width *= FANOUT;
+			//	Flush the states if there is no space for the next element.
+			if (ncombine + 2 > STANDARD_VECTOR_SIZE) {
+				aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
+				ncombine = 0;
+			}
+		}
 	}
 
 	//	Flush any remaining states
-	if (ncombine || nupdate) {
-		//	Push  the updates
-		leaves.Reference(inputs);
-		leaves.Slice(sel, nupdate);
-		aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
-		nupdate = 0;
-
-		//	Combine the states sequentially
+	if (ncombine) {
 		aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
 		ncombine = 0;
 	}
@@ -1379,7 +1737,7 @@ WindowDistinctAggregator::DistinctSortTree::DistinctSortTree(ZippedElements &&pr
 
 class WindowDistinctState : public WindowAggregatorState {
 public:
-	WindowDistinctState(const AggregateObject &aggr, const DataChunk &inputs, const WindowDistinctAggregator &tree);
+	WindowDistinctState(const AggregateObject &aggr, const WindowDistinctAggregator &tree);
 
 	void Evaluate(const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx);
 
@@ -1389,8 +1747,6 @@ protected:
 
 	//! The aggregate function
 	const AggregateObject &aggr;
-	//! The aggregate function
-	const DataChunk &inputs;
 	//! The merge sort tree data
 	const WindowDistinctAggregator &tree;
 	//! The size of a single aggregate state
@@ -1409,9 +1765,8 @@ protected:
 	SubFrames frames;
 };
 
-WindowDistinctState::WindowDistinctState(const AggregateObject &aggr, const DataChunk &inputs,
-                                         const WindowDistinctAggregator &tree)
-    : aggr(aggr), inputs(inputs), tree(tree), state_size(aggr.function.state_size()),
+WindowDistinctState::WindowDistinctState(const AggregateObject &aggr, const WindowDistinctAggregator &tree)
+    : aggr(aggr), tree(tree), state_size(aggr.function.state_size()),
       state((state_size * STANDARD_VECTOR_SIZE)), statef(LogicalType::POINTER), statep(LogicalType::POINTER),
       statel(LogicalType::POINTER), flush_count(0) {
 	InitSubFrames(frames, tree.exclude_mode);
@@ -1446,7 +1801,9 @@ void WindowDistinctState::Evaluate(const DataChunk &bounds, Vector &result, idx_
 	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
 
 	const auto &merge_sort_tree = *tree.merge_sort_tree;
-	const auto running_aggs = tree.levels_flat_native.get();
+	//	Only keep the tree pinned while we are using it
+	BufferHandle levels_pin;
+	const auto running_aggs = tree.levels_flat_native.Pin(levels_pin);
 
 	EvaluateSubFrames(bounds, tree.exclude_mode, count, row_idx, frames, [&](idx_t rid) {
 		auto agg_state = fdata[rid];
@@ -1485,7 +1842,7 @@ void WindowDistinctState::Evaluate(const DataChunk &bounds, Vector &result, idx_
 }
 
 unique_ptr<WindowAggregatorState> WindowDistinctAggregator::GetLocalState() const {
-	return make_uniq<WindowDistinctState>(aggr, inputs, *this);
+	return make_uniq<WindowDistinctState>(aggr, *this);
 }
 
 void WindowDistinctAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
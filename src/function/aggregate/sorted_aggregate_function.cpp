@@ -137,7 +137,8 @@ struct SortedAggregateState {
 		}
 	}
 
-	static inline void FlushLinkedList(const LinkedChunkFunctions &funcs, LinkedLists &linked, DataChunk &chunk) {
+	static inline void FlushLinkedList(const LinkedChunkFunctions &funcs, const LinkedLists &linked,
+	                                   DataChunk &chunk) {
 		idx_t total_count = 0;
 		for (column_t i = 0; i < linked.size(); ++i) {
 			funcs[i].BuildListVector(linked[i], chunk.data[i], total_count);
@@ -366,6 +367,48 @@ struct SortedAggregateState {
 		other.Reset();
 	}
 
+	void Append(const AggregateInputData &aggr_input_data, const SortedAggregateState &other) {
+		//	Copy the buffered data of the other state, which must be left intact
+		if (!other.count) {
+			return;
+		}
+
+		const auto &order_bind = aggr_input_data.bind_data->Cast<SortedAggregateBindData>();
+		DataChunk sort_input;
+		DataChunk arg_input;
+		sort_input.Initialize(Allocator::DefaultAllocator(), order_bind.sort_types);
+		if (!order_bind.sorted_on_args) {
+			arg_input.Initialize(Allocator::DefaultAllocator(), order_bind.arg_types);
+		}
+
+		if (other.ordering) {
+			ColumnDataScanState sort_state;
+			other.ordering->InitializeScan(sort_state);
+			ColumnDataScanState arg_state;
+			if (other.arguments) {
+				other.arguments->InitializeScan(arg_state);
+			}
+			while (other.ordering->Scan(sort_state, sort_input)) {
+				if (other.arguments) {
+					other.arguments->Scan(arg_state, arg_input);
+				}
+				Update(aggr_input_data, sort_input, arg_input);
+			}
+		} else if (other.sort_chunk) {
+			sort_input.Append(*other.sort_chunk);
+			if (other.arg_chunk) {
+				arg_input.Append(*other.arg_chunk);
+			}
+			Update(aggr_input_data, sort_input, arg_input);
+		} else {
+			FlushLinkedList(order_bind.sort_funcs, other.sort_linked, sort_input);
+			if (!other.arg_linked.empty()) {
+				FlushLinkedList(order_bind.arg_funcs, other.arg_linked, arg_input);
+			}
+			Update(aggr_input_data, sort_input, arg_input);
+		}
+	}
+
 	void PrefixSortBuffer(DataChunk &prefixed) {
 		for (column_t col_idx = 0; col_idx < sort_chunk->ColumnCount(); ++col_idx) {
 			prefixed.data[col_idx + 1].Reference(sort_chunk->data[col_idx]);
@@ -537,6 +580,10 @@ struct SortedAggregateFunction {
 
 	template <class STATE, class OP>
 	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
+		if (aggr_input_data.combine_type == AggregateCombineType::PRESERVE_INPUT) {
+			target.Append(aggr_input_data, source);
+			return;
+		}
 		auto &order_bind = aggr_input_data.bind_data->Cast<SortedAggregateBindData>();
 		auto &other = const_cast<STATE &>(source); // NOLINT: absorb explicitly allows destruction
 		target.Absorb(order_bind, other);
@@ -0,0 +1,69 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBCheckpointStatsData : public GlobalTableFunctionState {
+	DuckDBCheckpointStatsData() : index(0) {
+	}
+
+	idx_t index;
+	vector<reference<AttachedDatabase>> databases;
+};
+
+static unique_ptr<FunctionData> DuckDBCheckpointStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("checkpoint_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("last_bytes_written");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("total_bytes_written");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBCheckpointStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBCheckpointStatsData>();
+	result->databases = DatabaseManager::Get(context).GetDatabases(context);
+	return std::move(result);
+}
+
+void DuckDBCheckpointStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBCheckpointStatsData>();
+	idx_t row = 0;
+	for (; data.index < data.databases.size() && row < STANDARD_VECTOR_SIZE; data.index++) {
+		auto &db = data.databases[data.index].get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto stats = db.GetStorageManager().GetCheckpointStatistics();
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.data[col++].SetValue(row, Value(db.GetName()));
+		// checkpoint_count, BIGINT
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.checkpoint_count)));
+		// last_bytes_written, BIGINT
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.last_bytes_written)));
+		// total_bytes_written, BIGINT
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(stats.total_bytes_written)));
+		row++;
+	}
+	output.SetCardinality(row);
+}
+
+void DuckDBCheckpointStatsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_checkpoint_stats", {}, DuckDBCheckpointStatsFunction,
+	                              DuckDBCheckpointStatsBind, DuckDBCheckpointStatsInit));
+}
+
+} // namespace duckdb
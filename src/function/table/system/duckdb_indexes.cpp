@@ -1,8 +1,11 @@
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/function/table/system_functions.hpp"
 #include "duckdb/main/client_data.hpp"
 
@@ -57,6 +60,9 @@ static unique_ptr<FunctionData> DuckDBIndexesBind(ClientContext &context, TableF
 	names.emplace_back("sql");
 	return_types.emplace_back(LogicalType::VARCHAR);
 
+	names.emplace_back("memory_usage");
+	return_types.emplace_back(LogicalType::MAP(LogicalType::VARCHAR, LogicalType::BIGINT));
+
 	return nullptr;
 }
 
@@ -72,6 +78,37 @@ unique_ptr<GlobalTableFunctionState> DuckDBIndexesInit(ClientContext &context, T
 	return std::move(result);
 }
 
+//! Returns the in-memory size of each node type of an ART index, or NULL, if the index is not loaded
+static Value GetIndexMemoryUsage(IndexCatalogEntry &index) {
+	if (!index.catalog.IsDuckCatalog()) {
+		return Value();
+	}
+	auto &duck_index = index.Cast<DuckIndexEntry>();
+	if (!duck_index.info) {
+		return Value();
+	}
+
+	vector<Value> keys;
+	vector<Value> values;
+	duck_index.GetDataTableInfo().indexes.Scan([&](Index &storage_index) {
+		if (storage_index.name != index.name) {
+			return false;
+		}
+		if (storage_index.IsUnknown() || storage_index.index_type != ART::TYPE_NAME) {
+			return true;
+		}
+		for (auto &node_memory : storage_index.Cast<ART>().GetNodeMemoryUsage()) {
+			keys.emplace_back(EnumUtil::ToString(node_memory.first));
+			values.emplace_back(Value::BIGINT(NumericCast<int64_t>(node_memory.second)));
+		}
+		return true;
+	});
+	if (keys.empty()) {
+		return Value();
+	}
+	return Value::MAP(LogicalType::VARCHAR, LogicalType::BIGINT, std::move(keys), std::move(values));
+}
+
 void DuckDBIndexesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &data = data_p.global_state->Cast<DuckDBIndexesData>();
 	if (data.offset >= data.entries.size()) {
@@ -118,6 +155,8 @@ void DuckDBIndexesFunction(ClientContext &context, TableFunctionInput &data_p, D
 		// sql, VARCHAR
 		auto sql = index.ToSQL();
 		output.SetValue(col++, count, sql.empty() ? Value() : Value(std::move(sql)));
+		// memory_usage, MAP(VARCHAR, BIGINT)
+		output.SetValue(col++, count, GetIndexMemoryUsage(index));
 
 		count++;
 	}
@@ -0,0 +1,71 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBPlanCacheData : public GlobalTableFunctionState {
+	DuckDBPlanCacheData() : finished(false) {
+	}
+
+	PlanCacheStatistics statistics;
+	idx_t capacity = 0;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBPlanCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("cached_plans");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("capacity");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBPlanCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBPlanCacheData>();
+
+	result->statistics = PlanCache::Get(context).GetStatistics();
+	result->capacity = DBConfig::GetConfig(context).options.plan_cache_size;
+	return std::move(result);
+}
+
+void DuckDBPlanCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBPlanCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &statistics = data.statistics;
+	idx_t col = 0;
+	// hits, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.hits)));
+	// misses, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.misses)));
+	// evictions, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.evictions)));
+	// cached_plans, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.cached_plans)));
+	// capacity, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(data.capacity)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBPlanCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_plan_cache", {}, DuckDBPlanCacheFunction, DuckDBPlanCacheBind, DuckDBPlanCacheInit));
+}
+
+} // namespace duckdb
@@ -18,9 +18,18 @@
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
 
+TableScanBindData::TableScanBindData(DuckTableEntry &table)
+    : table(table), data_version(table.GetStorage().info->data_version), is_index_scan(false),
+      is_create_index(false) {
+}
+
 //===--------------------------------------------------------------------===//
 // Table Scan
 //===--------------------------------------------------------------------===//
@@ -74,6 +83,9 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		col = storage_idx;
 	}
 	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	// row groups can only be handed out per NUMA node if the sink does not rely on the batch index order
+	auto sink = context.pipeline ? context.pipeline->GetSink() : nullptr;
+	result->scan_state.options.prefer_local_row_groups = sink && !sink->RequiresBatchIndex();
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
 		auto &tsgs = gstate->Cast<TableScanGlobalState>();
@@ -188,6 +200,17 @@ idx_t TableScanGetBatchIndex(ClientContext &context, const FunctionData *bind_da
 	return 0;
 }
 
+idx_t TableScanGetPrunedRows(ClientContext &context, const FunctionData *bind_data_p,
+                             LocalTableFunctionState *local_state) {
+	auto &state = local_state->Cast<TableScanLocalState>();
+	auto &table_state = state.scan_state.table_state;
+	auto &local_storage_state = state.scan_state.local_state;
+	auto result = table_state.zonemap_pruned_rows + local_storage_state.zonemap_pruned_rows;
+	table_state.zonemap_pruned_rows = 0;
+	local_storage_state.zonemap_pruned_rows = 0;
+	return result;
+}
+
 BindInfo TableScanGetBindInfo(const optional_ptr<FunctionData> bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
 	return BindInfo(bind_data.table);
@@ -210,23 +233,26 @@ unique_ptr<NodeStatistics> TableScanCardinality(ClientContext &context, const Fu
 // Index Scan
 //===--------------------------------------------------------------------===//
 struct IndexScanGlobalState : public GlobalTableFunctionState {
-	explicit IndexScanGlobalState(data_ptr_t row_id_data) : row_ids(LogicalType::ROW_TYPE, row_id_data) {
+	IndexScanGlobalState() : row_id_column_ids {COLUMN_IDENTIFIER_ROW_ID}, offset(0), index_only(false) {
 	}
 
-	Vector row_ids;
 	ColumnFetchState fetch_state;
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
-	bool finished;
+	vector<storage_t> row_id_column_ids;
+	//! The offset of the next row id to fetch
+	idx_t offset;
+	//! Whether or not the scanned columns are read from the key columns of the index (index-only scan)
+	bool index_only;
+	//! The key column of each scanned column, or DConstants::INVALID_INDEX for the row id (index-only scan)
+	vector<idx_t> key_column_indexes;
+	//! The row ids of the fetched rows that are visible to the transaction (index-only scan)
+	DataChunk row_id_chunk;
 };
 
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
-	data_ptr_t row_id_data = nullptr;
-	if (!bind_data.result_ids.empty()) {
-		row_id_data = (data_ptr_t)&bind_data.result_ids[0]; // NOLINT - this is not pretty
-	}
-	auto result = make_uniq<IndexScanGlobalState>(row_id_data);
+	auto result = make_uniq<IndexScanGlobalState>();
 	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
 
 	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
@@ -238,24 +264,84 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
 	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
 
-	result->finished = false;
+	// if all scanned columns are key columns of the index, we read them from the index keys
+	result->index_only = !bind_data.key_columns.empty();
+	for (auto &id : input.column_ids) {
+		if (!result->index_only) {
+			break;
+		}
+		if (id == COLUMN_IDENTIFIER_ROW_ID) {
+			result->key_column_indexes.push_back(DConstants::INVALID_INDEX);
+			continue;
+		}
+		auto entry = std::find(bind_data.key_column_ids.begin(), bind_data.key_column_ids.end(), id);
+		if (entry == bind_data.key_column_ids.end()) {
+			result->index_only = false;
+			break;
+		}
+		result->key_column_indexes.push_back(NumericCast<idx_t>(entry - bind_data.key_column_ids.begin()));
+	}
+	if (result->index_only) {
+		result->row_id_chunk.Initialize(context, {LogicalType::ROW_TYPE});
+	}
 	return std::move(result);
 }
 
+//! Fetches the row ids only, to find the rows that are visible to the transaction, and reads the values of the
+//! scanned columns from the key columns of the index
+static void IndexOnlyFetch(DuckTransaction &transaction, const TableScanBindData &bind_data,
+                           IndexScanGlobalState &state, Vector &row_ids, idx_t fetch_count, DataChunk &output) {
+	auto &row_id_chunk = state.row_id_chunk;
+	row_id_chunk.Reset();
+	bind_data.table.GetStorage().Fetch(transaction, row_id_chunk, state.row_id_column_ids, row_ids, fetch_count,
+	                                   state.fetch_state);
+
+	// the visible row ids are a subset of the sorted row ids: find their positions in the key columns
+	auto all_ids = FlatVector::GetData<row_t>(row_ids);
+	auto visible_ids = FlatVector::GetData<row_t>(row_id_chunk.data[0]);
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t position = 0;
+	for (idx_t i = 0; i < row_id_chunk.size(); i++) {
+		while (all_ids[position] != visible_ids[i]) {
+			position++;
+		}
+		sel.set_index(i, state.offset + position);
+	}
+
+	for (idx_t col_idx = 0; col_idx < state.key_column_indexes.size(); col_idx++) {
+		auto key_column = state.key_column_indexes[col_idx];
+		if (key_column == DConstants::INVALID_INDEX) {
+			output.data[col_idx].Reference(row_id_chunk.data[0]);
+		} else {
+			VectorOperations::Copy(bind_data.key_columns[key_column], output.data[col_idx], sel, row_id_chunk.size(),
+			                       0, 0);
+		}
+	}
+	output.SetCardinality(row_id_chunk.size());
+}
+
 static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &state = data_p.global_state->Cast<IndexScanGlobalState>();
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &local_storage = LocalStorage::Get(transaction);
 
-	if (!state.finished) {
-		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, state.row_ids,
-		                                   bind_data.result_ids.size(), state.fetch_state);
-		state.finished = true;
-	}
-	if (output.size() == 0) {
-		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+	// fetch the rows of the index scan, one vector at a time
+	while (state.offset < bind_data.result_ids.size()) {
+		auto fetch_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, bind_data.result_ids.size() - state.offset);
+		Vector row_ids(LogicalType::ROW_TYPE, (data_ptr_t)&bind_data.result_ids[state.offset]); // NOLINT
+		if (state.index_only) {
+			IndexOnlyFetch(transaction, bind_data, state, row_ids, fetch_count, output);
+		} else {
+			bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, row_ids, fetch_count,
+			                                   state.fetch_state);
+		}
+		state.offset += fetch_count;
+		if (output.size() > 0) {
+			return;
+		}
 	}
+	local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
 }
 
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
@@ -278,6 +364,31 @@ static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &ex
 	    expr, [&](Expression &child) { RewriteIndexExpression(index, get, child, rewrite_possible); });
 }
 
+//! Returns true, if none of the key columns of the index can contain NULL values
+static bool KeyColumnsNotNull(TableCatalogEntry &table, Index &index) {
+	if (index.IsPrimary()) {
+		return true;
+	}
+	for (auto &expr : index.unbound_expressions) {
+		if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto &bound_colref = expr->Cast<BoundColumnRefExpression>();
+		auto column = LogicalIndex(index.column_ids[bound_colref.binding.column_index]);
+		bool not_null = false;
+		for (auto &constraint : table.GetConstraints()) {
+			if (constraint->type == ConstraintType::NOT_NULL && constraint->Cast<NotNullConstraint>().index == column) {
+				not_null = true;
+				break;
+			}
+		}
+		if (!not_null) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
                                     vector<unique_ptr<Expression>> &filters) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
@@ -306,6 +417,11 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 		return;
 	}
 
+	// the index scan fetches at most index_scan_max_count rows, or index_scan_percentage of the table
+	auto &db_config = DBConfig::GetConfig(context);
+	auto max_count = MaxValue<idx_t>(db_config.options.index_scan_max_count,
+	                                 idx_t(db_config.options.index_scan_percentage * double(storage.GetTotalRows())));
+
 	// Lazily initialize any unknown indexes that might have been loaded by an extension
 	storage.info->InitializeIndexes(context);
 
@@ -325,42 +441,74 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 
 		auto &art_index = index.Cast<ART>();
 
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
+		// key expressions that reference columns that are not scanned cannot match any filter
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				index_expression.reset();
+			}
+			index_expressions.push_back(std::move(index_expression));
 		}
 
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
+		// try to initialize a scan of the index with the filter expressions
+		auto &transaction = Transaction::Get(context, bind_data.table.catalog);
+		auto index_state =
+		    art_index.TryInitializeScan(transaction, index_expressions, filters, KeyColumnsNotNull(table, art_index));
+		if (!index_state) {
 			return false;
 		}
 
-		// try to find a matching index for any of the filter expressions
-		auto &transaction = Transaction::Get(context, bind_data.table.catalog);
-
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(transaction, *index_expression, *filter);
-			if (index_state != nullptr) {
-				if (art_index.Scan(transaction, storage, *index_state, STANDARD_VECTOR_SIZE, bind_data.result_ids)) {
-					// use an index scan!
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-				} else {
-					bind_data.result_ids.clear();
-				}
-				return true;
+		// if all scanned columns are key columns, we can read them from the index keys instead of the table
+		vector<column_t> key_column_ids;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			if (unbound_expression->type != ExpressionType::BOUND_COLUMN_REF) {
+				key_column_ids.push_back(DConstants::INVALID_INDEX);
+				continue;
 			}
+			auto &bound_colref = unbound_expression->Cast<BoundColumnRefExpression>();
+			key_column_ids.push_back(art_index.column_ids[bound_colref.binding.column_index]);
 		}
-		return false;
+		bool index_only = art_index.CanReconstructKeys();
+		for (auto &column_id : get.column_ids) {
+			if (column_id != COLUMN_IDENTIFIER_ROW_ID &&
+			    std::find(key_column_ids.begin(), key_column_ids.end(), column_id) == key_column_ids.end()) {
+				index_only = false;
+			}
+		}
+
+		bool success;
+		if (index_only) {
+			success = art_index.Scan(transaction, storage, *index_state, max_count, bind_data.result_ids,
+			                         bind_data.key_columns);
+		} else {
+			success = art_index.Scan(transaction, storage, *index_state, max_count, bind_data.result_ids);
+		}
+		if (!success) {
+			// too many matching rows: try the next index
+			bind_data.result_ids.clear();
+			bind_data.key_columns.clear();
+			return false;
+		}
+
+		// use an index scan!
+		bind_data.is_index_scan = true;
+		if (index_only) {
+			bind_data.key_column_ids = std::move(key_column_ids);
+		}
+		get.function = TableScanFunction::GetIndexScanFunction();
+		return true;
 	});
 }
 
 string TableScanToString(const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
 	string result = bind_data.table.name;
+	if (!bind_data.key_columns.empty()) {
+		result += "\n[INFOSEPARATOR]\nIndex Only";
+	}
 	return result;
 }
 
@@ -421,9 +569,11 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.to_string = TableScanToString;
 	scan_function.table_scan_progress = TableScanProgress;
 	scan_function.get_batch_index = TableScanGetBatchIndex;
+	scan_function.get_pruned_rows = TableScanGetPrunedRows;
 	scan_function.get_bind_info = TableScanGetBindInfo;
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
+	scan_function.dynamic_filter_pushdown = true;
 	scan_function.filter_prune = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
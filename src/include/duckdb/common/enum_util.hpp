@@ -150,6 +150,8 @@ enum class FunctionStability : uint8_t;
 
 enum class HLLStorageType : uint8_t;
 
+enum class HardwareCounterType : uint8_t;
+
 enum class IndexConstraintType : uint8_t;
 
 enum class InsertColumnOrder : uint8_t;
@@ -296,6 +298,10 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TaskPriority : uint8_t;
+
+enum class ThreadPinMode : uint8_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionType : uint8_t;
@@ -316,6 +322,8 @@ enum class VerificationType : uint8_t;
 
 enum class VerifyExistenceType : uint8_t;
 
+enum class WALSynchronousMode : uint8_t;
+
 enum class WALType : uint8_t;
 
 enum class WindowAggregationMode : uint32_t;
@@ -502,6 +510,9 @@ const char* EnumUtil::ToChars<FunctionStability>(FunctionStability value);
 template<>
 const char* EnumUtil::ToChars<HLLStorageType>(HLLStorageType value);
 
+template<>
+const char* EnumUtil::ToChars<HardwareCounterType>(HardwareCounterType value);
+
 template<>
 const char* EnumUtil::ToChars<IndexConstraintType>(IndexConstraintType value);
 
@@ -721,6 +732,12 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TaskPriority>(TaskPriority value);
+
+template<>
+const char* EnumUtil::ToChars<ThreadPinMode>(ThreadPinMode value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -751,6 +768,9 @@ const char* EnumUtil::ToChars<VerificationType>(VerificationType value);
 template<>
 const char* EnumUtil::ToChars<VerifyExistenceType>(VerifyExistenceType value);
 
+template<>
+const char* EnumUtil::ToChars<WALSynchronousMode>(WALSynchronousMode value);
+
 template<>
 const char* EnumUtil::ToChars<WALType>(WALType value);
 
@@ -941,6 +961,9 @@ FunctionStability EnumUtil::FromString<FunctionStability>(const char *value);
 template<>
 HLLStorageType EnumUtil::FromString<HLLStorageType>(const char *value);
 
+template<>
+HardwareCounterType EnumUtil::FromString<HardwareCounterType>(const char *value);
+
 template<>
 IndexConstraintType EnumUtil::FromString<IndexConstraintType>(const char *value);
 
@@ -1160,6 +1183,12 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TaskPriority EnumUtil::FromString<TaskPriority>(const char *value);
+
+template<>
+ThreadPinMode EnumUtil::FromString<ThreadPinMode>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -1190,6 +1219,9 @@ VerificationType EnumUtil::FromString<VerificationType>(const char *value);
 template<>
 VerifyExistenceType EnumUtil::FromString<VerifyExistenceType>(const char *value);
 
+template<>
+WALSynchronousMode EnumUtil::FromString<WALSynchronousMode>(const char *value);
+
 template<>
 WALType EnumUtil::FromString<WALType>(const char *value);
 
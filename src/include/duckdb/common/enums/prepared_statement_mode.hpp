@@ -15,6 +15,8 @@ namespace duckdb {
 enum class PreparedStatementMode : uint8_t {
 	PREPARE_ONLY,
 	PREPARE_AND_EXECUTE,
+	//! The statement is prepared for the plan cache: the plan must be valid for all values of its parameters
+	PREPARE_FOR_PLAN_CACHE,
 };
 
 } // namespace duckdb
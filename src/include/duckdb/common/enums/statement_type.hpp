@@ -69,6 +69,8 @@ struct StatementProperties {
 	unordered_set<string> read_databases;
 	//! The set of databases this statement will modify
 	unordered_set<string> modified_databases;
+	//! The subset of the modified databases that this statement only appends rows to
+	unordered_set<string> appended_databases;
 	//! Whether or not the statement requires a valid transaction. Almost all statements require this, with the
 	//! exception of ROLLBACK
 	bool requires_valid_transaction;
@@ -0,0 +1,19 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/thread_pin_mode.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! Whether or not the background threads are pinned to the CPUs of a NUMA node. Threads are only pinned on request:
+//! AUTO pins the threads only if the system has multiple NUMA nodes and there are more threads than CPUs in a node
+enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2 };
+
+} // namespace duckdb
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+#include <thread>
+
+namespace duckdb {
+
+enum class HardwareCounterType : uint8_t { CPU_CYCLES = 0, INSTRUCTIONS = 1, CACHE_MISSES = 2 };
+
+struct HardwareCounterValues {
+	static constexpr const idx_t COUNTER_COUNT = 3;
+
+	idx_t values[COUNTER_COUNT] = {0, 0, 0};
+
+	static const char *GetName(HardwareCounterType type);
+};
+
+//! HardwareCounters reads the CPU performance counters (cycles, instructions and cache misses) of the calling thread.
+//! The counters are only available on Linux when perf events are permitted, Read returns false otherwise.
+class HardwareCounters {
+public:
+	HardwareCounters();
+	~HardwareCounters();
+
+public:
+	//! Reads the current counter values of the calling thread
+	bool Read(HardwareCounterValues &result);
+
+private:
+	void Open();
+	void Close();
+
+private:
+	//! The perf event file descriptors, or -1 if the counter could not be opened
+	int fds[HardwareCounterValues::COUNTER_COUNT];
+	//! The thread the counters were opened for: perf events count the thread that opened them
+	std::thread::id thread_id;
+	//! Whether or not we tried to open the counters
+	bool opened;
+};
+
+} // namespace duckdb
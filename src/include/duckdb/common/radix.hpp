@@ -37,6 +37,11 @@ public:
 		throw NotImplementedException("Cannot create data from this type");
 	}
 
+	template <class T>
+	static inline T DecodeData(const_data_ptr_t input) {
+		throw NotImplementedException("Cannot read data from this type");
+	}
+
 	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len) {
 		auto len = value.GetSize();
 		memcpy(dataptr, value.GetData(), MinValue(len, prefix_len));
@@ -192,4 +197,75 @@ inline void Radix::EncodeData(data_ptr_t dataptr, interval_t value) {
 	EncodeData<int64_t>(dataptr, value.micros);
 }
 
+template <>
+inline bool Radix::DecodeData(const_data_ptr_t input) {
+	return Load<uint8_t>(input) != 0;
+}
+
+template <>
+inline int8_t Radix::DecodeData(const_data_ptr_t input) {
+	data_t buffer = FlipSign(input[0]);
+	return Load<int8_t>(&buffer);
+}
+
+template <>
+inline int16_t Radix::DecodeData(const_data_ptr_t input) {
+	data_t buffer[sizeof(int16_t)];
+	memcpy(buffer, input, sizeof(int16_t));
+	buffer[0] = FlipSign(buffer[0]);
+	return BSwap<int16_t>(Load<int16_t>(buffer));
+}
+
+template <>
+inline int32_t Radix::DecodeData(const_data_ptr_t input) {
+	data_t buffer[sizeof(int32_t)];
+	memcpy(buffer, input, sizeof(int32_t));
+	buffer[0] = FlipSign(buffer[0]);
+	return BSwap<int32_t>(Load<int32_t>(buffer));
+}
+
+template <>
+inline int64_t Radix::DecodeData(const_data_ptr_t input) {
+	data_t buffer[sizeof(int64_t)];
+	memcpy(buffer, input, sizeof(int64_t));
+	buffer[0] = FlipSign(buffer[0]);
+	return BSwap<int64_t>(Load<int64_t>(buffer));
+}
+
+template <>
+inline uint8_t Radix::DecodeData(const_data_ptr_t input) {
+	return Load<uint8_t>(input);
+}
+
+template <>
+inline uint16_t Radix::DecodeData(const_data_ptr_t input) {
+	return BSwap<uint16_t>(Load<uint16_t>(input));
+}
+
+template <>
+inline uint32_t Radix::DecodeData(const_data_ptr_t input) {
+	return BSwap<uint32_t>(Load<uint32_t>(input));
+}
+
+template <>
+inline uint64_t Radix::DecodeData(const_data_ptr_t input) {
+	return BSwap<uint64_t>(Load<uint64_t>(input));
+}
+
+template <>
+inline hugeint_t Radix::DecodeData(const_data_ptr_t input) {
+	hugeint_t result;
+	result.upper = DecodeData<int64_t>(input);
+	result.lower = DecodeData<uint64_t>(input + sizeof(result.upper));
+	return result;
+}
+
+template <>
+inline uhugeint_t Radix::DecodeData(const_data_ptr_t input) {
+	uhugeint_t result;
+	result.upper = DecodeData<uint64_t>(input);
+	result.lower = DecodeData<uint64_t>(input + sizeof(result.upper));
+	return result;
+}
+
 } // namespace duckdb
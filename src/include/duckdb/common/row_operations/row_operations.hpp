@@ -14,6 +14,7 @@
 namespace duckdb {
 
 class ArenaAllocator;
+enum class AggregateCombineType : uint8_t;
 struct AggregateObject;
 struct AggregateFilterData;
 class DataChunk;
@@ -64,6 +65,8 @@ struct RowOperations {
 	//! combine - unaligned addresses, updated
 	static void CombineStates(RowOperationsState &state, TupleDataLayout &layout, Vector &sources, Vector &targets,
 	                          idx_t count);
+	static void CombineStates(RowOperationsState &state, TupleDataLayout &layout, Vector &sources, Vector &targets,
+	                          idx_t count, AggregateCombineType combine_type);
 	//! finalize - unaligned addresses, updated
 	static void FinalizeStates(RowOperationsState &state, TupleDataLayout &layout, Vector &addresses, DataChunk &result,
 	                           idx_t aggr_idx);
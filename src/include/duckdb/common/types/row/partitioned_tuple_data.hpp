@@ -79,6 +79,10 @@ public:
 	void Reset();
 	//! Repartition this PartitionedTupleData into the new PartitionedTupleData
 	void Repartition(PartitionedTupleData &new_partitioned_data);
+	//! Repartition a single partition of this PartitionedTupleData into the new PartitionedTupleData
+	void Repartition(idx_t partition_idx, PartitionedTupleData &new_partitioned_data);
+	//! Move a partition of this PartitionedTupleData into a partition of the new PartitionedTupleData (without copying)
+	void MovePartition(idx_t partition_idx, PartitionedTupleData &new_partitioned_data, idx_t new_partition_idx);
 	//! Unpins the data
 	void Unpin();
 	//! Get the partitions in this PartitionedTupleData
@@ -110,6 +110,9 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, AggregateType filter);
+	//! Combine the aggregate states of rows with the given (finer) layout into the groups of this HT,
+	//! leaving the source states intact
+	idx_t AddStates(DataChunk &groups, Vector &source_rows, const TupleDataLayout &source_layout);
 
 	//! Fetch the aggregates for specific groups from the HT and place them in the result
 	void FetchAggregates(DataChunk &groups, DataChunk &result);
@@ -36,7 +36,10 @@ public:
 	// Index type name for the ART
 	static constexpr const char *TYPE_NAME = "ART";
 	//! FixedSizeAllocator count of the ART
-	static constexpr uint8_t ALLOCATOR_COUNT = 6;
+	static constexpr uint8_t ALLOCATOR_COUNT = 8;
+	//! FixedSizeAllocator count of ARTs in database files of the oldest storage version, which have no Node7 and
+	//! Node15 allocators
+	static constexpr uint8_t ALLOCATOR_COUNT_LOWER = 6;
 
 public:
 	//! Constructs an ART
@@ -52,15 +55,30 @@ public:
 	shared_ptr<array<unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>> allocators;
 	//! True, if the ART owns its data
 	bool owns_data;
-
-	//! Try to initialize a scan on the index with the given expression and filter
-	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-	                                             const Expression &filter_expr);
+	//! The maximum number of key bytes in each prefix node
+	uint8_t prefix_count;
+	//! True, if a full Node4 grows into a Node7 and a full Node7 into a Node15. Otherwise, the ART uses Node16,
+	//! which older versions of DuckDB can read
+	bool compact_nodes;
+
+	//! Try to initialize a scan on the index with the given key expressions and filters. The scan uses equality
+	//! and IN predicates on a prefix of the key columns, optionally followed by range predicates on the next key
+	//! column. If keys_not_null is false, the scan must restrict all key columns, as rows with NULL values in any
+	//! key column are not in the index
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filters, bool keys_not_null);
 
 	//! Performs a lookup on the index, fetching up to max_count result IDs. Returns true if all row IDs were fetched,
 	//! and false otherwise
 	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, idx_t max_count,
 	          vector<row_t> &result_ids);
+	//! Performs a lookup on the index like Scan, and reconstructs the values of the key columns of each result ID
+	//! from its key. Requires CanReconstructKeys()
+	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, idx_t max_count,
+	          vector<row_t> &result_ids, vector<Vector> &key_columns);
+	//! Returns true, if the values of the key columns can be reconstructed from the keys in the ART
+	bool CanReconstructKeys() const;
 
 public:
 	//! Create a index instance of this type
@@ -97,12 +115,20 @@ public:
 	//! Merge another index into this index. The lock obtained from InitializeLock must be held, and the other
 	//! index must also be locked during the merge
 	bool MergeIndexes(IndexLock &state, Index &other_index) override;
+	//! Increments the buffer IDs of all nodes by flags.merge_buffer_counts. Afterwards, the ART can be merged into an
+	//! ART that holds that many buffers in each allocator with MergeIncrementedIndex, which does not traverse it again
+	void IncrementBufferIds(const ARTFlags &flags);
+	//! Merges an ART whose buffer IDs already start after the buffers of this ART, see IncrementBufferIds. The cost of
+	//! the merge only depends on the shared key prefixes, i.e., it is cheap for ARTs over disjoint key ranges
+	bool MergeIncrementedIndex(ART &other);
 
 	//! Traverses an ART and vacuums the qualifying nodes. The lock obtained from InitializeLock must be held
 	void Vacuum(IndexLock &state) override;
 
 	//! Returns the in-memory usage of the index. The lock obtained from InitializeLock must be held
 	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Returns the in-memory usage of each node type, i.e., of each fixed-size allocator
+	vector<pair<NType, idx_t>> GetNodeMemoryUsage();
 
 	//! Generate ART keys for an input chunk
 	static void GenerateKeys(ArenaAllocator &allocator, DataChunk &input, vector<ARTKey> &keys);
@@ -128,14 +154,13 @@ private:
 	//! Erase a key from the tree (if a leaf has more than one value) or erase the leaf itself
 	void Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
-	//! Returns all row IDs belonging to a key greater (or equal) than the search key
-	bool SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key less (or equal) than the upper_bound
-	bool SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-	                vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key within the range of lower_bound and upper_bound
-	bool SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-	                      bool right_equal, idx_t max_count, vector<row_t> &result_ids);
+	//! Returns all row IDs belonging to a key within the key ranges of the scan, and their keys if row_keys is set
+	bool ScanRanges(ARTIndexScanState &state, idx_t max_count, vector<row_t> &row_ids,
+	                optional_ptr<vector<string>> row_keys);
+
+	//! Unpins all unchanged on-disk buffers that the last operation pinned. Called at the end of each operation
+	//! holding the lock, as there are no remaining references to the nodes of the ART
+	void UnpinBuffers();
 
 	//! Initializes a merge operation by returning a set containing the buffer count of each fixed-size allocator
 	void InitializeMerge(ARTFlags &flags);
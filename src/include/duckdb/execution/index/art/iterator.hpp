@@ -46,6 +46,13 @@ public:
 	bool operator>=(const ARTKey &key) const;
 	//! Equal to operator
 	bool operator==(const ARTKey &key) const;
+	//! Returns true, if the current key is greater than the key, not taking into account any bytes of the
+	//! current key past the length of the key
+	bool PrefixGreaterThan(const ARTKey &key) const;
+	//! Returns the bytes of the current key
+	string GetBytes() const {
+		return string(const_char_ptr_cast(key_bytes.data()), key_bytes.size());
+	}
 
 private:
 	vector<uint8_t> key_bytes;
@@ -59,12 +66,15 @@ public:
 	optional_ptr<ART> art = nullptr;
 
 	//! Scans the tree, starting at the current top node on the stack, and ending at upper_bound.
-	//! If upper_bound is the empty ARTKey, than there is no upper bound
-	bool Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids, const bool equal);
+	//! If upper_bound is the empty ARTKey, than there is no upper bound. If equal is true, the scan includes all
+	//! keys that have upper_bound as their prefix. If result_keys is set, the key of each row ID is added to it
+	bool Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids, const bool equal,
+	          optional_ptr<vector<string>> result_keys = nullptr);
 	//! Finds the minimum (leaf) of the current subtree
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
-	//! bound exceeds the maximum value of the ART
+	//! bound exceeds the maximum value of the ART. The key can be a prefix of the keys in the ART,
+	//! in which case equal must be true
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
 
 private:
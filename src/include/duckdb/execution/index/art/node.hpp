@@ -27,6 +27,8 @@ enum class NType : uint8_t {
 	NODE_48 = 5,
 	NODE_256 = 6,
 	LEAF_INLINED = 7,
+	NODE_7 = 8,
+	NODE_15 = 9,
 };
 
 class ART;
@@ -48,6 +50,8 @@ public:
 	static constexpr uint8_t NODE_256_SHRINK_THRESHOLD = 36;
 	//! Node sizes
 	static constexpr uint8_t NODE_4_CAPACITY = 4;
+	static constexpr uint8_t NODE_7_CAPACITY = 7;
+	static constexpr uint8_t NODE_15_CAPACITY = 15;
 	static constexpr uint8_t NODE_16_CAPACITY = 16;
 	static constexpr uint8_t NODE_48_CAPACITY = 48;
 	static constexpr uint16_t NODE_256_CAPACITY = 256;
@@ -55,6 +59,9 @@ public:
 	static constexpr uint8_t EMPTY_MARKER = 48;
 	static constexpr uint8_t LEAF_SIZE = 4;
 	static constexpr uint8_t PREFIX_SIZE = 15;
+	//! The prefix size of ARTs over small fixed-size keys, e.g., a single BIGINT column, in the current storage
+	//! format. Such keys rarely need more prefix bytes per node, and the prefix node then fits into 16 bytes
+	static constexpr uint8_t COMPACT_PREFIX_SIZE = 7;
 	static constexpr idx_t AND_ROW_ID = 0x00FFFFFFFFFFFFFF;
 
 public:
@@ -65,6 +72,13 @@ public:
 
 	//! Get references to the allocator
 	static FixedSizeAllocator &GetAllocator(const ART &art, const NType type);
+	//! Returns the position of the allocator of a node type in the allocators of the ART
+	static inline idx_t GetAllocatorIdx(const NType type) {
+		// inlined leaves have no allocator
+		D_ASSERT(type != NType::LEAF_INLINED);
+		auto type_idx = static_cast<uint8_t>(type);
+		return type < NType::LEAF_INLINED ? type_idx - 1 : type_idx - 2;
+	}
 	//! Get a (immutable) reference to the node. If dirty is false, then T should be a const class
 	template <class NODE>
 	static inline const NODE &Ref(const ART &art, const Node ptr, const NType type) {
@@ -97,7 +111,7 @@ public:
 	//! Returns the capacity of the node
 	idx_t GetCapacity() const;
 	//! Returns the matching node type for a given count
-	static NType GetARTNodeTypeByCount(const idx_t count);
+	static NType GetARTNodeTypeByCount(const ART &art, const idx_t count);
 
 	//! Initializes a merge by incrementing the buffer IDs of a node and its subtree
 	void InitializeMerge(ART &art, const ARTFlags &flags);
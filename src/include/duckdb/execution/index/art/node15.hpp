@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/art/node15.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/node.hpp"
+
+namespace duckdb {
+
+//! Node15 holds up to 15 Node children sorted by their key byte. Unlike in a Node16, its count and key bytes fill
+//! 16 bytes without padding
+class Node15 {
+public:
+	//! Delete copy constructors, as any Node15 can never own its memory
+	Node15(const Node15 &) = delete;
+	Node15 &operator=(const Node15 &) = delete;
+
+	//! Number of non-null children
+	uint8_t count;
+	//! Array containing all partial key bytes
+	uint8_t key[Node::NODE_15_CAPACITY];
+	//! Node pointers to the child nodes
+	Node children[Node::NODE_15_CAPACITY];
+
+public:
+	//! Get a new Node15, might cause a new buffer allocation, and initialize it
+	static Node15 &New(ART &art, Node &node);
+	//! Free the node (and its subtree)
+	static void Free(ART &art, Node &node);
+
+	//! Initializes all the fields of the node while growing a Node7 to a Node15
+	static Node15 &GrowNode7(ART &art, Node &node15, Node &node7);
+	//! Initializes all fields of the node while shrinking a Node48 to a Node15
+	static Node15 &ShrinkNode48(ART &art, Node &node15, Node &node48);
+
+	//! Initializes a merge by incrementing the buffer IDs of the node
+	void InitializeMerge(ART &art, const ARTFlags &flags);
+
+	//! Insert a child node at byte
+	static void InsertChild(ART &art, Node &node, const uint8_t byte, const Node child);
+	//! Delete the child node at byte
+	static void DeleteChild(ART &art, Node &node, const uint8_t byte);
+
+	//! Replace the child node at byte
+	void ReplaceChild(const uint8_t byte, const Node child);
+
+	//! Get the (immutable) child for the respective byte in the node
+	optional_ptr<const Node> GetChild(const uint8_t byte) const;
+	//! Get the child for the respective byte in the node
+	optional_ptr<Node> GetChildMutable(const uint8_t byte);
+	//! Get the first (immutable) child that is greater or equal to the specific byte
+	optional_ptr<const Node> GetNextChild(uint8_t &byte) const;
+	//! Get the first child that is greater or equal to the specific byte
+	optional_ptr<Node> GetNextChildMutable(uint8_t &byte);
+
+};
+} // namespace duckdb
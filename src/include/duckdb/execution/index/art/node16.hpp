@@ -59,7 +59,5 @@ public:
 	//! Get the first child that is greater or equal to the specific byte
 	optional_ptr<Node> GetNextChildMutable(uint8_t &byte);
 
-	//! Vacuum the children of the node
-	void Vacuum(ART &art, const ARTFlags &flags);
 };
 } // namespace duckdb
@@ -36,6 +36,8 @@ public:
 
 	//! Initializes all fields of the node while shrinking a Node16 to a Node4
 	static Node4 &ShrinkNode16(ART &art, Node &node4, Node &node16);
+	//! Initializes all fields of the node while shrinking a Node7 to a Node4
+	static Node4 &ShrinkNode7(ART &art, Node &node4, Node &node7);
 
 	//! Initializes a merge by incrementing the buffer IDs of the child nodes
 	void InitializeMerge(ART &art, const ARTFlags &flags);
@@ -57,7 +59,5 @@ public:
 	//! Get the first child that is greater or equal to the specific byte
 	optional_ptr<Node> GetNextChildMutable(uint8_t &byte);
 
-	//! Vacuum the children of the node
-	void Vacuum(ART &art, const ARTFlags &flags);
 };
 } // namespace duckdb
@@ -37,6 +37,8 @@ public:
 
 	//! Initializes all the fields of the node while growing a Node16 to a Node48
 	static Node48 &GrowNode16(ART &art, Node &node48, Node &node16);
+	//! Initializes all the fields of the node while growing a Node15 to a Node48
+	static Node48 &GrowNode15(ART &art, Node &node48, Node &node15);
 	//! Initializes all fields of the node while shrinking a Node256 to a Node48
 	static Node48 &ShrinkNode256(ART &art, Node &node48, Node &node256);
 
@@ -63,7 +65,5 @@ public:
 	//! Get the first child that is greater or equal to the specific byte
 	optional_ptr<Node> GetNextChildMutable(uint8_t &byte);
 
-	//! Vacuum the children of the node
-	void Vacuum(ART &art, const ARTFlags &flags);
 };
 } // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/art/node7.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/node.hpp"
+
+namespace duckdb {
+
+//! Node7 holds up to seven Node children sorted by their key byte. Together with Node15, it replaces Node16 in ARTs
+//! of the current storage format. A Node7 fills one cache line
+class Node7 {
+public:
+	//! Delete copy constructors, as any Node7 can never own its memory
+	Node7(const Node7 &) = delete;
+	Node7 &operator=(const Node7 &) = delete;
+
+	//! Number of non-null children
+	uint8_t count;
+	//! Array containing all partial key bytes
+	uint8_t key[Node::NODE_7_CAPACITY];
+	//! Node pointers to the child nodes
+	Node children[Node::NODE_7_CAPACITY];
+
+public:
+	//! Get a new Node7, might cause a new buffer allocation, and initialize it
+	static Node7 &New(ART &art, Node &node);
+	//! Free the node (and its subtree)
+	static void Free(ART &art, Node &node);
+
+	//! Initializes all the fields of the node while growing a Node4 to a Node7
+	static Node7 &GrowNode4(ART &art, Node &node7, Node &node4);
+	//! Initializes all fields of the node while shrinking a Node15 to a Node7
+	static Node7 &ShrinkNode15(ART &art, Node &node7, Node &node15);
+
+	//! Initializes a merge by incrementing the buffer IDs of the node
+	void InitializeMerge(ART &art, const ARTFlags &flags);
+
+	//! Insert a child node at byte
+	static void InsertChild(ART &art, Node &node, const uint8_t byte, const Node child);
+	//! Delete the child node at byte
+	static void DeleteChild(ART &art, Node &node, const uint8_t byte);
+
+	//! Replace the child node at byte
+	void ReplaceChild(const uint8_t byte, const Node child);
+
+	//! Get the (immutable) child for the respective byte in the node
+	optional_ptr<const Node> GetChild(const uint8_t byte) const;
+	//! Get the child for the respective byte in the node
+	optional_ptr<Node> GetChildMutable(const uint8_t byte);
+	//! Get the first (immutable) child that is greater or equal to the specific byte
+	optional_ptr<const Node> GetNextChild(uint8_t &byte) const;
+	//! Get the first child that is greater or equal to the specific byte
+	optional_ptr<Node> GetNextChildMutable(uint8_t &byte);
+
+};
+} // namespace duckdb
@@ -16,20 +16,38 @@ namespace duckdb {
 // classes
 class ARTKey;
 
-//! The Prefix is a special node type that contains up to PREFIX_SIZE bytes, and one byte for the count,
-//! and a Node pointer. This pointer either points to a prefix node or another Node.
+//! The Prefix is a special node type that contains up to art.prefix_count bytes, and one byte for the count,
+//! and a Node pointer. This pointer either points to a prefix node or another Node. The allocated segment
+//! only spans art.prefix_count + 1 bytes and the pointer, so the members must be accessed through Count and Ptr.
 class Prefix {
 public:
 	//! Delete copy constructors, as any Prefix can never own its memory
 	Prefix(const Prefix &) = delete;
 	Prefix &operator=(const Prefix &) = delete;
 
-	//! Up to PREFIX_SIZE bytes of prefix data and the count
-	uint8_t data[Node::PREFIX_SIZE + 1];
-	//! A pointer to the next Node
-	Node ptr;
+	//! Up to art.prefix_count bytes of prefix data, the count, and a pointer to the next Node
+	uint8_t data[Node::PREFIX_SIZE + 1 + sizeof(Node)];
 
 public:
+	//! Returns the size of a prefix segment for the given prefix count
+	static inline idx_t GetSegmentSize(const uint8_t prefix_count) {
+		return prefix_count + 1 + sizeof(Node);
+	}
+	//! Returns the number of prefix bytes in this node
+	inline uint8_t &Count(const ART &art) {
+		return data[art.prefix_count];
+	}
+	inline uint8_t Count(const ART &art) const {
+		return data[art.prefix_count];
+	}
+	//! Returns the pointer to the next Node
+	inline Node &Ptr(const ART &art) {
+		return *reinterpret_cast<Node *>(data + art.prefix_count + 1);
+	}
+	inline const Node &Ptr(const ART &art) const {
+		return *reinterpret_cast<const Node *>(data + art.prefix_count + 1);
+	}
+
 	//! Get a new empty prefix node, might cause a new buffer allocation
 	static Prefix &New(ART &art, Node &node);
 	//! Create a new prefix node containing a single byte and a pointer to a next node
@@ -60,8 +78,8 @@ public:
 	//! Returns the byte at position
 	static inline uint8_t GetByte(const ART &art, const Node &prefix_node, const idx_t position) {
 		auto &prefix = Node::Ref<const Prefix>(art, prefix_node, NType::PREFIX);
-		D_ASSERT(position < Node::PREFIX_SIZE);
-		D_ASSERT(position < prefix.data[Node::PREFIX_SIZE]);
+		D_ASSERT(position < art.prefix_count);
+		D_ASSERT(position < prefix.Count(art));
 		return prefix.data[position];
 	}
 	//! Removes the first n bytes from the prefix and shifts all subsequent bytes in the
@@ -53,6 +53,9 @@ public:
 
 	//! Returns the in-memory size in bytes
 	idx_t GetInMemorySize() const;
+	//! Unpins all unchanged on-disk buffers that were pinned since the last call, so that the buffer manager can
+	//! evict them. There must not be any remaining pointers into these buffers
+	void UnpinBuffers();
 
 	//! Returns the upper bound of the available buffer IDs, i.e., upper_bound > max_buffer_id
 	idx_t GetUpperBoundBufferId() const;
@@ -84,6 +87,15 @@ public:
 	//! Deserializes all metadata of older storage files
 	void Deserialize(MetadataManager &metadata_manager, const BlockPointer &block_pointer);
 
+	//! Returns the allocation size of one segment
+	inline idx_t GetSegmentSize() const {
+		return segment_size;
+	}
+
+private:
+	//! Sets the segment size and calculates the buffer layout, i.e., how many segments fit into one buffer
+	void SetSegmentSize(const idx_t segment_size_p);
+
 private:
 	//! Allocation size of one segment in a buffer
 	//! We only need this value to calculate bitmask_count, bitmask_offset, and
@@ -107,6 +119,8 @@ private:
 	unordered_set<idx_t> buffers_with_free_space;
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
+	//! On-disk buffers that were pinned for reading since the last call to UnpinBuffers
+	vector<idx_t> pinned_buffers;
 
 private:
 	//! Returns the data_ptr_t to a segment, and sets the dirty flag of the buffer containing that segment
@@ -114,6 +128,9 @@ private:
 		D_ASSERT(ptr.GetOffset() < available_segments_per_buffer);
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		if (!dirty && !buffer.InMemory()) {
+			pinned_buffers.push_back(ptr.GetBufferId());
+		}
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
@@ -30,9 +30,9 @@ public:
 	void Merge(PartialBlock &other, idx_t offset, idx_t other_size) override;
 };
 
-//! A fixed-size buffer holds fixed-size segments of data. It lazily deserializes a buffer, if on-disk and not
-//! yet in memory, and it only serializes dirty and non-written buffers to disk during
-//! serialization.
+//! A fixed-size buffer holds fixed-size segments of data. It lazily pins its on-disk block, if not yet in memory,
+//! and only copies it into a new in-memory buffer before the first change. Unchanged buffers remain managed by
+//! the buffer manager, i.e., they can be evicted once unpinned, and they are not rewritten during serialization.
 class FixedSizeBuffer {
 public:
 	//! Constants for fast offset calculations in the bitmask
@@ -71,23 +71,39 @@ public:
 	inline bool OnDisk() const {
 		return block_pointer.IsValid();
 	}
-	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory
+	//! Returns a pointer to the buffer in memory, and pins the on-disk block, if the buffer is not in memory.
+	//! If dirty_p is true, then the buffer detaches from its on-disk block before returning the pointer
 	inline data_ptr_t Get(const bool dirty_p = true) {
 		if (!InMemory()) {
 			Pin();
 		}
 		if (dirty_p) {
-			dirty = dirty_p;
+			if (OnDisk()) {
+				Detach();
+			}
+			dirty = true;
+		}
+		if (OnDisk()) {
+			return buffer_handle.Ptr() + block_pointer.offset;
 		}
 		return buffer_handle.Ptr();
 	}
+	//! Unpins an unchanged on-disk buffer, which allows the buffer manager to evict its block
+	inline void Unpin() {
+		if (InMemory() && OnDisk()) {
+			D_ASSERT(!dirty);
+			buffer_handle.Destroy();
+		}
+	}
 	//! Destroys the in-memory buffer and the on-disk block
 	void Destroy();
 	//! Serializes a buffer (if dirty or not on disk)
 	void Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments, const idx_t segment_size,
 	               const idx_t bitmask_offset);
-	//! Pin a buffer (if not in-memory)
+	//! Pin the on-disk block of a buffer (if not in-memory)
 	void Pin();
+	//! Copies the pinned on-disk block into a new in-memory buffer, which we can then modify
+	void Detach();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
 	//! Sets the allocation size, if dirty
@@ -49,12 +49,15 @@ private:
    data ptrs. The storage looks like this internally.
    [SERIALIZED ROW][NEXT POINTER]
    [SERIALIZED ROW][NEXT POINTER]
-   There is a separate hash map of pointers that point into this table.
+   There is a separate hash map of entries that point into this table.
    This is what is used to resolve the hashes.
-   [POINTER]
-   [POINTER]
-   [POINTER]
-   The pointers are either NULL
+   [SALT][POINTER]
+   [SALT][POINTER]
+   [SALT][POINTER]
+   The entries are either empty (0), or hold the upper 16 bits of the hash (the salt)
+   and a 48-bit pointer to the head of a chain of rows that have this salt.
+   Collisions are resolved with linear probing, so probes can skip chains
+   with a different salt without having to touch the rows.
 */
 class JoinHashTable {
 public:
@@ -73,12 +76,21 @@ public:
 		unsafe_unique_array<bool> found_match;
 		JoinHashTable &ht;
 		bool finished;
+		//! The number of key comparisons done while following the pointer chains
+		idx_t comparisons = 0;
+		//! The number of key comparisons that found a match
+		idx_t matches = 0;
+		//! Whether Next only collects the matches, because the probe tuples are probed again with the next slice of
+		//! the partition (see JoinHashTable::ProbesSliceMatches)
+		bool slice_matches_only = false;
 
 		explicit ScanStructure(JoinHashTable &ht, TupleDataChunkState &key_state);
 		//! Get the next batch of data from the scan structure
 		void Next(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Are pointer chains all pointing to NULL?
 		bool PointersExhausted();
+		//! Set the matches that the probe tuples found in the previous slices of the partition
+		void SetPreviousMatches(Vector &matches, idx_t count);
 
 	private:
 		//! Next operator for the inner join
@@ -93,6 +105,8 @@ public:
 		void NextMarkJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Next operator for the single join
 		void NextSingleJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
+		//! Next operator for a slice of the partition that is not the last one (only the inner join result)
+		void NextSliceMatches(DataChunk &keys, DataChunk &left, DataChunk &result);
 
 		//! Scan the hashtable for matches of the specified keys, setting the found_match[] array to true or false
 		//! for every tuple
@@ -188,7 +202,7 @@ public:
 	bool finalized;
 	//! Whether or not any of the key elements contain NULL
 	bool has_null;
-	//! Bitmask for getting relevant bits from the hashes to determine the position
+	//! Bitmask for getting relevant bits from the hashes to determine the position in the pointer table
 	uint64_t bitmask;
 
 	struct {
@@ -213,9 +227,8 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Find the heads of the row chains for the given hashes (nullptr if there is none)
+	void GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -270,6 +283,27 @@ public:
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
+		//! Whether the probe data of this round has the matches of the previous slices as an extra BOOLEAN column
+		bool ProbesSliceMatches() const {
+			return probes_slice_matches;
+		}
+		//! Whether the probe data of this round is probed again with the next slice of the partition
+		bool HasNextSlice() const {
+			return next_slice_collection != nullptr;
+		}
+		//! The types of the probe data (probe types + BOOLEAN) if ProbesSliceMatches
+		const vector<LogicalType> &GetSliceTypes() const {
+			return slice_types;
+		}
+		//! Append the probed chunk with its matches so far, for the next slice of the partition
+		void AppendSliceMatches(DataChunk &chunk, const bool found_match[]);
+
+	private:
+		//! Repartition the remaining probe data with the current number of radix bits of the HT
+		void Repartition();
+		//! Split the data of partition_idx into the partitions before and after the cutoff
+		void SplitPartition(idx_t partition_idx, idx_t cutoff);
+
 	private:
 		JoinHashTable &ht;
 		mutex lock;
@@ -279,14 +313,26 @@ public:
 		const vector<LogicalType> &probe_types;
 		//! The column ids
 		vector<column_t> column_ids;
+		//! The types and column ids of the probe data with the matches of the previous slices
+		vector<LogicalType> slice_types;
+		vector<column_t> slice_column_ids;
 
 		//! The partitioned probe data and append states
-		unique_ptr<PartitionedColumnData> global_partitions;
+		unique_ptr<RadixPartitionedColumnData> global_partitions;
 		vector<unique_ptr<PartitionedColumnData>> local_partitions;
 		vector<unique_ptr<PartitionedColumnDataAppendState>> local_partition_append_states;
 
+		//! The number of partitions that the data in each partition belongs to (see JoinHashTable::partition_spans)
+		vector<idx_t> partition_spans;
+
 		//! The active probe data
 		unique_ptr<ColumnDataCollection> global_spill_collection;
+
+		//! Whether the active probe data has the matches of the previous slices
+		bool probes_slice_matches;
+		//! The probe data with its matches for the next slice of the partition
+		unique_ptr<ColumnDataCollection> next_slice_collection;
+		ColumnDataAppendState next_slice_append_state;
 	};
 
 	idx_t GetRadixBits() const {
@@ -301,6 +347,11 @@ public:
 		return partition_end;
 	}
 
+	//! Whether partition_start is built in slices, and the probe tuples keep track of their matches over the slices
+	bool ProbesSliceMatches() const {
+		return probing_slices && SlicesTrackProbeMatches();
+	}
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -308,7 +359,7 @@ public:
 	}
 	//! Size of the pointer table (in bytes)
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		return PointerTableCapacity(count) * sizeof(hash_t);
 	}
 
 	//! Get total size of HT if all partitions would be built
@@ -333,6 +384,21 @@ public:
 	                                        ProbeSpill &probe_spill, ProbeSpillLocalAppendState &spill_state,
 	                                        DataChunk &spill_chunk);
 
+private:
+	//! Whether a partition can be built and probed in slices (if it does not fit in memory by itself)
+	bool CanBuildPartitionInSlices() const;
+	//! Whether the probe tuples have to carry their matches from slice to slice
+	bool SlicesTrackProbeMatches() const;
+	//! The number of partitions that the data in partition_idx belongs to
+	idx_t PartitionSpan(idx_t partition_idx) const;
+	//! Number of radix bits to add so that a partition of the given size is estimated to fit in max_ht_size / 4
+	idx_t GetAddedRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
+	                        const idx_t max_partition_count) const;
+	//! Splits partition_start with more radix bits because it does not fit in max_ht_size
+	void RepartitionRemaining(const idx_t max_ht_size);
+	//! Builds the next slice of partition_start that fits in max_ht_size into the data collection
+	void BuildPartitionSlice(const idx_t max_ht_size);
+
 private:
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
@@ -340,6 +406,15 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+
+	//! Only the partition that does not fit is repartitioned with more radix bits, the data of the other unbuilt
+	//! partitions is moved to the first of the partitions it belongs to, and spans that many partitions (empty = 1)
+	vector<idx_t> partition_spans;
+
+	//! Iterator over partition_start if it is built and probed in slices (if it does not fit in memory by itself)
+	unique_ptr<TupleDataChunkIterator> partition_slice_iterator;
+	//! Whether the current probe round probes a slice of partition_start
+	bool probing_slices;
 };
 
 } // namespace duckdb
@@ -104,6 +104,13 @@ struct MergeSortTree {
 	}
 	explicit MergeSortTree(Elements &&lowest_level, const CMP &cmp = CMP());
 
+	//! Allocate the levels above the lowest one, whose runs can then be built independently
+	void AllocateLevels();
+	//! The number of runs in a level above the lowest one
+	idx_t RunCount(idx_t level) const;
+	//! Build a run of a level by merging the runs of the level below it
+	void BuildRun(idx_t level, idx_t run_idx);
+
 	idx_t SelectNth(const SubFrames &frames, idx_t n) const;
 
 	inline ElementType NthElement(idx_t i) const {
@@ -251,91 +258,132 @@ protected:
 
 template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
 MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp) : cmp(cmp) {
-	const auto fanout = F;
-	const auto cascading = C;
-	const auto count = lowest_level.size();
 	tree.emplace_back(Level(std::move(lowest_level), Offsets()));
 
-	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
-
 	//	Fan in parent levels until we are at the top
+	AllocateLevels();
+	for (idx_t level = 1; level < tree.size(); ++level) {
+		const auto num_runs = RunCount(level);
+		for (idx_t run_idx = 0; run_idx < num_runs; ++run_idx) {
+			BuildRun(level, run_idx);
+		}
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::AllocateLevels() {
+	const auto fanout = F;
+	const auto cascading = C;
+	const auto count = tree.front().first.size();
+
 	//	Note that we don't build the top layer as that would just be all the data.
 	for (idx_t child_run_length = 1; child_run_length < count;) {
 		const auto run_length = child_run_length * fanout;
 		const auto num_runs = (count + run_length - 1) / run_length;
 
-		Elements elements;
-		elements.reserve(count);
+		Elements elements(count);
 
-		//	Allocate cascading pointers only if there is room
+		//	Allocate cascading pointers only if there is room:
+		//	one set per cascading boundary of the level and two terminal sets per run
 		Offsets cascades;
 		if (cascading > 0 && run_length > cascading) {
-			const auto num_cascades = fanout * num_runs * (run_length / cascading + 2);
-			cascades.reserve(num_cascades);
+			const auto num_cascades = fanout * ((count + cascading - 1) / cascading + 2 * num_runs);
+			cascades.resize(num_cascades);
 		}
 
-		//	Create each parent run by merging the child runs using a tournament tree
-		// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
-		//	TODO: Because the runs are independent, they can be parallelised with parallel_for
-		const auto &child_level = tree.back();
-		for (idx_t run_idx = 0; run_idx < num_runs; ++run_idx) {
-			//	Position markers for scanning the children.
-			using Bounds = pair<idx_t, idx_t>;
-			array<Bounds, fanout> bounds;
-			//	Start with first element of each (sorted) child run
-			RunElements players;
-			const auto child_base = run_idx * run_length;
-			for (idx_t child_run = 0; child_run < fanout; ++child_run) {
-				const auto child_idx = child_base + child_run * child_run_length;
-				bounds[child_run] = {MinValue<idx_t>(child_idx, count),
-				                     MinValue<idx_t>(child_idx + child_run_length, count)};
-				if (bounds[child_run].first != bounds[child_run].second) {
-					players[child_run] = {child_level.first[child_idx], child_run};
-				} else {
-					//	Empty child
-					players[child_run] = SENTINEL;
-				}
-			}
+		tree.emplace_back(std::move(elements), std::move(cascades));
+		child_run_length = run_length;
+	}
+}
 
-			//	Play the first round and extract the winner
-			Games games;
-			auto winner = StartGames(games, players, SENTINEL);
-			while (winner != SENTINEL) {
-				// Add fractional cascading pointers
-				// if we are on a fraction boundary
-				if (cascading > 0 && run_length > cascading && elements.size() % cascading == 0) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+idx_t MergeSortTree<E, O, CMP, F, C>::RunCount(idx_t level) const {
+	D_ASSERT(level > 0 && level < tree.size());
+	idx_t run_length = 1;
+	for (idx_t i = 0; i < level; ++i) {
+		run_length *= F;
+	}
+	const auto count = tree.front().first.size();
+	return (count + run_length - 1) / run_length;
+}
 
-				//	Insert new winner element into the current run
-				elements.emplace_back(winner.first);
-				const auto child_run = winner.second;
-				auto &child_idx = bounds[child_run].first;
-				++child_idx;
-
-				//	Move to the next entry in the child run (if any)
-				if (child_idx < bounds[child_run].second) {
-					winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
-				} else {
-					winner = ReplayGames(games, child_run, SENTINEL);
-				}
-			}
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::BuildRun(idx_t level, idx_t run_idx) {
+	D_ASSERT(level > 0 && level < tree.size());
+	const auto fanout = F;
+	const auto cascading = C;
+	const auto count = tree.front().first.size();
 
-			// Add terminal cascade pointers to the end
-			if (cascading > 0 && run_length > cascading) {
-				for (idx_t j = 0; j < 2; ++j) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+	idx_t child_run_length = 1;
+	for (idx_t i = 1; i < level; ++i) {
+		child_run_length *= fanout;
+	}
+	const auto run_length = child_run_length * fanout;
+
+	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
+
+	//	Create the parent run by merging the child runs using a tournament tree
+	// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
+	//	The runs are independent, so they write to their own ranges of the (preallocated) level.
+	const auto &child_level = tree[level - 1];
+	auto &elements = tree[level].first;
+	auto &cascades = tree[level].second;
+	const auto has_cascades = cascading > 0 && run_length > cascading;
+
+	//	Position markers for scanning the children.
+	using Bounds = pair<idx_t, idx_t>;
+	array<Bounds, fanout> bounds;
+	//	Start with first element of each (sorted) child run
+	RunElements players;
+	const auto child_base = run_idx * run_length;
+	for (idx_t child_run = 0; child_run < fanout; ++child_run) {
+		const auto child_idx = child_base + child_run * child_run_length;
+		bounds[child_run] = {MinValue<idx_t>(child_idx, count), MinValue<idx_t>(child_idx + child_run_length, count)};
+		if (bounds[child_run].first != bounds[child_run].second) {
+			players[child_run] = {child_level.first[child_idx], child_run};
+		} else {
+			//	Empty child
+			players[child_run] = SENTINEL;
+		}
+	}
+
+	//	The preceding runs contain a set of cascading pointers per boundary and two terminal sets
+	auto element_idx = child_base;
+	auto cascade_idx = fanout * ((child_base + cascading - 1) / cascading + 2 * run_idx);
+
+	//	Play the first round and extract the winner
+	Games games;
+	auto winner = StartGames(games, players, SENTINEL);
+	while (winner != SENTINEL) {
+		// Add fractional cascading pointers
+		// if we are on a fraction boundary
+		if (has_cascades && element_idx % cascading == 0) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				cascades[cascade_idx++] = bounds[i].first;
 			}
 		}
 
-		//	Insert completed level and move up to the next one
-		tree.emplace_back(std::move(elements), std::move(cascades));
-		child_run_length = run_length;
+		//	Insert new winner element into the current run
+		elements[element_idx++] = winner.first;
+		const auto child_run = winner.second;
+		auto &child_idx = bounds[child_run].first;
+		++child_idx;
+
+		//	Move to the next entry in the child run (if any)
+		if (child_idx < bounds[child_run].second) {
+			winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
+		} else {
+			winner = ReplayGames(games, child_run, SENTINEL);
+		}
+	}
+
+	// Add terminal cascade pointers to the end
+	if (has_cascades) {
+		for (idx_t j = 0; j < 2; ++j) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				cascades[cascade_idx++] = bounds[i].first;
+			}
+		}
 	}
 }
 
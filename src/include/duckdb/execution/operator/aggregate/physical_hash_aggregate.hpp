@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/execution/operator/aggregate/distinct_aggregate_data.hpp"
 #include "duckdb/execution/operator/aggregate/grouped_aggregate_data.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -29,9 +30,12 @@ public:
 public:
 	RadixPartitionedHashTable table_data;
 	unique_ptr<DistinctAggregateData> distinct_data;
+	//! The finer grouping set whose aggregate states this grouping set is computed from (if any)
+	optional_idx source_grouping;
 
 public:
 	bool HasDistinct() const;
+	bool IsDerived() const;
 };
 
 struct HashAggregateGroupingGlobalState {
@@ -76,6 +80,8 @@ public:
 	vector<GroupingSet> grouping_sets;
 	//! The radix partitioned hash tables (one per grouping set)
 	vector<HashAggregateGroupingData> groupings;
+	//! The grouping sets that are derived from a finer grouping set instead of the input, finest first
+	vector<idx_t> derived_groupings;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
 	//! A recreation of the input chunk, with nulls for everything that isnt a group
 	vector<LogicalType> input_group_types;
@@ -139,6 +145,10 @@ public:
 private:
 	//! When we only have distinct aggregates, we can delay adding groups to the main ht
 	bool CanSkipRegularSink() const;
+	//! Whether coarser grouping sets can be computed by combining the aggregate states of finer grouping sets
+	bool CanDeriveGroupings() const;
+	//! Choose a finer grouping set to derive each grouping set from (if any)
+	void InitializeDerivedGroupings();
 
 	//! Finalize the distinct aggregates
 	SinkFinalizeType FinalizeDistinct(Pipeline &pipeline, Event &event, ClientContext &context,
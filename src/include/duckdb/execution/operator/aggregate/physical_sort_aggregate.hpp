@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+class ArenaAllocator;
+
+//! PhysicalSortAggregate computes a GROUP BY over input that is sorted on the groups, which are the first columns of
+//! the input. Because every group is a contiguous run of rows, only the states of the groups in the current chunk are
+//! alive, so holistic aggregates (quantile, mode) need memory for one group instead of for all groups. It requires
+//! (1) a single grouping set, (2) no DISTINCT aggregates and (3) combineable aggregates, as the groups that span two
+//! batches are combined in the Finalize.
+class PhysicalSortAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::SORT_GROUP_BY;
+
+public:
+	PhysicalSortAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> expressions,
+	                      vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+	~PhysicalSortAggregate() override;
+
+	//! The groups, which reference the first columns of the input
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+	//! The offset of the state of each aggregate within the states of a group
+	vector<idx_t> state_offsets;
+	//! The size of the states of a group
+	idx_t state_size;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+	bool ParallelSource() const override {
+		return true;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+	bool RequiresBatchIndex() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+
+public:
+	//! Initializes the aggregate states of a group
+	void InitializeStates(data_ptr_t states) const;
+	//! Finalizes the aggregates of "count" groups into the aggregate columns of the result, starting at "offset"
+	void FinalizeStates(data_ptr_t states[], idx_t count, ArenaAllocator &allocator, DataChunk &result,
+	                    idx_t offset) const;
+	//! Combines the aggregate states of a group into the states of the same group
+	void CombineStates(data_ptr_t source, data_ptr_t target, ArenaAllocator &allocator) const;
+	//! Destroys the aggregate states of "count" groups
+	void DestroyStates(data_ptr_t states[], idx_t count, ArenaAllocator &allocator) const;
+};
+
+} // namespace duckdb
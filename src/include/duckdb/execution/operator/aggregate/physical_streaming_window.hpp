@@ -13,7 +13,9 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions, i.e. window functions without a PARTITION BY that
+//! can be computed in a single pass over the (ordered) input: an empty OVER clause, LEAD/LAG with constant offsets and
+//! aggregates over ROWS frames with constant bounds
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
@@ -26,18 +28,33 @@ public:
 	//! The projection list of the WINDOW statement
 	vector<unique_ptr<Expression>> select_list;
 
+public:
+	//! Whether the window function can be computed by a streaming window
+	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr);
+
 public:
 	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
 
 	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	//! Functions that look at following rows (e.g. LEAD) delay their output until these rows have been seen
+	bool RequiresFinalExecute() const override;
 
 	OrderPreservationType OperatorOrder() const override {
 		return OrderPreservationType::FIXED_ORDER;
 	}
 
 	string ParamsToString() const override;
+
+private:
+	void ExecuteFunctions(ExecutionContext &context, DataChunk &chunk, DataChunk &rows, idx_t begin, idx_t count,
+	                      GlobalOperatorState &gstate, OperatorState &state) const;
+	void ExecuteDelayed(ExecutionContext &context, DataChunk &chunk, idx_t count, GlobalOperatorState &gstate,
+	                    OperatorState &state) const;
 };
 
 } // namespace duckdb
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class DataChunk;
+class PhysicalOperator;
+
+struct JoinFilterPushdownColumn {
+	//! The filter (index into JoinFilterPushdownInfo::join_condition) to push
+	idx_t filter_idx;
+	//! The column index (into the column_ids of the scan) the filter is pushed into
+	idx_t probe_column_index;
+};
+
+struct JoinFilterPushdownFilter {
+	//! The dynamic filters of the scan on the probe side
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The columns of the scan to push filters into
+	vector<JoinFilterPushdownColumn> columns;
+};
+
+//! Local (per-thread) state for collecting the build-side join filters
+struct JoinFilterLocalState {
+	//! Min/max of the build-side keys (NULL if no non-NULL key has been seen yet)
+	vector<Value> min;
+	vector<Value> max;
+	//! Bloom filters over the build-side keys (nullptr if not enabled)
+	vector<unique_ptr<BloomFilter>> bloom_filters;
+};
+
+//! Global state for collecting the build-side join filters
+struct JoinFilterGlobalState : public JoinFilterLocalState {
+	mutex lock;
+};
+
+//! JoinFilterPushdownInfo describes which filters a hash join should derive from its build side, and which table scans
+//! on the probe side it should push them into once the build side is complete
+struct JoinFilterPushdownInfo {
+	//! The join conditions (indices into the conditions of the join) to derive filters from
+	vector<idx_t> join_condition;
+	//! The scans on the probe side to push filters into
+	vector<JoinFilterPushdownFilter> probe_info;
+
+public:
+	//! Whether or not we can derive a join filter for a join key of the given type
+	static bool CanPushFilter(const LogicalType &type);
+
+	unique_ptr<JoinFilterGlobalState> GetGlobalState(const vector<LogicalType> &condition_types,
+	                                                 idx_t build_cardinality) const;
+	unique_ptr<JoinFilterLocalState> GetLocalState(const vector<LogicalType> &condition_types,
+	                                               idx_t build_cardinality) const;
+
+	//! Update the filters with the join keys of the build side
+	void Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const;
+	//! Merge a local state into the global state
+	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
+	//! Push the collected filters into the probe-side scans
+	void PushFilters(const PhysicalOperator &op, JoinFilterGlobalState &gstate, idx_t build_count) const;
+
+private:
+	void InitializeState(JoinFilterLocalState &state, const vector<LogicalType> &condition_types,
+	                     idx_t build_cardinality) const;
+};
+
+} // namespace duckdb
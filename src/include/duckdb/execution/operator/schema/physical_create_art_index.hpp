@@ -23,6 +23,8 @@ class DuckTableEntry;
 class PhysicalCreateARTIndex : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
+	//! The minimum number of rows of each thread-local index of a key range, if we partition the keys by key ranges
+	static constexpr idx_t PARTITION_MIN_ROWS = 65536;
 
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
@@ -58,11 +60,15 @@ public:
 	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
 	//! Sink for sorted data: build + merge
 	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
+	//! Sink for data partitioned by key ranges: insert iteratively into the index of each key's range
+	SinkResultType SinkPartitioned(Vector &row_identifiers, OperatorSinkInput &input) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
+	//! Adds the fully merged global index to the table and the catalog
+	void FinalizeIndex(ClientContext &context, GlobalSinkState &gstate) const;
 
 	bool IsSink() const override {
 		return true;
@@ -39,6 +39,9 @@ public:
 
 	void Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input, DataChunk &aggregate_input_chunk,
 	          const unsafe_vector<idx_t> &filter) const;
+	//! Sink the thread-local aggregate states of a finer grouping set (that contains this one) into this HT
+	void SinkStates(ExecutionContext &context, const RadixPartitionedHashTable &finer, LocalSinkState &finer_lstate,
+	                OperatorSinkInput &input) const;
 	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const;
 	void Finalize(ClientContext &context, GlobalSinkState &gstate) const;
 
@@ -150,6 +150,10 @@ public:
 	virtual void Finalize() {
 	}
 
+	//! Build the data structures for evaluation after Finalize. This can be called by several threads at once.
+	virtual void Build() {
+	}
+
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorState &lstate) const;
@@ -163,7 +167,6 @@ protected:
 	const ValidityMask &order_mask;
 
 	// Expression collections
-	DataChunk payload_collection;
 	ExpressionExecutor payload_executor;
 	DataChunk payload_chunk;
 
@@ -185,6 +188,7 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	void Build() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
@@ -262,6 +266,8 @@ public:
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
 protected:
+	//! The partition payload, in buffer-managed storage that can be evicted
+	unique_ptr<ColumnDataCollection> payload_collection;
 	// IGNORE NULLS
 	ValidityMask ignore_nulls;
 };
@@ -8,16 +8,70 @@
 
 #pragma once
 
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
 #include "duckdb/parser/expression/window_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
+//! A flat array of intermediate aggregate states, e.g. the internal nodes of a segment tree. Arrays of at least a block
+//! are allocated by the buffer manager and are only pinned while they are in use, so they can be evicted in between.
+class WindowStateArray {
+public:
+	//! Allocate the array, which stays pinned as long as the handle
+	data_ptr_t Allocate(ClientContext &context, idx_t size, BufferHandle &pin);
+	//! Pin the array
+	data_ptr_t Pin(BufferHandle &pin) const;
+
+private:
+	//! The buffer manager that owns the block
+	mutable optional_ptr<BufferManager> buffer_manager;
+	//! The block of a buffer-managed array
+	mutable shared_ptr<BlockHandle> block;
+	//! Small arrays are allocated directly
+	unsafe_unique_array<data_t> data;
+};
+
+//! A cursor over the rows of a partition stored in a ColumnDataCollection. Only the chunk containing the current row
+//! is read into memory, so the rest of the collection can be evicted.
+class WindowCursor {
+public:
+	explicit WindowCursor(const ColumnDataCollection &collection);
+
+	//! Is the row in the current chunk?
+	inline bool RowIsVisible(idx_t row) const {
+		return chunk_begin <= row && row < chunk_end;
+	}
+	//! Move to the chunk containing the row and return the index of the row in that chunk
+	inline idx_t Seek(idx_t row) {
+		if (!RowIsVisible(row)) {
+			FetchChunk(row);
+		}
+		return row - chunk_begin;
+	}
+
+	//! The collection being read
+	const ColumnDataCollection &collection;
+	//! The current chunk
+	DataChunk chunk;
+	//! The first row in the current chunk
+	idx_t chunk_begin;
+	//! One past the last row in the current chunk
+	idx_t chunk_end;
+
+private:
+	void FetchChunk(idx_t row);
+};
+
 class WindowAggregatorState {
 public:
 	WindowAggregatorState();
@@ -42,12 +96,15 @@ public:
 class WindowAggregator {
 public:
 	WindowAggregator(AggregateObject aggr, const LogicalType &result_type_p, const WindowExcludeMode exclude_mode_p,
-	                 idx_t partition_count);
+	                 idx_t partition_count, ClientContext &context);
 	virtual ~WindowAggregator();
 
 	//	Access
-	const DataChunk &GetInputs() const {
-		return inputs;
+	optional_ptr<const ColumnDataCollection> GetInputs() const {
+		return inputs.get();
+	}
+	idx_t GetInputCount() const {
+		return inputs ? inputs->Count() : flat_inputs.size();
 	}
 	const ValidityMask &GetFilterMask() const {
 		return filter_mask;
@@ -56,6 +113,9 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! Build the data structures set up by Finalize. Any number of threads can call this at the same time to share
+	//! the work, and it returns once everything has been built.
+	void Build();
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -70,10 +130,17 @@ public:
 	const idx_t partition_count;
 	//! The size of a single aggregate state
 	const idx_t state_size;
+	//! The client context
+	ClientContext &context;
 
 protected:
-	//! Partition data chunk
-	DataChunk inputs;
+	//! Partition data, in buffer-managed storage that can be evicted
+	unique_ptr<ColumnDataCollection> inputs;
+	//! Partition data as flat vectors, for custom aggregates, whose window API needs random access to the whole
+	//! partition. This memory is accounted for, but cannot be evicted.
+	DataChunk flat_inputs;
+	//! Whether the partition data is materialised in flat_inputs instead of inputs
+	bool use_flat_inputs;
 
 	//! The filtered rows in inputs.
 	vector<validity_t> filter_bits;
@@ -82,6 +149,36 @@ protected:
 	//! The state used by the aggregator to build.
 	unique_ptr<WindowAggregatorState> gstate;
 
+	//! Start a parallel build with the given number of tasks in its first stage
+	void StartBuild(idx_t task_count);
+	//! Execute one task of a build stage, using a state that belongs to the calling thread
+	virtual void BuildTask(WindowAggregatorState &build_state, idx_t stage, idx_t task_idx) {
+	}
+	//! Called by the thread that completes the last task of a stage.
+	//! Returns the number of tasks of the next stage, or zero if the build is complete.
+	virtual idx_t FinishBuildStage(idx_t stage) {
+		return 0;
+	}
+
+	//! Serialise access to the build stages
+	mutex build_lock;
+	//! Signalled when a build stage starts or completes, or when a build task fails
+	std::condition_variable build_cv;
+	//! The current build stage
+	idx_t build_stage;
+	//! The number of tasks in the current build stage
+	idx_t build_tasks;
+	//! The number of tasks that have been started
+	idx_t build_started;
+	//! The number of tasks that have been completed
+	idx_t build_completed;
+	//! Whether a build task failed
+	bool build_failed;
+	//! The error of the first build task that failed, which is reported by every building thread
+	ErrorData build_error;
+	//! The states used by the building threads, which own the memory of the states they built
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+
 public:
 	//! The window exclusion clause
 	const WindowExcludeMode exclude_mode;
@@ -91,7 +188,7 @@ public:
 class WindowNaiveAggregator : public WindowAggregator {
 public:
 	WindowNaiveAggregator(AggregateObject aggr, const LogicalType &result_type_p,
-	                      const WindowExcludeMode exclude_mode_p, idx_t partition_count);
+	                      const WindowExcludeMode exclude_mode_p, idx_t partition_count, ClientContext &context);
 	~WindowNaiveAggregator() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
@@ -102,7 +199,7 @@ public:
 class WindowConstantAggregator : public WindowAggregator {
 public:
 	WindowConstantAggregator(AggregateObject aggr, const LogicalType &result_type_p, const ValidityMask &partition_mask,
-	                         WindowExcludeMode exclude_mode_p, const idx_t count);
+	                         WindowExcludeMode exclude_mode_p, const idx_t count, ClientContext &context);
 	~WindowConstantAggregator() override {
 	}
 
@@ -125,6 +222,8 @@ private:
 	idx_t partition;
 	//! The current input row being built/read
 	idx_t row;
+	//! The rows of the current payload chunk that belong to the current partition
+	DataChunk slice;
 	//! Data pointer that contains a single state, used for intermediate window segment aggregation
 	vector<data_t> state;
 	//! A vector of pointers to "state", used for intermediate window segment aggregation
@@ -136,7 +235,7 @@ private:
 class WindowCustomAggregator : public WindowAggregator {
 public:
 	WindowCustomAggregator(AggregateObject aggr, const LogicalType &result_type_p,
-	                       const WindowExcludeMode exclude_mode_p, idx_t partition_count);
+	                       const WindowExcludeMode exclude_mode_p, idx_t partition_count, ClientContext &context);
 	~WindowCustomAggregator() override;
 
 	void Finalize(const FrameStats &stats) override;
@@ -156,7 +255,7 @@ class WindowSegmentTree : public WindowAggregator {
 
 public:
 	WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
-	                  const WindowExcludeMode exclude_mode_p, idx_t count);
+	                  const WindowExcludeMode exclude_mode_p, idx_t count, ClientContext &context);
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
@@ -165,8 +264,15 @@ public:
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
 	              idx_t row_idx) const override;
 
+protected:
+	//! Each stage builds a level of the tree in tasks of BUILD_NODES nodes
+	void BuildTask(WindowAggregatorState &build_state, idx_t stage, idx_t task_idx) override;
+	idx_t FinishBuildStage(idx_t stage) override;
+
 public:
 	void ConstructTree();
+	//! The number of build tasks for a level
+	idx_t LevelTasks(idx_t level) const;
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -174,7 +280,7 @@ public:
 	}
 
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
-	unsafe_unique_array<data_t> levels_flat_native;
+	WindowStateArray levels_flat_native;
 	//! For each level, the starting location in the levels_flat_native array
 	vector<idx_t> levels_flat_start;
 
@@ -186,8 +292,12 @@ public:
 
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of nodes built by a single build task
+	static constexpr idx_t BUILD_NODES = STANDARD_VECTOR_SIZE;
 };
 
+//! Computes DISTINCT aggregates with a merge sort tree over the previous occurrence of each value. The inputs and the
+//! aggregate states are buffer-managed, but the index levels of the tree are kept in memory.
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	using GlobalSortStatePtr = unique_ptr<GlobalSortState>;
@@ -206,10 +316,12 @@ public:
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
 	              idx_t row_idx) const override;
 
-	ClientContext &context;
+	//! The stages of building the merge sort tree
+	enum class DistinctBuildStage : uint8_t { MERGE, PREV_IDCS, ZIPPED, LEAF_STATES, STATES };
+
 	ArenaAllocator allocator;
 
-	//	Single threaded sorting for now
+	//	Sorting is single threaded, but the merges are shared by the building threads
 	GlobalSortStatePtr global_sort;
 	LocalSortState local_sort;
 	idx_t payload_pos;
@@ -221,14 +333,26 @@ public:
 
 	//! The merge sort tree for the aggregate.
 	unique_ptr<DistinctSortTree> merge_sort_tree;
+	//! The current build stage
+	DistinctBuildStage distinct_stage;
+	//! The level of the merge sort tree that is being built
+	idx_t build_level;
+	//! For each level, the first state build task
+	vector<idx_t> build_level_tasks;
+	//! The number of state build tasks of all levels
+	idx_t state_tasks;
 
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
-	unsafe_unique_array<data_t> levels_flat_native;
+	WindowStateArray levels_flat_native;
 	//! For each level, the starting location in the levels_flat_native array
 	vector<idx_t> levels_flat_start;
 
 	//! The total number of internal nodes of the tree, stored in levels_flat_native
 	idx_t internal_nodes;
+
+protected:
+	void BuildTask(WindowAggregatorState &build_state, idx_t stage, idx_t task_idx) override;
+	idx_t FinishBuildStage(idx_t stage) override;
 };
 
 } // namespace duckdb
@@ -149,6 +149,8 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! Whether the state keeps (a summary of) every input value of its group, e.g. quantile or mode
+	bool holistic = false;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
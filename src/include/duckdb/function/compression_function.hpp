@@ -21,6 +21,7 @@ class DatabaseInstance;
 class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
+class TableFilter;
 class SegmentStatistics;
 struct ColumnSegmentState;
 
@@ -142,6 +143,10 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for reading an entire vector (STANDARD_VECTOR_SIZE) and applying a filter to it, which
+//! allows the filter to be evaluated on the compressed representation of the data
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -226,6 +231,9 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Scan an entire vector and apply a filter to it (optional)
+	//! the result vector must contain the scanned values, the selection vector only the rows that pass the filter
+	compression_filter_t filter = nullptr;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
@@ -17,11 +17,12 @@ class DuckTableEntry;
 class TableCatalogEntry;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
-	}
+	explicit TableScanBindData(DuckTableEntry &table);
 
 	//! The table to scan
 	DuckTableEntry &table;
+	//! The data version of the table when the scan was bound, i.e. before the optimizer read its statistics
+	idx_t data_version;
 
 	//! Whether or not the table scan is an index scan
 	bool is_index_scan;
@@ -29,6 +30,11 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch (in case of an index scan)
 	vector<row_t> result_ids;
+	//! The values of the key columns of the index for each of the row ids. If these are set and all scanned columns
+	//! are key columns, the index scan reads the columns from here instead of fetching them from the table
+	vector<Vector> key_columns;
+	//! The table column of each key column, or DConstants::INVALID_INDEX if the key is not a column
+	vector<column_t> key_column_ids;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
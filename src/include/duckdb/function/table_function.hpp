@@ -194,6 +194,8 @@ typedef OperatorFinalizeResultType (*table_in_out_function_final_t)(ExecutionCon
 typedef idx_t (*table_function_get_batch_index_t)(ClientContext &context, const FunctionData *bind_data,
                                                   LocalTableFunctionState *local_state,
                                                   GlobalTableFunctionState *global_state);
+typedef idx_t (*table_function_get_pruned_rows_t)(ClientContext &context, const FunctionData *bind_data,
+                                                  LocalTableFunctionState *local_state);
 
 typedef BindInfo (*table_function_get_bind_info_t)(const optional_ptr<FunctionData> bind_data);
 
@@ -264,6 +266,8 @@ public:
 	table_function_progress_t table_scan_progress;
 	//! (Optional) returns the current batch index of the current scan operator
 	table_function_get_batch_index_t get_batch_index;
+	//! (Optional) returns the number of rows the local state skipped using filter statistics since the last call
+	table_function_get_pruned_rows_t get_pruned_rows;
 	//! (Optional) returns extra bind info
 	table_function_get_bind_info_t get_bind_info;
 
@@ -280,6 +284,9 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function supports filters that are only known at run-time (e.g. the min/max and bloom
+	//! filters created by the build side of a hash join). These are pushed into the scan when it is initialized.
+	bool dynamic_filter_pushdown = false;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
@@ -14,6 +14,7 @@
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/parallel/task.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -96,6 +97,11 @@ struct ClientConfig {
 	//! The explain output type used when none is specified (default: PHYSICAL_ONLY)
 	ExplainOutputType explain_output_type = ExplainOutputType::PHYSICAL_ONLY;
 
+	//! The priority class of the tasks of queries issued by this connection
+	TaskPriority query_priority = TaskPriority::NORMAL;
+	//! The maximum amount of threads that can execute a query of this connection concurrently (0 = no limit)
+	idx_t query_max_threads = 0;
+
 	//! The maximum amount of pivot columns
 	idx_t pivot_limit = 100000;
 
@@ -110,6 +116,9 @@ struct ClientConfig {
 
 	//! Generic options
 	case_insensitive_map_t<Value> set_variables;
+	//! Whether or not any setting was changed for this connection only. Plans in the database-wide plan cache are not
+	//! used by such connections, as their settings can affect planning.
+	bool local_settings_modified = false;
 
 	//! Function that is used to create the result collector for a materialized result
 	//! Defaults to PhysicalMaterializedCollector
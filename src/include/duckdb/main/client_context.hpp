@@ -232,6 +232,11 @@ private:
 	unique_ptr<PendingQueryResult> PendingStatementInternal(ClientContextLock &lock, const string &query,
 	                                                        unique_ptr<SQLStatement> statement,
 	                                                        const PendingQueryParameters &parameters);
+	//! Executes the statement using a plan from the database-wide plan cache. Returns nullptr if the plan cache cannot
+	//! be used for the statement.
+	unique_ptr<PendingQueryResult> PendingStatementWithPlanCache(ClientContextLock &lock, const string &query,
+	                                                             SQLStatement &statement,
+	                                                             const PendingQueryParameters &parameters);
 	unique_ptr<QueryResult> RunStatementInternal(ClientContextLock &lock, const string &query,
 	                                             unique_ptr<SQLStatement> statement, bool allow_stream_result,
 	                                             bool verify = true);
@@ -266,7 +271,7 @@ private:
 
 	shared_ptr<PreparedStatementData>
 	CreatePreparedStatementInternal(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
-	                                optional_ptr<case_insensitive_map_t<Value>> values);
+	                                optional_ptr<case_insensitive_map_t<Value>> values, PreparedStatementMode mode);
 
 private:
 	//! Lock on using the ClientContext in parallel
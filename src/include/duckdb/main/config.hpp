@@ -16,6 +16,7 @@
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/enums/set_scope.hpp"
+#include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/set.hpp"
@@ -56,6 +57,16 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+//! How much effort is spent to make a commit durable before it returns
+enum class WALSynchronousMode : uint8_t {
+	//! The WAL is written to the OS only when its buffer is full or on checkpoint
+	OFF = 0,
+	//! The WAL is written to the OS on every commit, but not synced to disk
+	NORMAL = 1,
+	//! The WAL is written and synced to disk on every commit; concurrent commits share a single sync
+	FULL = 2
+};
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -98,6 +109,17 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints run on a background thread instead of inside the committing transaction
+	bool background_checkpoint = false;
+	//! The minimum time between two background checkpoints (in milliseconds)
+	idx_t background_checkpoint_interval = 0;
+	//! How long a background checkpoint can be postponed by transactions that modify the database in place before it
+	//! blocks new writers (in milliseconds)
+	idx_t background_checkpoint_timeout = 5000;
+	//! The maximum number of bytes per second written by a checkpoint (0 for no limit)
+	idx_t checkpoint_write_rate_limit = 0;
+	//! How the WAL is made durable when a transaction commits (OFF, NORMAL or FULL)
+	WALSynchronousMode synchronous = WALSynchronousMode::FULL;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -125,10 +147,16 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! Whether or not to pin the background threads to the CPUs of a NUMA node
+	ThreadPinMode pin_threads = ThreadPinMode::OFF;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress buffers that are written to the temporary directory
+	bool temp_file_compression = false;
+	//! The maximum number of plans in the database-wide plan cache, the plan cache is disabled if this is 0
+	idx_t plan_cache_size = 0;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -179,6 +207,10 @@ struct DBConfigOptions {
 	bool enable_fsst_vectors = false;
 	//! Start transactions immediately in all attached databases - instead of lazily when a database is referenced
 	bool immediate_transaction_mode = false;
+	//! The maximum number of rows an index scan fetches, regardless of the size of the table
+	idx_t index_scan_max_count = STANDARD_VECTOR_SIZE;
+	//! The maximum fraction of the rows of a table an index scan fetches, if that is more than index_scan_max_count
+	double index_scan_percentage = 0.001;
 	//! Debug setting - how to initialize  blocks in the storage layer when allocating
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 	//! The set of unrecognized (other) options
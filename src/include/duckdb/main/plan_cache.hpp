@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class LogicalOperator;
+class PhysicalOperator;
+class SQLStatement;
+struct PreparedStatementData;
+
+struct PlanCacheStatistics {
+	//! The number of queries that were executed using a cached plan
+	idx_t hits = 0;
+	//! The number of queries for which a new plan was created and added to the cache
+	idx_t misses = 0;
+	//! The number of plans that were removed because the cache was full
+	idx_t evictions = 0;
+	//! The number of plans currently in the cache
+	idx_t cached_plans = 0;
+};
+
+//! The PlanCache holds prepared plans of SELECT statements that can be shared between the connections of a database.
+//! Plans are keyed by their normalized statement text, in which literals in comparisons in the WHERE clause are
+//! replaced by parameters, and the search path that their names were resolved with. A plan is taken out of the cache
+//! while a connection executes it, and is returned once the query finishes, so a single plan is never executed by two
+//! connections at the same time. Plans are dropped when the catalog changes, or when the data of a table they scan
+//! changes, as the optimizer relies on the statistics of the tables.
+class PlanCache {
+public:
+	PlanCache();
+
+	static PlanCache &Get(ClientContext &context);
+	static PlanCache &Get(DatabaseInstance &db);
+
+public:
+	//! Replaces the literals in comparisons in the WHERE clause of the statement by parameters, and adds their values
+	//! to "values". Returns false if the statement cannot be cached.
+	static bool Parameterize(SQLStatement &statement, case_insensitive_map_t<Value> &values);
+	//! Casts the values to the types of the parameters of the plan. Returns false if that would change any value, in
+	//! which case the plan would not be equivalent to the original statement.
+	static bool CastParameters(PreparedStatementData &prepared, case_insensitive_map_t<Value> &values);
+	//! The key of a (parameterized) statement in the cache of the given connection
+	static string GetKey(ClientContext &context, SQLStatement &statement);
+	//! Whether or not the connection has temporary objects, which can shadow the tables of a cached plan
+	static bool HasTemporaryObjects(ClientContext &context);
+	//! Whether or not the plan can be shared between connections
+	static bool IsShareable(PreparedStatementData &prepared);
+	//! Whether or not the plan has to be rebound for every set of parameter values, e.g. because the parameters were
+	//! pushed into the filters of a table scan
+	static bool DependsOnParameterValues(PreparedStatementData &prepared);
+	//! Records the data versions of the tables that the (unoptimized) plan scans. This has to happen before the
+	//! optimizer runs, as it can remove a scan altogether, e.g. when the statistics show that a filter is never true.
+	static void RecordDataVersions(LogicalOperator &plan, PreparedStatementData &prepared);
+	//! Whether or not rows were appended to or updated in any of the tables that the plan scans since it was bound.
+	//! The optimizer prunes filters and picks operators based on the statistics of the tables, so such a plan can
+	//! return wrong results even though the catalog did not change.
+	static bool ReadsChangedData(PreparedStatementData &prepared);
+
+	//! Takes an idle plan for the given key out of the cache, returns nullptr if there is none
+	shared_ptr<PreparedStatementData> Take(const string &key);
+	//! Returns a plan to the cache after it has been executed. The plan is dropped if the cache was cleared after
+	//! "plan_generation" was obtained.
+	void Insert(const string &key, shared_ptr<PreparedStatementData> prepared, idx_t capacity,
+	            idx_t plan_generation);
+	//! Marks the key as uncacheable, preventing the statement from being planned twice in the future
+	void SetUncacheable(const string &key, idx_t capacity);
+	bool IsUncacheable(const string &key);
+	//! Removes all plans from the cache
+	void Clear();
+	//! The generation of the cache is incremented every time the cache is cleared
+	idx_t GetGeneration();
+
+	void RecordHit();
+	void RecordMiss();
+	PlanCacheStatistics GetStatistics();
+
+private:
+	struct PlanCacheEntry {
+		//! The idle plans for this key
+		vector<shared_ptr<PreparedStatementData>> plans;
+		//! The last time the entry was used, for the eviction of the least recently used entries
+		idx_t last_used = 0;
+	};
+
+	void EvictEntries(idx_t capacity);
+
+private:
+	mutex lock;
+	unordered_map<string, PlanCacheEntry> entries;
+	unordered_set<string> uncacheable;
+	idx_t plan_count;
+	idx_t current_time;
+	idx_t generation;
+	PlanCacheStatistics statistics;
+};
+
+} // namespace duckdb
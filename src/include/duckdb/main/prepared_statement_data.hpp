@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -46,6 +47,8 @@ public:
 	idx_t catalog_version;
 	//! The map of parameter index to the actual value entry
 	bound_parameter_map_t value_map;
+	//! The data versions of the scanned tables when the statement was bound (only recorded for the plan cache)
+	vector<pair<shared_ptr<DataTableInfo>, idx_t>> data_versions;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
 
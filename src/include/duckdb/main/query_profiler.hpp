@@ -10,6 +10,8 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/hardware_counters.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -17,6 +19,7 @@
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/execution/expression_executor_state.hpp"
+#include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include <stack>
 #include "duckdb/common/pair.hpp"
@@ -27,6 +30,7 @@ class ClientContext;
 class ExpressionExecutor;
 class PhysicalOperator;
 class SQLStatement;
+struct ProducerStatistics;
 
 struct OperatorInformation {
 	explicit OperatorInformation(double time_p = 0, idx_t elements_p = 0) : time(time_p), elements(elements_p) {
@@ -35,6 +39,12 @@ struct OperatorInformation {
 	double time = 0;
 	idx_t elements = 0;
 	string name;
+	//! Operator-specific counters (e.g. hash table collisions or cpu cycles), rendered when non-zero
+	map<string, idx_t> counters;
+
+	void AddCounter(const string &counter_name, idx_t value) {
+		counters[counter_name] += value;
+	}
 };
 
 //! The OperatorProfiler measures timings of individual operators
@@ -42,18 +52,27 @@ class OperatorProfiler {
 	friend class QueryProfiler;
 
 public:
-	DUCKDB_API explicit OperatorProfiler(bool enabled);
+	DUCKDB_API explicit OperatorProfiler(bool enabled, bool hardware_counters_enabled = false);
 
 	DUCKDB_API void StartOperator(optional_ptr<const PhysicalOperator> phys_op);
 	DUCKDB_API void EndOperator(optional_ptr<DataChunk> chunk);
+	//! Marks the start and end of a pipeline task. The hardware counters are only read at the start and the end of a
+	//! task, and the difference is divided among the operators by the time spent in them during the task.
+	DUCKDB_API void StartTask();
+	DUCKDB_API void EndTask();
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor, const string &name,
 	                      int id);
+	//! Adds the given value to an operator-specific counter of the operator
+	DUCKDB_API void AddCounter(const PhysicalOperator &phys_op, const string &name, idx_t value);
 
 	~OperatorProfiler() {
 	}
 
 private:
 	void AddTiming(const PhysicalOperator &op, double time, idx_t elements);
+	void AddHardwareCounters(const PhysicalOperator &op, const HardwareCounterValues &start,
+	                         const HardwareCounterValues &end, double fraction);
+	void AddMemoryCounters(const PhysicalOperator &op, const OperatorMemoryInformation &memory);
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
@@ -63,6 +82,18 @@ private:
 	optional_ptr<const PhysicalOperator> active_operator;
 	//! A mapping of physical operators to recorded timings
 	reference_map_t<const PhysicalOperator, OperatorInformation> timings;
+	//! Whether or not a pipeline task is running
+	bool task_active;
+	//! The cpu performance counters, only set in detailed profiling mode
+	unique_ptr<HardwareCounters> hardware_counters;
+	//! The counter values when the current task was started
+	HardwareCounterValues counters_at_start;
+	//! Whether or not counters_at_start holds valid counter values
+	bool has_counters_at_start;
+	//! The time spent in each operator during the current task
+	reference_map_t<const PhysicalOperator, double> task_timings;
+	//! The buffer pool usage of each operator, gathered while the operator runs within a task
+	reference_map_t<const PhysicalOperator, OperatorMemoryInformation> memory_information;
 };
 
 //! The QueryProfiler can be used to measure timings of queries
@@ -102,6 +133,8 @@ public:
 	DUCKDB_API void EndQuery();
 
 	DUCKDB_API void StartExplainAnalyze();
+	//! Compute the amount of data spilled to the temporary directory (by any query) since the query was started
+	DUCKDB_API void CollectTemporaryData();
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
@@ -110,6 +143,8 @@ public:
 	DUCKDB_API void EndPhase();
 
 	DUCKDB_API void Initialize(const PhysicalOperator &root);
+	//! Sets the scheduling statistics of the tasks of the query
+	void SetSchedulerStatistics(shared_ptr<ProducerStatistics> statistics);
 
 	DUCKDB_API string QueryTreeToString() const;
 	DUCKDB_API void QueryTreeToStream(std::ostream &str) const;
@@ -149,6 +184,14 @@ private:
 	TreeMap tree_map;
 	//! Whether or not we are running as part of a explain_analyze query
 	bool is_explain_analyze;
+	//! The temporary directory usage per memory tag when the query was started
+	vector<MemoryInformation> memory_info_at_start;
+	//! The amount of data written to and read from the temporary directory while the query ran, per memory tag
+	//! These are database-wide numbers: spilling is done by whichever thread needs memory, and the buffer manager does
+	//! not know which query a block belongs to, so this includes data spilled by concurrently running queries
+	vector<MemoryInformation> temporary_data;
+	//! The scheduling statistics of the tasks of the query
+	shared_ptr<ProducerStatistics> scheduler_statistics;
 
 public:
 	const TreeMap &GetTreeMap() const {
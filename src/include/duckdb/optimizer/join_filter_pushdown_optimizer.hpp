@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_filter_pushdown_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/planner/column_binding.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+class LogicalComparisonJoin;
+
+//! The JoinFilterPushdownOptimizer finds hash joins whose keys can be traced back to table scans on the probe side.
+//! For these joins, the min/max and a bloom filter of the build-side keys are pushed into the scans at run-time.
+class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
+public:
+	JoinFilterPushdownOptimizer() {
+	}
+
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	struct PushdownColumn {
+		//! The filter (index into JoinFilterPushdownInfo::join_condition)
+		idx_t filter_idx;
+		//! The column binding of the join key on the probe side
+		ColumnBinding binding;
+	};
+
+	static void GenerateJoinFilters(LogicalComparisonJoin &join);
+	static void GetPushdownFilterTargets(LogicalOperator &op, vector<PushdownColumn> columns,
+	                                     vector<JoinFilterPushdownFilter> &targets);
+};
+
+} // namespace duckdb
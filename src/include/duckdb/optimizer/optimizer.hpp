@@ -30,6 +30,9 @@ public:
 	ClientContext &context;
 	Binder &binder;
 	ExpressionRewriter rewriter;
+	//! Whether or not the plan must remain valid for all values of its parameters. If this is not set, parameters that
+	//! are pushed into a table scan are invalidated, which forces a rebind with their values on execution.
+	bool keep_parameters = false;
 
 private:
 	void RunOptimizer(OptimizerType type, const std::function<void()> &callback);
@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/numa_topology.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class FileSystem;
+
+//! A NUMA node and the CPUs that belong to it
+struct NumaNode {
+	idx_t id;
+	vector<idx_t> cpus;
+};
+
+//! The NUMA nodes of the system
+class NumaTopology {
+public:
+	//! Detects the NUMA nodes of the system. Returns an empty topology if they could not be detected.
+	static NumaTopology Detect(FileSystem &fs);
+	//! Parses a list of CPUs in the format used by Linux (e.g. "0-3,8,10-11")
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+	//! Removes the CPUs that the process is not allowed to run on (see sched_getaffinity)
+	static vector<idx_t> RestrictToAllowedCPUs(vector<idx_t> cpus);
+	//! Pins the calling thread to the CPUs of the given node, returns false if that is not possible
+	static bool PinThread(const NumaNode &node);
+	//! Sets the memory policy of the calling thread so that the pages it faults in are placed on the given node,
+	//! returns false if that is not possible
+	static bool PreferNodeMemory(const NumaNode &node);
+
+	idx_t NodeCount() const {
+		return nodes.size();
+	}
+	//! The amount of CPUs of the smallest node
+	idx_t MinimumCPUsPerNode() const;
+
+	vector<NumaNode> nodes;
+};
+
+} // namespace duckdb
@@ -21,6 +21,10 @@ enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
 enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR, TASK_BLOCKED };
 
+//! The priority class of the tasks of a producer. Producers receive a share of the threads that is proportional to the
+//! weight of their priority class, and tasks of lower priority classes yield to pending tasks of higher classes.
+enum class TaskPriority : uint8_t { LOW, NORMAL, HIGH };
+
 //! Generic parallel task
 class Task : public std::enable_shared_from_this<Task> {
 public:
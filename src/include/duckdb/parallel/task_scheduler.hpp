@@ -13,28 +13,67 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/parallel/numa_topology.hpp"
 
 namespace duckdb {
 
 struct ConcurrentQueue;
 struct QueueProducerToken;
+struct QueuedTask;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
 
+//! Scheduling state and statistics of a producer. These are shared with the query profiler, and with the queued tasks
+//! of the producer, so the scheduler can account for tasks that outlive their producer.
+struct ProducerStatistics {
+	explicit ProducerStatistics(TaskPriority priority, idx_t max_threads)
+	    : priority(priority), max_threads(max_threads), tasks_scheduled(0), tasks_executed(0), tasks_preempted(0),
+	      peak_threads(0), pending_tasks(0), active_threads(0), virtual_time(0) {
+	}
+
+	//! The priority class of the producer
+	TaskPriority priority;
+	//! The maximum amount of threads - including the thread that owns the producer - that can execute tasks of the
+	//! producer concurrently (0 = no limit)
+	idx_t max_threads;
+	//! The amount of tasks that were scheduled (including tasks that were rescheduled after being preempted)
+	atomic<idx_t> tasks_scheduled;
+	//! The amount of tasks that were executed to completion by the background threads
+	atomic<idx_t> tasks_executed;
+	//! The amount of times a task yielded its thread to a task of a higher priority class
+	atomic<idx_t> tasks_preempted;
+	//! The maximum amount of background threads that executed tasks of the producer at the same time
+	atomic<idx_t> peak_threads;
+	//! The amount of tasks of the producer that are waiting in the queue
+	atomic<idx_t> pending_tasks;
+	//! The amount of background threads that are currently executing tasks of the producer
+	atomic<idx_t> active_threads;
+	//! The virtual time of the producer within its priority class (protected by the scheduling lock)
+	idx_t virtual_time;
+};
+
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token,
+	              shared_ptr<ProducerStatistics> statistics, idx_t numa_node);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The scheduling state and statistics of this producer
+	shared_ptr<ProducerStatistics> statistics;
+	//! The NUMA node whose threads preferably execute the tasks of this producer
+	const idx_t numa_node;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
@@ -45,13 +84,14 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	unique_ptr<ProducerToken> CreateProducer(TaskPriority priority = TaskPriority::NORMAL, idx_t max_threads = 0);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
-	void ExecuteForever(atomic<bool> *marker);
+	//! If "numa_node" is set, tasks of producers that belong to that NUMA node are preferred
+	void ExecuteForever(atomic<bool> *marker, optional_idx numa_node = optional_idx());
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -67,6 +107,10 @@ public:
 
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
+	//! Returns the NUMA node the calling thread is pinned to, if it is a pinned background thread
+	static optional_idx GetThreadNumaNode();
+	//! Returns the number of NUMA nodes the pinned threads are spread over (at least one)
+	idx_t NumaNodeCount() const;
 
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
@@ -80,7 +124,39 @@ public:
 private:
 	void RelaunchThreadsInternal(int32_t n);
 
+	//! Registers or unregisters a producer
+	void RegisterProducer(ProducerToken &producer);
+	void UnregisterProducer(ProducerToken &producer);
+	//! The index of the queue that holds the tasks of producers without a thread limit of the given node and class
+	idx_t GetQueueIndex(idx_t numa_node, TaskPriority priority) const;
+	//! The index of the queue that holds the tasks of producers with a thread limit
+	idx_t GetLimitedQueueIndex() const;
+	//! Selects the priority class the next task is taken from according to the weighted fair scheduling policy
+	optional_idx SelectPriorityClass();
+	//! Fetches the next task to execute on a background thread
+	bool DequeueTask(QueuedTask &task, optional_idx numa_node = optional_idx());
+	//! Fetches a task of the producer of the given class with the lowest virtual time that has not reached its thread
+	//! limit. This takes the scheduling lock, so it is only used if the lock-free queues cannot be fair.
+	bool DequeueProducerTask(QueuedTask &task, TaskPriority priority, optional_idx numa_node);
+	//! Whether or not the background threads should be pinned to NUMA nodes
+	bool ShouldPinThreads(idx_t thread_count);
+	//! Executes a task on a background thread, returns true if the task was completed
+	bool ExecuteTask(QueuedTask &task, optional_idx numa_node = optional_idx());
+	//! Puts a task that yielded its thread back into the queue
+	void RescheduleTask(QueuedTask task, optional_idx numa_node);
+	//! Whether or not there are tasks waiting in the queue with a priority higher than the given priority
+	bool HasHigherPriorityTasks(TaskPriority priority);
+	void TaskEnqueued(ProducerStatistics &producer);
+	void TaskDequeued(ProducerStatistics &producer);
+	void TaskStarted(ProducerStatistics &producer);
+
+	static idx_t GetPriorityWeight(TaskPriority priority);
+
 private:
+	static constexpr const idx_t PRIORITY_COUNT = 3;
+	//! The virtual time a priority class of weight 1 is charged for a task
+	static constexpr const idx_t VIRTUAL_TIME_PER_TASK = 16;
+
 	DatabaseInstance &db;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
@@ -96,6 +172,31 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! Lock for the producers and for the virtual times of the priority classes and the producers
+	mutex scheduling_lock;
+	//! The registered producers. The tasks of producers with a thread limit are kept in a separate queue, as the
+	//! lock-free queues cannot skip the tasks of a producer that reached its limit.
+	vector<reference<ProducerToken>> producers;
+	//! The virtual time of the priority class that was most recently selected
+	idx_t virtual_time;
+	//! The virtual time of each priority class
+	idx_t class_virtual_time[PRIORITY_COUNT];
+	//! The virtual time of the producer that was most recently selected, per priority class
+	idx_t producer_virtual_time[PRIORITY_COUNT];
+	//! The amount of tasks waiting in the queue per priority class
+	atomic<idx_t> pending_tasks[PRIORITY_COUNT];
+	//! The amount of producers with tasks waiting in the queue per priority class
+	atomic<idx_t> waiting_producers[PRIORITY_COUNT];
+	//! The amount of tasks of producers with a thread limit waiting in the queue
+	atomic<idx_t> limited_pending_tasks;
+	//! The NUMA nodes of the system
+	unique_ptr<NumaTopology> numa_topology;
+	//! The amount of NUMA nodes the queues are partitioned by (at least one)
+	idx_t numa_node_count;
+	//! Whether or not the current background threads are pinned to NUMA nodes
+	atomic<bool> threads_pinned;
+	//! The NUMA node that is assigned to the next producer
+	atomic<idx_t> next_numa_node;
 };
 
 } // namespace duckdb
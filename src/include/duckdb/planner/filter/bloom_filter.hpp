@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class SelectionVector;
+class Vector;
+
+//! BloomFilter is a (register-blocked) bloom filter over the hashes of a set of values. Every hash selects a single
+//! 64-bit block in which it sets or checks a few bits, so a lookup costs at most one cache miss.
+//! The filter can produce false positives, but never false negatives: it only ever removes rows that cannot match.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! Bounds on the number of 64-bit blocks of the filter (512 bytes to 1 MB)
+	static constexpr const idx_t MINIMUM_BLOCK_COUNT = 64;
+	static constexpr const idx_t MAXIMUM_BLOCK_COUNT = 131072;
+	//! Target number of bits per inserted value
+	static constexpr const idx_t BITS_PER_VALUE = 16;
+	//! Inserting more values than this fraction of bits makes the filter too inaccurate to be worth probing
+	static constexpr const idx_t MINIMUM_BITS_PER_VALUE = 8;
+	//! After this many probed rows we check whether the filter actually removes anything
+	static constexpr const idx_t ADAPTIVE_SAMPLE_COUNT = 65536;
+
+public:
+	explicit BloomFilter(vector<uint64_t> blocks);
+
+	//! The blocks of the filter, the number of blocks is always a power of two
+	vector<uint64_t> blocks;
+
+public:
+	//! Creates an empty bloom filter, sized for the expected number of values
+	static unique_ptr<BloomFilter> Create(idx_t expected_cardinality);
+
+	//! Inserts the (non-NULL) values of the vector into the filter
+	void Insert(Vector &input, idx_t count);
+	//! Merges another bloom filter of the same size into this one
+	void Merge(const BloomFilter &other);
+	//! Whether or not the filter is still accurate enough when "count" values have been inserted into it
+	bool IsSelective(idx_t count) const;
+
+	//! Filters the values in "input" that are referenced by "sel", removing the ones that are not in the filter
+	idx_t Filter(Vector &input, SelectionVector &sel, idx_t &approved_tuple_count, idx_t scan_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	static inline uint64_t BlockMask(hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63));
+	}
+	inline idx_t BlockIndex(hash_t hash) const {
+		return (hash >> 18) & (blocks.size() - 1);
+	}
+	inline bool Lookup(hash_t hash) const {
+		auto mask = BlockMask(hash);
+		return (blocks[BlockIndex(hash)] & mask) == mask;
+	}
+
+private:
+	//! Run-time statistics: if (nearly) all probed rows pass, probing the filter is a waste of time
+	mutable atomic<idx_t> probe_count;
+	mutable atomic<idx_t> pass_count;
+};
+
+} // namespace duckdb
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class SelectionVector;
+struct UnifiedVectorFormat;
+
+//! InFilter only keeps the rows whose value is equal to one of a set of constants (e.g. col IN (1, 5, 10))
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (non-NULL) values to filter on, sorted and without duplicates
+	vector<Value> values;
+
+public:
+	//! Whether or not an IN filter can be created for a column of the given type
+	static bool SupportsType(const LogicalType &type);
+
+	//! Filters the values in "vdata" that are referenced by "sel", removing the ones that are not in the set
+	idx_t Filter(UnifiedVectorFormat &vdata, const LogicalType &type, SelectionVector &sel,
+	             idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -65,6 +65,19 @@ public:
 	//! Returns the number of free blocks
 	virtual idx_t FreeBlocks() = 0;
 
+	//! Returns the version number of the storage format of the underlying database file, which is also the format
+	//! that is written to it
+	virtual uint64_t GetVersionNumber() {
+		return VERSION_NUMBER;
+	}
+	//! Returns the total number of bytes written to storage by this block manager
+	virtual idx_t GetBytesWritten() {
+		return 0;
+	}
+	//! Limit the rate at which blocks are written to the given number of bytes per second (0 for no limit)
+	virtual void SetWriteRateLimit(idx_t bytes_per_second) {
+	}
+
 	//! Truncate the underlying database file after a checkpoint
 	virtual void Truncate();
 
@@ -11,6 +11,7 @@
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer/temporary_file_information.hpp"
 
 namespace duckdb {
 
@@ -50,6 +51,12 @@ public:
 
 	void IncreaseUsedMemory(MemoryTag tag, idx_t size);
 
+	//! Sets the operator information that the reservations and temporary directory traffic of the calling thread are
+	//! added to (used by the profiler), or clears it if information is nullptr
+	static void SetOperatorMemoryInformation(optional_ptr<OperatorMemoryInformation> information);
+	//! Returns the operator information of the calling thread, if any
+	static optional_ptr<OperatorMemoryInformation> GetOperatorMemoryInformation();
+
 	idx_t GetUsedMemory() const;
 
 	idx_t GetMaxMemory() const;
@@ -9,11 +9,49 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! Total amount of data that was ever written to the temporary directory
+	idx_t spilled_data;
+	//! Total amount of data that was ever read back from the temporary directory
+	idx_t read_back_data;
+};
+
+//! The buffer pool usage and temporary directory traffic of a single operator, gathered by the profiler
+struct OperatorMemoryInformation {
+	//! The total size of the buffer pool reservations made per memory tag
+	idx_t allocated[MEMORY_TAG_COUNT] = {};
+	//! The size of the reservations that have not been released yet per memory tag
+	int64_t outstanding[MEMORY_TAG_COUNT] = {};
+	//! The maximum of the outstanding reservations per memory tag
+	idx_t peak[MEMORY_TAG_COUNT] = {};
+	//! The amount of data written to the temporary directory to make room for the reservations of the operator
+	idx_t spilled_data = 0;
+	//! The amount of data read back from the temporary directory
+	idx_t read_back_data = 0;
+	//! Whether or not the blocks of (possibly other) operators are being evicted: their memory is not released
+	//! by this operator
+	bool evicting = false;
+
+	void AddMemory(MemoryTag tag, int64_t delta) {
+		if (evicting) {
+			return;
+		}
+		auto tag_idx = uint8_t(tag);
+		if (delta > 0) {
+			allocated[tag_idx] += idx_t(delta);
+		}
+		outstanding[tag_idx] += delta;
+		if (outstanding[tag_idx] > 0 && idx_t(outstanding[tag_idx]) > peak[tag_idx]) {
+			peak[tag_idx] = idx_t(outstanding[tag_idx]);
+		}
+	}
 };
 
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size of the buffers stored in the file before and after compression
+	idx_t uncompressed_size;
+	idx_t compressed_size;
 };
 
 } // namespace duckdb
@@ -30,6 +30,8 @@ public:
 	void WriteTableData(Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	//! Whether transactions can read the database while this checkpoint runs
+	virtual bool IsConcurrentCheckpoint();
 
 	virtual void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) = 0;
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) = 0;
@@ -52,6 +54,7 @@ public:
 public:
 	void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) override;
 	unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) override;
+	bool IsConcurrentCheckpoint() override;
 
 private:
 	SingleFileCheckpointWriter &checkpoint_manager;
@@ -96,10 +96,10 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileTableDataWriter;
 
 public:
-	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager);
+	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, bool concurrent = false);
 
-	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
-	//! connection is available because right now the checkpointing cannot be done online. (TODO)
+	//! Checkpoint the current state of the WAL and flush it to the main storage. Unless the checkpoint is
+	//! concurrent, no other transactions can be active while it runs
 	void CreateCheckpoint();
 
 	MetadataWriter &GetMetadataWriter() override;
@@ -116,6 +116,9 @@ private:
 	//! Because this is single-file storage, we can share partial blocks across
 	//! an entire checkpoint.
 	PartialBlockManager partial_block_manager;
+	//! Whether transactions can read the database, and commit appends to the tables that have been written, while the
+	//! checkpoint runs
+	bool concurrent;
 };
 
 } // namespace duckdb
@@ -22,6 +22,15 @@ struct DatabaseSize {
 	idx_t wal_size = 0;
 };
 
+struct CheckpointStatistics {
+	//! The number of checkpoints performed since the database was opened
+	idx_t checkpoint_count = 0;
+	//! The number of bytes written to the database file by the most recent checkpoint
+	idx_t last_bytes_written = 0;
+	//! The number of bytes written to the database file by all checkpoints
+	idx_t total_bytes_written = 0;
+};
+
 struct MetadataBlockInfo {
 	block_id_t block_id;
 	idx_t total_blocks;
@@ -127,7 +127,8 @@ public:
 		return (index_constraint_type == IndexConstraintType::FOREIGN);
 	}
 
-	//! Returns all index storage information for serialization
+	//! Returns all index storage information for serialization. The lock obtained from InitializeLock must be held
+	//! until the storage information has been serialized, as its buffers point into the index
 	virtual IndexStorageInfo GetStorageInfo(const bool get_buffers);
 
 	//! Execute the index expressions on an input chunk
@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/block_manager.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 
@@ -76,10 +77,13 @@ public:
 protected:
 	BlockManager &block_manager;
 	BufferManager &buffer_manager;
+	//! Protects the blocks: readers can load metadata while a background checkpoint writes new metadata
+	mutable mutex block_lock;
 	unordered_map<block_id_t, MetadataBlock> blocks;
 	unordered_map<block_id_t, idx_t> modified_blocks;
 
 protected:
+	MetadataHandle Pin(shared_ptr<BlockHandle> block, MetadataPointer pointer);
 	block_id_t AllocateNewBlock();
 	block_id_t GetNextBlockId();
 
@@ -12,6 +12,7 @@
 
 namespace duckdb {
 class PartialBlockManager;
+class StorageLockKey;
 
 class OptimisticDataWriter {
 public:
@@ -31,6 +32,10 @@ public:
 	void Merge(OptimisticDataWriter &other);
 	//! Rollback
 	void Rollback();
+	//! Whether the writer holds the write lock of the transaction manager
+	bool HoldsWriteLock() const {
+		return write_lock != nullptr;
+	}
 
 private:
 	//! Prepare a write to disk
@@ -41,6 +46,9 @@ private:
 	DataTable &table;
 	//! The partial block manager (if we created one yet)
 	unique_ptr<PartialBlockManager> partial_manager;
+	//! The write lock of the transaction manager, held in shared mode while blocks written by this writer can still
+	//! be freed or flushed, so that a background checkpoint cannot run in the meantime
+	unique_ptr<StorageLockKey> write_lock;
 };
 
 } // namespace duckdb
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -68,6 +70,12 @@ public:
 	idx_t TotalBlocks() override;
 	//! Returns the number of free blocks
 	idx_t FreeBlocks() override;
+	//! Returns the version number of the database file
+	uint64_t GetVersionNumber() override;
+	//! Returns the total number of bytes written to the database file
+	idx_t GetBytesWritten() override;
+	//! Limit the rate at which blocks are written to the given number of bytes per second (0 for no limit)
+	void SetWriteRateLimit(idx_t bytes_per_second) override;
 
 private:
 	//! Load the free list from the file
@@ -77,6 +85,8 @@ private:
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
+	//! Wait until writing the given number of bytes no longer exceeds the write rate limit
+	void ThrottleWrite(idx_t bytes);
 
 	//! Return the blocks to which we will write the free list and modified blocks
 	vector<MetadataHandle> GetFreeListBlocks();
@@ -90,6 +100,8 @@ private:
 	string path;
 	//! The file handle
 	unique_ptr<FileHandle> handle;
+	//! The version number of the database file
+	uint64_t version_number;
 	//! The buffer used to read/write to the headers
 	FileBuffer header_buffer;
 	//! The list of free blocks that can be written to currently
@@ -108,6 +120,16 @@ private:
 	block_id_t max_block;
 	//! The block id where the free list can be found
 	idx_t free_list_id;
+	//! The total number of bytes written to the database file
+	atomic<idx_t> bytes_written;
+	//! The maximum number of bytes written per second (0 for no limit)
+	atomic<idx_t> write_rate_limit;
+	//! The time at which the write rate limit was set
+	time_point<steady_clock> throttle_start;
+	//! The number of bytes written since the write rate limit was set
+	idx_t throttled_bytes;
+	//! Lock for the write throttle
+	mutex throttle_lock;
 	//! The current header iteration count
 	uint64_t iteration_count;
 	//! The storage manager options
@@ -155,6 +155,10 @@ protected:
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
 	atomic<idx_t> evicted_data_per_tag[MEMORY_TAG_COUNT];
+	//! Total amount of data written to the temporary directory per tag
+	atomic<idx_t> spilled_data_per_tag[MEMORY_TAG_COUNT];
+	//! Total amount of data read back from the temporary directory per tag
+	atomic<idx_t> read_back_data_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
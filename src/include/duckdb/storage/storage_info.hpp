@@ -46,8 +46,11 @@ struct Storage {
 	constexpr static const idx_t ROW_GROUP_VECTOR_COUNT = ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE;
 };
 
-//! The version number of the database storage format
+//! The version number of the database storage format, which new database files are created with
 extern const uint64_t VERSION_NUMBER;
+//! The oldest version number of the database storage format that can still be read. Database files of an older
+//! version than VERSION_NUMBER keep their storage format, so that the DuckDB versions that created them can read them
+extern const uint64_t VERSION_NUMBER_LOWER;
 const char *GetDuckDBVersion(idx_t version_number);
 
 //! The MainHeader is the first header in the storage file. The MainHeader is typically written only once for a database
@@ -12,6 +12,8 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class StorageLock;
 
@@ -37,12 +39,26 @@ public:
 	unique_ptr<StorageLockKey> GetExclusiveLock();
 	//! Get a shared lock
 	unique_ptr<StorageLockKey> GetSharedLock();
+	//! Try to get an exclusive lock without waiting, returns nullptr if the lock is held by anyone else
+	unique_ptr<StorageLockKey> TryGetExclusiveLock();
+	//! Try to get a shared lock without waiting, returns nullptr if the lock is held (or awaited) exclusively
+	unique_ptr<StorageLockKey> TryGetSharedLock();
+	//! Get another shared lock while already holding one. Unlike GetSharedLock, this does not wait behind a thread
+	//! that is waiting for the exclusive lock (which would wait for the shared lock that is already held)
+	unique_ptr<StorageLockKey> AddSharedLock();
 
 private:
 	mutex exclusive_lock;
 	atomic<idx_t> read_count;
+	//! Whether a thread holding the exclusive_lock is waiting for the shared locks to be released
+	atomic<bool> exclusive_waiting;
+	//! Lock and condition variable used to wake up the waiting thread when the last shared lock is released
+	mutex wait_lock;
+	std::condition_variable readers_finished;
 
 private:
+	//! Wait until all shared locks have been released (while holding the exclusive_lock)
+	void WaitForReaders();
 	//! Release an exclusive lock
 	void ReleaseExclusiveLock();
 	//! Release a shared lock
@@ -30,8 +30,8 @@ public:
 	virtual ~StorageCommitState() {
 	}
 
-	// Make the commit persistent
-	virtual void FlushCommit() = 0;
+	// Make the commit persistent. Returns the WAL position that has to be synced before the commit is durable (or 0)
+	virtual idx_t FlushCommit() = 0;
 };
 
 //! StorageManager is responsible for managing the physical storage of the
@@ -55,6 +55,11 @@ public:
 
 	//! Get the WAL of the StorageManager, returns nullptr if in-memory
 	optional_ptr<WriteAheadLog> GetWriteAheadLog();
+	//! Get a reference to the WAL that remains valid after a checkpoint deletes the WAL, returns nullptr if in-memory
+	shared_ptr<WriteAheadLog> GetSharedWriteAheadLog();
+	//! Get the WAL whose contents a checkpoint writes to the database file. While a background checkpoint runs, this
+	//! is the WAL of the commits before the checkpoint started, and new commits are written to a separate WAL
+	optional_ptr<WriteAheadLog> GetWriteAheadLogToCheckpoint();
 
 	//! Returns the database file path
 	string GetDBPath() {
@@ -62,15 +67,24 @@ public:
 	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
+	//! The path to the WAL of the commits made while a background checkpoint runs
+	string GetCheckpointWALPath();
 	bool InMemory();
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
 	virtual unique_ptr<StorageCommitState> GenStorageCommitState(Transaction &transaction, bool checkpoint) = 0;
 	virtual bool IsCheckpointClean(MetaBlockPointer checkpoint_id) = 0;
-	virtual void CreateCheckpoint(bool delete_wal = false, bool force_checkpoint = false) = 0;
+	virtual void CreateCheckpoint(bool delete_wal = false, bool force_checkpoint = false,
+	                              bool concurrent = false) = 0;
+	//! Let commits write to a separate WAL while a background checkpoint writes the current WAL to the database file
+	void BeginConcurrentCheckpoint();
+	//! Delete the WAL written by a background checkpoint, and let the WAL of the commits made in the meantime take
+	//! its place
+	void FinishConcurrentCheckpoint();
 	virtual DatabaseSize GetDatabaseSize() = 0;
 	virtual vector<MetadataBlockInfo> GetMetadataInfo() = 0;
 	virtual shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) = 0;
+	virtual CheckpointStatistics GetCheckpointStatistics() = 0;
 
 protected:
 	virtual void LoadDatabase(optional_ptr<ClientContext> context = nullptr) = 0;
@@ -81,7 +95,9 @@ protected:
 	//! The path of the database
 	string path;
 	//! The WriteAheadLog of the storage manager
-	unique_ptr<WriteAheadLog> wal;
+	shared_ptr<WriteAheadLog> wal;
+	//! The WAL that a running background checkpoint writes to the database file (if any)
+	shared_ptr<WriteAheadLog> checkpointed_wal;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
@@ -115,12 +131,19 @@ public:
 	bool AutomaticCheckpoint(idx_t estimated_wal_bytes) override;
 	unique_ptr<StorageCommitState> GenStorageCommitState(Transaction &transaction, bool checkpoint) override;
 	bool IsCheckpointClean(MetaBlockPointer checkpoint_id) override;
-	void CreateCheckpoint(bool delete_wal, bool force_checkpoint) override;
+	void CreateCheckpoint(bool delete_wal, bool force_checkpoint, bool concurrent) override;
 	DatabaseSize GetDatabaseSize() override;
 	vector<MetadataBlockInfo> GetMetadataInfo() override;
 	shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) override;
+	CheckpointStatistics GetCheckpointStatistics() override;
 
 protected:
 	void LoadDatabase(optional_ptr<ClientContext> context = nullptr) override;
+
+private:
+	//! Lock protecting the checkpoint statistics
+	mutex stats_lock;
+	//! Statistics about the checkpoints performed on this database
+	CheckpointStatistics checkpoint_stats;
 };
 } // namespace duckdb
@@ -158,6 +158,14 @@ protected:
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
+	//! Scans a vector and applies the filter to it directly in the segment, if the segment supports this
+	//! Returns false (without scanning anything) if the vector cannot be filtered directly
+	bool TryFilterVector(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                     idx_t &approved_tuple_count, const TableFilter &filter);
+
+private:
+	//! Prepares the scan state for scanning the vector at state.row_index
+	void BeginScanVectorInternal(ColumnScanState &state);
 
 protected:
 	//! The segments holding the data of this column segment
@@ -26,6 +26,8 @@ public:
 	ColumnData &GetColumnData();
 	RowGroup &GetRowGroup();
 	ColumnCheckpointState &GetCheckpointState();
+	//! The first row of the segments that are currently being rewritten
+	idx_t GetRowStart() const;
 
 	void Checkpoint(vector<SegmentNode<ColumnSegment>> nodes);
 	CompressionFunction &GetCompressionFunction(CompressionType type);
@@ -35,6 +37,7 @@ private:
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
+	bool HasChanges(ColumnSegment &segment);
 	void WritePersistentSegments();
 
 private:
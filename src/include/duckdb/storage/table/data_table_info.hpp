@@ -10,6 +10,7 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/storage/table/table_index_list.hpp"
 
 namespace duckdb {
@@ -29,6 +30,9 @@ struct DataTableInfo {
 	//! The amount of elements in the table. Note that this number signifies the amount of COMMITTED entries in the
 	//! table. It can be inaccurate inside of transactions. More work is needed to properly support that.
 	atomic<idx_t> cardinality;
+	//! Incremented whenever rows are appended to or updated in the table, i.e. whenever its statistics can change.
+	//! Cached plans that were optimized using the statistics of the table are stale once this changes.
+	atomic<idx_t> data_version;
 	//! The schema of the table
 	string schema;
 	//! The name of the table
@@ -37,6 +41,11 @@ struct DataTableInfo {
 	TableIndexList indexes;
 	//! Index storage information of the indexes created by this table
 	vector<IndexStorageInfo> index_storage_infos;
+	//! Held exclusively while a background checkpoint writes the table, and shared by the scans of the table
+	StorageLock checkpoint_lock;
+	//! The number of the last background checkpoint that has written the table. Protected by the transaction lock of
+	//! the transaction manager
+	idx_t checkpoint_number = 0;
 
 	bool IsTemporary() const;
 };
@@ -127,6 +127,8 @@ public:
 	idx_t max_row;
 	//! The current batch index
 	idx_t batch_index;
+	//! The number of rows skipped because the zonemaps showed that they cannot pass the table filters
+	idx_t zonemap_pruned_rows;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -145,6 +147,8 @@ private:
 struct TableScanOptions {
 	//! Test config that forces fetching rows one by one instead of regular scans
 	bool force_fetch_row = false;
+	//! Whether threads pinned to a NUMA node may scan the row groups of their node out of order
+	bool prefer_local_row_groups = false;
 };
 
 class TableScanState {
@@ -157,6 +161,8 @@ public:
 	CollectionScanState local_state;
 	//! Options for scanning
 	TableScanOptions options;
+	//! Keeps a background checkpoint from rewriting the table while it is scanned
+	shared_ptr<StorageLockKey> checkpoint_lock;
 
 public:
 	void Initialize(vector<storage_t> column_ids, TableFilterSet *table_filters = nullptr);
@@ -184,6 +190,8 @@ struct ParallelCollectionScanState {
 	idx_t max_row;
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
+	//! The next row group per NUMA node, if the row groups are striped over the nodes (see NextParallelScan)
+	vector<RowGroup *> node_row_groups;
 	mutex lock;
 };
 
@@ -192,6 +200,8 @@ struct ParallelTableScanState {
 	ParallelCollectionScanState scan_state;
 	//! Parallel scan state for the transaction-local state
 	ParallelCollectionScanState local_state;
+	//! Keeps a background checkpoint from rewriting the table while it is scanned
+	shared_ptr<StorageLockKey> checkpoint_lock;
 };
 
 class CreateIndexScanState : public TableScanState {
@@ -11,6 +11,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -46,15 +47,46 @@ private:
 };
 
 //===--------------------------------------------------------------------===//
-// TemporaryFileIndex
+// TemporaryBufferSize
 //===--------------------------------------------------------------------===//
 
+//! The size of the slots in a temporary file. Uncompressed buffers are written to DEFAULT slots, compressed buffers
+//! are written to the smallest slot size they fit in
+enum class TemporaryBufferSize : idx_t {
+	INVALID = 0,
+	S32K = 32768,
+	S64K = 65536,
+	S96K = 98304,
+	S128K = 131072,
+	S160K = 163840,
+	S192K = 196608,
+	S224K = 229376,
+	DEFAULT = Storage::BLOCK_ALLOC_SIZE
+};
+
+//===--------------------------------------------------------------------===//
+// TemporaryFileIdentifier/TemporaryFileIndex
+//===--------------------------------------------------------------------===//
+
+struct TemporaryFileIdentifier {
+	explicit TemporaryFileIdentifier(TemporaryBufferSize size = TemporaryBufferSize::INVALID,
+	                                 idx_t file_index = DConstants::INVALID_INDEX);
+
+	//! The slot size of the file
+	TemporaryBufferSize size;
+	//! The index of the file among the files with the same slot size
+	idx_t file_index;
+
+public:
+	bool IsValid() const;
+};
+
 // FIXME: should be optional_idx
 struct TemporaryFileIndex {
-	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
+	explicit TemporaryFileIndex(TemporaryFileIdentifier identifier = TemporaryFileIdentifier(),
 	                            idx_t block_index = DConstants::INVALID_INDEX);
 
-	idx_t file_index;
+	TemporaryFileIdentifier identifier;
 	idx_t block_index;
 
 public:
@@ -69,7 +101,8 @@ class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
-	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index);
+	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
+	                    TemporaryFileIdentifier identifier);
 
 public:
 	struct TemporaryFileLock {
@@ -81,8 +114,11 @@ public:
 	};
 
 public:
-	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Reserves a slot that written_size bytes will be written to
+	TemporaryFileIndex TryGetBlockIndex(idx_t written_size);
+	//! Writes the buffer to the given slot - if the slot is smaller than a block, the compressed buffer is written
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer,
+	                        idx_t compressed_size);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
@@ -97,10 +133,14 @@ private:
 	const idx_t max_allowed_index;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
-	idx_t file_index;
+	TemporaryFileIdentifier identifier;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+	//! The amount of bytes actually written to each slot that is in use (protected by file_lock)
+	unordered_map<idx_t, idx_t> written_sizes;
+	//! The total amount of bytes written to the slots that are in use (protected by file_lock)
+	idx_t compressed_size = 0;
 };
 
 class TemporaryFileManager;
@@ -128,6 +168,10 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+	//! The zstd compression level used when temp_file_compression is enabled - a negative (fast) level, as spilling
+	//! should not become CPU bound
+	constexpr static int COMPRESSION_LEVEL = -3;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 
@@ -147,23 +191,25 @@ public:
 	vector<TemporaryFileInformation> GetTemporaryFiles();
 
 private:
+	//! Compresses the buffer if temp_file_compression is enabled - returns the size of the slot to write it to
+	TemporaryBufferSize CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer, idx_t &compressed_size);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
-	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
+	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, TemporaryFileIdentifier identifier);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
-	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	void EraseFileHandle(TemporaryManagerLock &, TemporaryFileIdentifier identifier);
 
 private:
 	DatabaseInstance &db;
 	mutex manager_lock;
 	//! The temporary directory
 	string temp_directory;
-	//! The set of active temporary file handles
-	unordered_map<idx_t, unique_ptr<TemporaryFileHandle>> files;
+	//! The set of active temporary file handles, per slot size
+	map<TemporaryBufferSize, unordered_map<idx_t, unique_ptr<TemporaryFileHandle>>> files;
 	//! map of block_id -> temporary file position
 	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
-	//! Manager of in-use temporary file indexes
-	BlockIndexManager index_manager;
+	//! Managers of in-use temporary file indexes, per slot size
+	map<TemporaryBufferSize, BlockIndexManager> index_managers;
 };
 
 } // namespace duckdb
@@ -13,13 +13,17 @@
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -51,8 +55,11 @@ public:
 	bool skip_writing;
 
 public:
-	//! Replay the WAL
-	static bool Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle);
+	//! Replay the WAL. Returns true if the contents of the WAL have already been checkpointed. Sets complete_size to
+	//! the size of the WAL up to the end of its last complete transaction
+	static bool Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle, idx_t &complete_size);
+	//! The size of the version marker at the start of a WAL
+	static idx_t VersionMarkerSize();
 
 	//! Returns the current size of the WAL in bytes
 	int64_t GetWALSize();
@@ -110,14 +117,39 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Move the WAL file on disk to the given path, and keep appending to it there
+	void Move(const string &new_path);
+	//! Flush all changes made to the WAL to disk and sync the file
 	void Flush();
+	//! Write the end of a committing transaction to the WAL, and flush it according to the "synchronous" setting.
+	//! Returns the position up to which the WAL must be synced before the commit is durable, or 0 if no sync is needed
+	idx_t FlushCommit();
+	//! Sync the WAL up to (at least) the given position. This does not require the transaction lock: transactions
+	//! that commit while a sync is running are covered together by the next one (group commit). Commits in a WAL that
+	//! was deleted by a checkpoint are durable in the database file, and are not synced
+	void SyncCommit(idx_t position);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
+protected:
+	//! Wait until no committing thread is syncing, or waiting to sync, the WAL
+	void WaitForPendingSyncs(unique_lock<mutex> &guard);
+
 protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+	//! Lock protecting the sync state below
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! Whether a committing thread is currently syncing the WAL
+	bool sync_in_progress;
+	//! The number of committing threads in SyncCommit
+	idx_t pending_syncs;
+	//! The position up to which the commits in the WAL have been written to the file
+	atomic<idx_t> flushed_position;
+	//! The position up to which the WAL is known to be synced to disk
+	idx_t synced_position;
 };
 
 } // namespace duckdb
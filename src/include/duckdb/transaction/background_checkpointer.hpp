@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/transaction/background_checkpointer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+class DuckTransactionManager;
+
+//! The BackgroundCheckpointer runs the automatic checkpoints of a database on a dedicated thread, so that the
+//! transaction that pushes the WAL over the checkpoint threshold does not have to wait for the checkpoint. Other
+//! transactions can start and read the database while the checkpoint runs; transactions that modify the database
+//! wait for it to finish. A checkpoint that has been postponed by writers for longer than
+//! background_checkpoint_timeout stops new writers until the current ones have finished
+class BackgroundCheckpointer {
+public:
+	explicit BackgroundCheckpointer(DuckTransactionManager &manager);
+	~BackgroundCheckpointer();
+
+public:
+	//! Request a checkpoint; it is performed once no transactions are modifying the database
+	void RequestCheckpoint();
+	//! Signal that a transaction has finished, which might allow a postponed checkpoint to run
+	void TransactionFinished();
+	//! Stop the background thread, waiting for a running checkpoint to finish
+	void Stop();
+
+private:
+	void Run();
+
+private:
+	DuckTransactionManager &manager;
+	//! Lock protecting the state below
+	mutex lock;
+	std::condition_variable cv;
+	//! Whether a checkpoint was requested that has not been performed yet
+	bool checkpoint_requested;
+	//! The time at which the pending checkpoint was requested
+	time_point<steady_clock> requested_at;
+	//! Whether a transaction finished since the last checkpoint attempt
+	bool transaction_finished;
+	//! Whether the background thread should stop
+	bool shutdown;
+	//! The time at which the last background checkpoint finished
+	time_point<steady_clock> last_checkpoint;
+	//! The background thread
+	unique_ptr<thread> checkpoint_thread;
+};
+
+} // namespace duckdb
@@ -9,9 +9,12 @@
 #pragma once
 
 #include "duckdb/transaction/transaction.hpp"
+#include "duckdb/common/reference_map.hpp"
 
 namespace duckdb {
 class RowVersionManager;
+class StorageLockKey;
+struct DataTableInfo;
 
 class DuckTransaction : public Transaction {
 public:
@@ -29,6 +32,8 @@ public:
 	unordered_map<SequenceCatalogEntry *, SequenceValue> sequence_usage;
 	//! Highest active query when the transaction finished, used for cleaning up
 	transaction_t highest_active_query;
+	//! The position up to which the WAL has to be synced before the commit of this transaction is durable (if any)
+	idx_t wal_sync_position;
 
 public:
 	static DuckTransaction &Get(ClientContext &context, AttachedDatabase &db);
@@ -49,6 +54,8 @@ public:
 	void Cleanup();
 
 	bool ChangesMade();
+	//! Whether the transaction changed the database in place, rather than only appending to transaction-local storage
+	bool ChangesMadeInPlace();
 
 	void PushDelete(DataTable &table, RowVersionManager &info, idx_t vector_idx, row_t rows[], idx_t count,
 	                idx_t base_row);
@@ -59,12 +66,28 @@ public:
 		return true;
 	}
 
+	//! Obtains the write lock of the transaction manager in shared mode, blocking a background checkpoint until this
+	//! transaction has finished
+	void SetReadWrite() override;
+	//! Obtains the checkpoint lock of a table in shared mode. Scans of the same table within this transaction share
+	//! the lock, so that they cannot get stuck behind a checkpoint that is waiting for one of them
+	shared_ptr<StorageLockKey> SharedLockTable(DataTableInfo &info);
+
+	//! The shared write lock held by a transaction that modifies the database in place
+	unique_ptr<StorageLockKey> write_lock;
+	//! Whether the transaction has obtained the write lock, i.e. whether it did more than appending rows. A background
+	//! checkpoint can run while transactions that only appended still need their row versions
+	bool modified_in_place = false;
+
 private:
 	//! The undo buffer is used to store old versions of rows that are updated
 	//! or deleted
 	UndoBuffer undo_buffer;
 	//! The set of uncommitted appends for the transaction
 	unique_ptr<LocalStorage> storage;
+	//! The table checkpoint locks held by the scans of this transaction
+	mutex active_locks_lock;
+	reference_map_t<DataTableInfo, weak_ptr<StorageLockKey>> active_locks;
 };
 
 } // namespace duckdb
@@ -9,14 +9,21 @@
 #pragma once
 
 #include "duckdb/transaction/transaction_manager.hpp"
+#include "duckdb/storage/storage_lock.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
+class BackgroundCheckpointer;
 class DuckTransaction;
+struct DataTableInfo;
+class WriteAheadLog;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
 class DuckTransactionManager : public TransactionManager {
 	friend struct CheckpointLock;
+	friend class BackgroundCheckpointer;
 
 public:
 	explicit DuckTransactionManager(AttachedDatabase &db);
@@ -33,6 +40,16 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Stop the background checkpoint thread (if any), waiting for a running background checkpoint to finish
+	void StopBackgroundCheckpoints();
+	//! Obtain the write lock in shared mode: a background checkpoint cannot run while it is held. If already_held is
+	//! set, the caller holds the lock through its optimistic writes, and does not wait for a waiting checkpoint
+	unique_ptr<StorageLockKey> SharedWriteLock(bool already_held = false);
+	//! Obtain the write lock in shared mode without waiting, returns nullptr if a background checkpoint holds it or is
+	//! waiting for it
+	unique_ptr<StorageLockKey> TrySharedWriteLock();
+	//! Called by a background checkpoint once it has written the given table
+	void TableCheckpointed(DataTableInfo &info);
 
 	transaction_t LowestActiveId() {
 		return lowest_active_id;
@@ -55,6 +72,16 @@ private:
 	CheckpointDecision CanCheckpoint(optional_ptr<DuckTransaction> current = nullptr);
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction) noexcept;
+	//! Sync the WAL up to the given position after a commit, without holding the transaction lock
+	ErrorData SyncCommit(WriteAheadLog &log, idx_t wal_sync_position);
+	//! Checkpoint the database from the background checkpoint thread while other transactions can read it, and can
+	//! commit appends. Returns false if transactions that modify the database in place, or that need old row versions,
+	//! prevent the checkpoint. If wait_for_writers is set, new transactions cannot modify the database in place until
+	//! the current writers have finished
+	bool BackgroundCheckpoint(bool wait_for_writers);
+	//! Whether the given transaction, which only appended to tables, has to wait for the running background checkpoint
+	//! to write these tables before it can commit
+	bool WaitForCheckpoint(DuckTransaction &transaction);
 
 private:
 	//! The current start timestamp used by transactions
@@ -75,6 +102,18 @@ private:
 	mutex transaction_lock;
 
 	bool thread_is_checkpointing;
+	//! Transactions hold this lock in shared mode from their first in-place modification until they have finished,
+	//! and so do transactions that have written appended rows to the database file. A background checkpoint holds it
+	//! exclusively, so that it does not need the transaction lock while it runs
+	StorageLock write_lock;
+	//! Whether a background checkpoint is running
+	bool background_checkpoint_running;
+	//! The number of the last background checkpoint
+	idx_t checkpoint_number;
+	//! Signalled when a background checkpoint has written a table, or has finished
+	std::condition_variable checkpoint_progress;
+	//! Runs automatic checkpoints in the background (if background_checkpoint is enabled)
+	unique_ptr<BackgroundCheckpointer> background_checkpointer;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
@@ -67,6 +67,8 @@ public:
 	//! Creates an optimistic writer for this table
 	OptimisticDataWriter &CreateOptimisticWriter();
 	void FinalizeOptimisticWriter(OptimisticDataWriter &writer);
+	//! Whether any of the optimistic writers holds the write lock of the transaction manager
+	bool HoldsWriteLock();
 };
 
 class LocalTableManager {
@@ -75,6 +77,8 @@ public:
 	reference_map_t<DataTable, shared_ptr<LocalTableStorage>> MoveEntries();
 	optional_ptr<LocalTableStorage> GetStorage(DataTable &table);
 	LocalTableStorage &GetOrCreateStorage(DataTable &table);
+	vector<reference<DataTable>> GetTables();
+	bool HoldsWriteLock();
 	idx_t EstimatedSize();
 	bool IsEmpty();
 	void InsertEntry(DataTable &table, shared_ptr<LocalTableStorage> entry);
@@ -140,6 +144,10 @@ public:
 	idx_t EstimatedSize();
 
 	bool Find(DataTable &table);
+	//! The tables that the transaction has local storage for
+	vector<reference<DataTable>> GetTables();
+	//! Whether the optimistic writes of the transaction hold the write lock of the transaction manager
+	bool HoldsWriteLock();
 
 	idx_t AddedRows(DataTable &table);
 
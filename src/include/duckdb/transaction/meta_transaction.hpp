@@ -54,7 +54,9 @@ public:
 	idx_t GetActiveQuery();
 	void SetActiveQuery(transaction_t query_number);
 
-	void ModifyDatabase(AttachedDatabase &db);
+	//! Register a modification of the given database. Appends stay in transaction-local storage until the transaction
+	//! commits, so an append_only modification does not change the database in place
+	void ModifyDatabase(AttachedDatabase &db, bool append_only = false);
 	optional_ptr<AttachedDatabase> ModifiedDatabase() {
 		return modified_database;
 	}
@@ -53,6 +53,8 @@ public:
 
 	//! Whether or not the transaction has made any modifications to the database so far
 	DUCKDB_API bool IsReadOnly();
+	//! Called before the transaction modifies the database in place, i.e. other than by appending rows to a table
+	DUCKDB_API virtual void SetReadWrite();
 
 	virtual bool IsDuckTransaction() const {
 		return false;
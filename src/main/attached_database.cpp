@@ -148,6 +148,10 @@ void AttachedDatabase::Close() {
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// wait for any running background checkpoint before shutting down
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
 
 	if (Exception::UncaughtException()) {
 		return;
@@ -20,6 +20,7 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
@@ -57,6 +58,10 @@ public:
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The plan cache key of the prepared statement, if it should be returned to the plan cache after execution
+	string plan_cache_key;
+	//! The generation of the plan cache when the prepared statement was taken from it
+	idx_t plan_cache_generation = 0;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -215,7 +220,19 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	active_query->progress_bar.reset();
 
 	D_ASSERT(active_query.get());
+	shared_ptr<PreparedStatementData> cached_plan;
+	string plan_cache_key;
+	idx_t plan_cache_generation = active_query->plan_cache_generation;
+	if (success && !active_query->plan_cache_key.empty()) {
+		cached_plan = std::move(active_query->prepared);
+		plan_cache_key = std::move(active_query->plan_cache_key);
+	}
 	active_query.reset();
+	if (cached_plan) {
+		// the executor is destroyed: the plan can be used by other connections again
+		auto capacity = DBConfig::GetConfig(*this).options.plan_cache_size;
+		PlanCache::Get(*this).Insert(plan_cache_key, std::move(cached_plan), capacity, plan_cache_generation);
+	}
 	query_progress.Initialize();
 	ErrorData error;
 	try {
@@ -310,7 +327,8 @@ static bool IsExplainAnalyze(SQLStatement *statement) {
 shared_ptr<PreparedStatementData>
 ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const string &query,
                                                unique_ptr<SQLStatement> statement,
-                                               optional_ptr<case_insensitive_map_t<Value>> values) {
+                                               optional_ptr<case_insensitive_map_t<Value>> values,
+                                               PreparedStatementMode mode) {
 	StatementType statement_type = statement->type;
 	auto result = make_shared<PreparedStatementData>(statement_type);
 
@@ -342,9 +360,13 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
+	if (mode == PreparedStatementMode::PREPARE_FOR_PLAN_CACHE) {
+		PlanCache::RecordDataVersions(*plan, *result);
+	}
 	if (config.enable_optimizer && plan->RequireOptimizer()) {
 		profiler.StartPhase("optimizer");
 		Optimizer optimizer(*planner.binder, *this);
+		optimizer.keep_parameters = mode == PreparedStatementMode::PREPARE_FOR_PLAN_CACHE;
 		plan = optimizer.Optimize(std::move(plan));
 		D_ASSERT(plan);
 		profiler.EndPhase();
@@ -383,7 +405,7 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 		// if any registered state can request a rebind we do the binding on a copy first
 		shared_ptr<PreparedStatementData> result;
 		try {
-			result = CreatePreparedStatementInternal(lock, query, statement->Copy(), values);
+			result = CreatePreparedStatementInternal(lock, query, statement->Copy(), values, mode);
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			// check if any registered client context state wants to try a rebind
@@ -412,7 +434,7 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 		// an extension wants to do a rebind - do it once
 	}
 
-	return CreatePreparedStatementInternal(lock, query, std::move(statement), values);
+	return CreatePreparedStatementInternal(lock, query, std::move(statement), values, mode);
 }
 
 QueryProgress ClientContext::GetQueryProgress() {
@@ -461,7 +483,8 @@ void ClientContext::CheckIfPreparedStatementIsExecutable(PreparedStatementData &
 			    "Cannot execute statement of type \"%s\" on database \"%s\" which is attached in read-only mode!",
 			    StatementTypeToString(statement.statement_type), modified_database));
 		}
-		meta_transaction.ModifyDatabase(*entry);
+		auto append_only = statement.properties.appended_databases.count(modified_database) > 0;
+		meta_transaction.ModifyDatabase(*entry, append_only);
 	}
 }
 
@@ -713,9 +736,100 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 	return Execute(query, prepared, parameters);
 }
 
+unique_ptr<PendingQueryResult> ClientContext::PendingStatementWithPlanCache(ClientContextLock &lock,
+                                                                            const string &query,
+                                                                            SQLStatement &statement,
+                                                                            const PendingQueryParameters &parameters) {
+	auto capacity = DBConfig::GetConfig(*this).options.plan_cache_size;
+	if (capacity == 0 || parameters.parameters || statement.type != StatementType::SELECT_STATEMENT) {
+		return nullptr;
+	}
+	// plans are shared between connections: only use the cache when the connection uses the default settings
+	if (config.local_settings_modified || !config.enable_optimizer || config.AnyVerification() ||
+	    config.verify_parallelism || !transaction.IsAutoCommit()) {
+		return nullptr;
+	}
+	// temporary objects can shadow the tables that a cached plan of another connection reads
+	if (PlanCache::HasTemporaryObjects(*this)) {
+		return nullptr;
+	}
+	case_insensitive_map_t<Value> values;
+	auto parameterized_statement = statement.Copy();
+	if (!PlanCache::Parameterize(*parameterized_statement, values)) {
+		return nullptr;
+	}
+	auto key = PlanCache::GetKey(*this, *parameterized_statement);
+	auto &plan_cache = PlanCache::Get(*this);
+	if (plan_cache.IsUncacheable(key)) {
+		return nullptr;
+	}
+	auto generation = plan_cache.GetGeneration();
+	auto prepared = plan_cache.Take(key);
+	if (prepared && !PlanCache::CastParameters(*prepared, values)) {
+		// the cached plan does not have the same semantics for these literals: plan the original statement instead
+		plan_cache.Insert(key, std::move(prepared), capacity, generation);
+		return nullptr;
+	}
+	if (prepared) {
+		bool require_rebind;
+		try {
+			require_rebind = prepared->RequireRebind(*this, &values) || PlanCache::ReadsChangedData(*prepared);
+		} catch (std::exception &ex) {
+			// e.g. a database the plan reads from was detached
+			require_rebind = true;
+		}
+		if (require_rebind) {
+			// the cached plan is stale: drop it
+			prepared.reset();
+		}
+	}
+	if (prepared) {
+		plan_cache.RecordHit();
+	} else {
+		// RequireRebind needs the unbound statement when the plan is taken out of the cache again
+		auto unbound_statement = parameterized_statement->Copy();
+		try {
+			prepared = CreatePreparedStatement(lock, query, std::move(parameterized_statement), nullptr,
+			                                   PreparedStatementMode::PREPARE_FOR_PLAN_CACHE);
+		} catch (std::exception &ex) {
+			// the parameterized statement cannot be planned: fall back to planning the original statement
+			plan_cache.SetUncacheable(key, capacity);
+			return nullptr;
+		}
+		prepared->unbound_statement = std::move(unbound_statement);
+		if (!PlanCache::IsShareable(*prepared)) {
+			plan_cache.SetUncacheable(key, capacity);
+			return nullptr;
+		}
+		if (PlanCache::DependsOnParameterValues(*prepared)) {
+			// the plan cannot be reused for other values
+			plan_cache.SetUncacheable(key, capacity);
+			return nullptr;
+		}
+		if (!PlanCache::CastParameters(*prepared, values)) {
+			return nullptr;
+		}
+		plan_cache.RecordMiss();
+	}
+	CheckIfPreparedStatementIsExecutable(*prepared);
+	PendingQueryParameters cached_parameters;
+	cached_parameters.parameters = &values;
+	cached_parameters.allow_stream_result = parameters.allow_stream_result;
+	auto pending = PendingPreparedStatementInternal(lock, std::move(prepared), cached_parameters);
+	if (!pending->HasError()) {
+		active_query->plan_cache_key = std::move(key);
+		active_query->plan_cache_generation = generation;
+	}
+	return pending;
+}
+
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
+	auto cached_result = PendingStatementWithPlanCache(lock, query, *statement, parameters);
+	if (cached_result) {
+		return cached_result;
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
 	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
@@ -1120,6 +1234,7 @@ void ClientContext::Append(TableDescription &description, ColumnDataCollection &
 				throw InvalidInputException("Failed to append: table entry has different number of columns!");
 			}
 		}
+		MetaTransaction::Get(*this).ModifyDatabase(table_entry.ParentCatalog().GetAttached(), true);
 		table_entry.GetStorage().LocalAppend(table_entry, *this, collection);
 	});
 }
@@ -0,0 +1,294 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/comparison_expression.hpp"
+#include "duckdb/parser/expression/conjunction_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache() : plan_count(0), current_time(0), generation(0) {
+}
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return PlanCache::Get(DatabaseInstance::GetDatabase(context));
+}
+
+PlanCache &PlanCache::Get(DatabaseInstance &db) {
+	return db.GetPlanCache();
+}
+
+static bool IsParameterizableConstant(const ParsedExpression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::CONSTANT) {
+		return false;
+	}
+	auto &value = expr.Cast<ConstantExpression>().value;
+	if (value.IsNull()) {
+		return false;
+	}
+	return value.type().IsNumeric() || value.type().id() == LogicalTypeId::VARCHAR;
+}
+
+static void ParameterizeExpression(ParsedExpression &expr, SQLStatement &statement,
+                                   case_insensitive_map_t<Value> &values) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::CONJUNCTION: {
+		auto &conjunction = expr.Cast<ConjunctionExpression>();
+		for (auto &child : conjunction.children) {
+			ParameterizeExpression(*child, statement, values);
+		}
+		break;
+	}
+	case ExpressionClass::COMPARISON: {
+		auto &comparison = expr.Cast<ComparisonExpression>();
+		// only replace literals that are compared to a column
+		unique_ptr<ParsedExpression> *constant;
+		if (comparison.left->GetExpressionClass() == ExpressionClass::COLUMN_REF) {
+			constant = &comparison.right;
+		} else if (comparison.right->GetExpressionClass() == ExpressionClass::COLUMN_REF) {
+			constant = &comparison.left;
+		} else {
+			break;
+		}
+		if (!IsParameterizableConstant(**constant)) {
+			break;
+		}
+		auto parameter_nr = ++statement.n_param;
+		auto parameter = make_uniq<ParameterExpression>();
+		parameter->identifier = to_string(parameter_nr);
+		parameter->alias = (*constant)->alias;
+		statement.named_param_map[parameter->identifier] = parameter_nr;
+		values[parameter->identifier] = std::move((*constant)->Cast<ConstantExpression>().value);
+		*constant = std::move(parameter);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+bool PlanCache::Parameterize(SQLStatement &statement, case_insensitive_map_t<Value> &values) {
+	if (statement.type != StatementType::SELECT_STATEMENT || statement.n_param > 0) {
+		return false;
+	}
+	auto &select = statement.Cast<SelectStatement>();
+	if (select.node->type == QueryNodeType::SELECT_NODE) {
+		auto &node = select.node->Cast<SelectNode>();
+		if (node.where_clause) {
+			ParameterizeExpression(*node.where_clause, statement, values);
+		}
+	}
+	return true;
+}
+
+bool PlanCache::CastParameters(PreparedStatementData &prepared, case_insensitive_map_t<Value> &values) {
+	for (auto &entry : values) {
+		auto parameter = prepared.value_map.find(entry.first);
+		if (parameter == prepared.value_map.end()) {
+			return false;
+		}
+		auto &target_type = parameter->second->return_type;
+		auto &value = entry.second;
+		if (value.type() == target_type) {
+			continue;
+		}
+		// the literal is cast to the type that was inferred for the parameter
+		// this must not change the value: e.g. comparing an INTEGER column to 1.5 is not the same as comparing it to 2
+		Value cast_value;
+		Value original_value;
+		string error;
+		if (!value.DefaultTryCastAs(target_type, cast_value, &error) ||
+		    !cast_value.DefaultTryCastAs(value.type(), original_value, &error) ||
+		    !Value::NotDistinctFrom(value, original_value)) {
+			return false;
+		}
+		value = std::move(cast_value);
+	}
+	return true;
+}
+
+string PlanCache::GetKey(ClientContext &context, SQLStatement &statement) {
+	// the same statement can refer to different tables depending on the search path (e.g. after USE)
+	auto &search_path = ClientData::Get(context).catalog_search_path->Get();
+	return CatalogSearchEntry::ListToString(search_path) + "\n" + statement.ToString();
+}
+
+bool PlanCache::HasTemporaryObjects(ClientContext &context) {
+	// the cache is only used in auto-commit mode: all temporary objects of the connection are committed, and scanning
+	// the committed entries does not create the default entries of the catalog sets
+	bool has_objects = false;
+	auto &catalog = ClientData::Get(context).temporary_objects->GetCatalog().Cast<DuckCatalog>();
+	catalog.ScanSchemas([&](SchemaCatalogEntry &schema) {
+		for (auto type : {CatalogType::TABLE_ENTRY, CatalogType::SEQUENCE_ENTRY, CatalogType::MACRO_ENTRY,
+		                  CatalogType::TABLE_MACRO_ENTRY, CatalogType::TYPE_ENTRY}) {
+			schema.Scan(type, [&](CatalogEntry &) { has_objects = true; });
+		}
+	});
+	return has_objects;
+}
+
+static bool IsShareablePlan(const PhysicalOperator &op) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		// the bind data of other table functions can depend on the connection that bound them
+		if (op.Cast<PhysicalTableScan>().function.name != "seq_scan") {
+			return false;
+		}
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!IsShareablePlan(child.get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PlanCache::IsShareable(PreparedStatementData &prepared) {
+	if (!prepared.plan || prepared.statement_type != StatementType::SELECT_STATEMENT) {
+		return false;
+	}
+	auto &properties = prepared.properties;
+	if (properties.always_require_rebind || !properties.bound_all_parameters ||
+	    !properties.modified_databases.empty()) {
+		return false;
+	}
+	if (properties.read_databases.find(TEMP_CATALOG) != properties.read_databases.end()) {
+		// temporary objects are local to the connection
+		return false;
+	}
+	return IsShareablePlan(*prepared.plan);
+}
+
+bool PlanCache::DependsOnParameterValues(PreparedStatementData &prepared) {
+	for (auto &entry : prepared.value_map) {
+		// the optimizer invalidates parameters that it pushes into a table scan to force a rebind on execution
+		if (!entry.second->return_type.IsValid()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void PlanCache::RecordDataVersions(LogicalOperator &plan, PreparedStatementData &prepared) {
+	if (plan.type == LogicalOperatorType::LOGICAL_GET) {
+		auto &get = plan.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (table && table->IsDuckTable()) {
+			auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+			prepared.data_versions.emplace_back(bind_data.table.GetStorage().info, bind_data.data_version);
+		}
+	}
+	for (auto &child : plan.children) {
+		RecordDataVersions(*child, prepared);
+	}
+}
+
+bool PlanCache::ReadsChangedData(PreparedStatementData &prepared) {
+	for (auto &entry : prepared.data_versions) {
+		if (entry.first->data_version != entry.second) {
+			return true;
+		}
+	}
+	return false;
+}
+
+shared_ptr<PreparedStatementData> PlanCache::Take(const string &key) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end() || entry->second.plans.empty()) {
+		return nullptr;
+	}
+	auto result = std::move(entry->second.plans.back());
+	entry->second.plans.pop_back();
+	entry->second.last_used = ++current_time;
+	plan_count--;
+	return result;
+}
+
+void PlanCache::Insert(const string &key, shared_ptr<PreparedStatementData> prepared, idx_t capacity,
+                       idx_t plan_generation) {
+	lock_guard<mutex> guard(lock);
+	if (plan_generation != generation || capacity == 0) {
+		// the cache was cleared while the plan was in use
+		return;
+	}
+	auto &entry = entries[key];
+	entry.plans.push_back(std::move(prepared));
+	entry.last_used = ++current_time;
+	plan_count++;
+	EvictEntries(capacity);
+}
+
+void PlanCache::EvictEntries(idx_t capacity) {
+	while (plan_count > capacity) {
+		// evict the plans of the least recently used entry
+		auto lru_entry = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < lru_entry->second.last_used) {
+				lru_entry = it;
+			}
+		}
+		D_ASSERT(lru_entry != entries.end());
+		plan_count -= lru_entry->second.plans.size();
+		statistics.evictions += lru_entry->second.plans.size();
+		entries.erase(lru_entry);
+	}
+}
+
+void PlanCache::SetUncacheable(const string &key, idx_t capacity) {
+	lock_guard<mutex> guard(lock);
+	if (uncacheable.size() >= capacity) {
+		uncacheable.clear();
+	}
+	uncacheable.insert(key);
+}
+
+bool PlanCache::IsUncacheable(const string &key) {
+	lock_guard<mutex> guard(lock);
+	return uncacheable.find(key) != uncacheable.end();
+}
+
+void PlanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	uncacheable.clear();
+	plan_count = 0;
+	generation++;
+}
+
+idx_t PlanCache::GetGeneration() {
+	lock_guard<mutex> guard(lock);
+	return generation;
+}
+
+void PlanCache::RecordHit() {
+	lock_guard<mutex> guard(lock);
+	statistics.hits++;
+}
+
+void PlanCache::RecordMiss() {
+	lock_guard<mutex> guard(lock);
+	statistics.misses++;
+}
+
+PlanCacheStatistics PlanCache::GetStatistics() {
+	lock_guard<mutex> guard(lock);
+	auto result = statistics;
+	result.cached_plans = plan_count;
+	return result;
+}
+
+} // namespace duckdb
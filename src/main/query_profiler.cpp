@@ -1,5 +1,6 @@
 #include "duckdb/main/query_profiler.hpp"
 
+#include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/fstream.hpp"
 #include "duckdb/common/http_state.hpp"
 #include "duckdb/common/limits.hpp"
@@ -15,7 +16,10 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 #include <algorithm>
 #include <utility>
@@ -72,6 +76,9 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze, bool start
 	root = nullptr;
 	phase_timings.clear();
 	phase_stack.clear();
+	temporary_data.clear();
+	scheduler_statistics.reset();
+	memory_info_at_start = BufferManager::GetBufferManager(context).GetMemoryUsageInfo();
 
 	main_query.Start();
 }
@@ -122,10 +129,35 @@ void QueryProfiler::Finalize(TreeNode &node) {
 	}
 }
 
+void QueryProfiler::SetSchedulerStatistics(shared_ptr<ProducerStatistics> statistics) {
+	scheduler_statistics = std::move(statistics);
+}
+
 void QueryProfiler::StartExplainAnalyze() {
 	this->is_explain_analyze = true;
 }
 
+void QueryProfiler::CollectTemporaryData() {
+	temporary_data.clear();
+	auto memory_info_at_end = BufferManager::GetBufferManager(context).GetMemoryUsageInfo();
+	for (auto &end_info : memory_info_at_end) {
+		for (auto &start_info : memory_info_at_start) {
+			if (start_info.tag != end_info.tag) {
+				continue;
+			}
+			MemoryInformation info;
+			info.tag = end_info.tag;
+			info.size = end_info.size;
+			info.evicted_data = end_info.evicted_data;
+			info.spilled_data = end_info.spilled_data - start_info.spilled_data;
+			info.read_back_data = end_info.read_back_data - start_info.read_back_data;
+			if (info.spilled_data > 0 || info.read_back_data > 0) {
+				temporary_data.push_back(info);
+			}
+		}
+	}
+}
+
 void QueryProfiler::EndQuery() {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -136,6 +168,7 @@ void QueryProfiler::EndQuery() {
 	if (root) {
 		Finalize(*root);
 	}
+	CollectTemporaryData();
 	this->running = false;
 	// print or output the query profiling after termination
 	// EXPLAIN ANALYSE should not be outputted by the profiler
@@ -226,7 +259,11 @@ void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
 	}
 }
 
-OperatorProfiler::OperatorProfiler(bool enabled_p) : enabled(enabled_p), active_operator(nullptr) {
+OperatorProfiler::OperatorProfiler(bool enabled_p, bool hardware_counters_enabled)
+    : enabled(enabled_p), active_operator(nullptr), task_active(false), has_counters_at_start(false) {
+	if (enabled && hardware_counters_enabled) {
+		hardware_counters = make_uniq<HardwareCounters>();
+	}
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -240,6 +277,10 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 
 	active_operator = phys_op;
 
+	if (task_active && phys_op) {
+		// attribute the buffer pool reservations of this thread to the operator
+		BufferPool::SetOperatorMemoryInformation(&memory_information[*phys_op]);
+	}
 	// start timing for current element
 	op.Start();
 }
@@ -257,9 +298,51 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 	op.End();
 
 	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	if (task_active) {
+		BufferPool::SetOperatorMemoryInformation(nullptr);
+		if (has_counters_at_start && Value::DoubleIsFinite(op.Elapsed())) {
+			task_timings[*active_operator] += op.Elapsed();
+		}
+	}
 	active_operator = nullptr;
 }
 
+void OperatorProfiler::StartTask() {
+	if (!enabled) {
+		return;
+	}
+	task_active = true;
+	if (hardware_counters) {
+		has_counters_at_start = hardware_counters->Read(counters_at_start);
+	}
+}
+
+void OperatorProfiler::EndTask() {
+	if (!task_active) {
+		return;
+	}
+	task_active = false;
+	BufferPool::SetOperatorMemoryInformation(nullptr);
+	if (!has_counters_at_start) {
+		return;
+	}
+	has_counters_at_start = false;
+
+	HardwareCounterValues counters_at_end;
+	if (hardware_counters->Read(counters_at_end)) {
+		double task_time = 0;
+		for (auto &entry : task_timings) {
+			task_time += entry.second;
+		}
+		for (auto &entry : task_timings) {
+			if (task_time > 0) {
+				AddHardwareCounters(entry.first, counters_at_start, counters_at_end, entry.second / task_time);
+			}
+		}
+	}
+	task_timings.clear();
+}
+
 void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements) {
 	if (!enabled) {
 		return;
@@ -277,6 +360,46 @@ void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t
 		entry->second.elements += elements;
 	}
 }
+
+void OperatorProfiler::AddHardwareCounters(const PhysicalOperator &op, const HardwareCounterValues &start,
+                                           const HardwareCounterValues &end, double fraction) {
+	auto &info = timings[op];
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		if (end.values[i] < start.values[i]) {
+			// the counter was re-opened in between: skip it
+			continue;
+		}
+		auto value = idx_t(double(end.values[i] - start.values[i]) * fraction);
+		info.AddCounter(HardwareCounterValues::GetName(HardwareCounterType(i)), value);
+	}
+}
+
+void OperatorProfiler::AddMemoryCounters(const PhysicalOperator &op, const OperatorMemoryInformation &memory) {
+	auto &info = timings[op];
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		if (memory.allocated[i] == 0) {
+			continue;
+		}
+		auto tag_name = StringUtil::Lower(EnumUtil::ToString(MemoryTag(i)));
+		info.AddCounter("allocated_bytes_" + tag_name, memory.allocated[i]);
+		// the peaks of the threads are added up: this is an upper bound of the peak of the operator
+		info.AddCounter("peak_bytes_" + tag_name, memory.peak[i]);
+	}
+	if (memory.spilled_data > 0) {
+		info.AddCounter("spilled_bytes", memory.spilled_data);
+	}
+	if (memory.read_back_data > 0) {
+		info.AddCounter("read_back_bytes", memory.read_back_data);
+	}
+}
+
+void OperatorProfiler::AddCounter(const PhysicalOperator &phys_op, const string &name, idx_t value) {
+	if (!enabled || value == 0) {
+		return;
+	}
+	timings[phys_op].AddCounter(name, value);
+}
+
 void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor,
                              const string &name, int id) {
 	auto entry = timings.find(phys_op);
@@ -288,6 +411,13 @@ void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor
 }
 
 void QueryProfiler::Flush(OperatorProfiler &profiler) {
+	// add the hardware counters of the current task before flushing
+	profiler.EndTask();
+	for (auto &entry : profiler.memory_information) {
+		profiler.AddMemoryCounters(entry.first, entry.second);
+	}
+	profiler.memory_information.clear();
+
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
 		return;
@@ -300,6 +430,11 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 		tree_node.info.time += node.second.time;
 		tree_node.info.elements += node.second.elements;
+		// the parameters of an operator can change during execution (e.g. dynamic filters pushed into a scan)
+		tree_node.extra_info = op.ParamsToString();
+		for (auto &counter : node.second.counters) {
+			tree_node.info.AddCounter(counter.first, counter.second);
+		}
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
@@ -400,6 +535,43 @@ void QueryProfiler::QueryTreeToStream(std::ostream &ss) const {
 	ss << "││" + DrawPadded(total_time, TOTAL_BOX_WIDTH - 4) + "││\n";
 	ss << "│└───────────────────────────────────┘│\n";
 	ss << "└─────────────────────────────────────┘\n";
+	// print the data that was written to the temporary directory - by any query, as the counters are database-wide
+	if (!temporary_data.empty()) {
+		ss << "┌─────────────────────────────────────┐\n";
+		ss << "│┌───────────────────────────────────┐│\n";
+		ss << "││  Temporary Data (Database-Wide):  ││\n";
+		ss << "││                                   ││\n";
+		for (auto &info : temporary_data) {
+			string tag = RenderTitleCase(EnumUtil::ToString(info.tag)) + ":";
+			string spilled = "out: " + StringUtil::BytesToHumanReadableString(info.spilled_data);
+			string read_back = "in: " + StringUtil::BytesToHumanReadableString(info.read_back_data);
+			ss << "││" + DrawPadded(tag, TOTAL_BOX_WIDTH - 4) + "││\n";
+			ss << "││" + DrawPadded(spilled + ", " + read_back, TOTAL_BOX_WIDTH - 4) + "││\n";
+		}
+		ss << "│└───────────────────────────────────┘│\n";
+		ss << "└─────────────────────────────────────┘\n";
+	}
+	// print how the tasks of the query were scheduled if they were not scheduled with the default settings
+	auto print_scheduler_statistics =
+	    scheduler_statistics &&
+	    (scheduler_statistics->priority != TaskPriority::NORMAL || scheduler_statistics->max_threads != 0 ||
+	     scheduler_statistics->tasks_preempted > 0);
+	if (print_scheduler_statistics) {
+		auto &statistics = *scheduler_statistics;
+		string priority = "Priority: " + EnumUtil::ToString(statistics.priority);
+		string tasks = "Tasks: " + to_string(statistics.tasks_executed.load()) + " (" +
+		               to_string(statistics.tasks_preempted.load()) + " preempted)";
+		string threads = "Peak Threads: " + to_string(statistics.peak_threads.load());
+		ss << "┌─────────────────────────────────────┐\n";
+		ss << "│┌───────────────────────────────────┐│\n";
+		ss << "││             Scheduler:            ││\n";
+		ss << "││                                   ││\n";
+		ss << "││" + DrawPadded(priority, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + DrawPadded(tasks, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + DrawPadded(threads, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "│└───────────────────────────────────┘│\n";
+		ss << "└─────────────────────────────────────┘\n";
+	}
 	// print phase timings
 	if (PrintOptimizerOutput()) {
 		bool has_previous_phase = false;
@@ -476,6 +648,9 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, idx
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
+	for (auto &counter : node.info.counters) {
+		ss << string(depth * 3, ' ') << "   \"" + counter.first + "\": " + to_string(counter.second) + ",\n";
+	}
 	ss << string(depth * 3, ' ') << "   \"children\": [\n";
 	if (node.children.empty()) {
 		ss << string(depth * 3, ' ') << "   ]\n";
@@ -524,6 +699,32 @@ string QueryProfiler::ToJSON() const {
 	}
 	ss << "\n";
 	ss << "   ],\n";
+	// print the temporary directory usage of the database while the query ran
+	ss << "   \"database_temporary_data\": [\n";
+	for (idx_t i = 0; i < temporary_data.size(); i++) {
+		if (i > 0) {
+			ss << ",\n";
+		}
+		ss << "   {\n";
+		ss << "   \"tag\": \"" + EnumUtil::ToString(temporary_data[i].tag) + "\", \n";
+		ss << "   \"spilled_bytes\": " + to_string(temporary_data[i].spilled_data) + ", \n";
+		ss << "   \"read_back_bytes\": " + to_string(temporary_data[i].read_back_data) + "\n";
+		ss << "   }";
+	}
+	ss << "\n";
+	ss << "   ],\n";
+	// print how the tasks of the query were scheduled
+	if (scheduler_statistics) {
+		auto &statistics = *scheduler_statistics;
+		ss << "   \"scheduler\": {\n";
+		ss << "   \"priority\": \"" + EnumUtil::ToString(statistics.priority) + "\", \n";
+		ss << "   \"max_threads\": " + to_string(statistics.max_threads) + ", \n";
+		ss << "   \"tasks_scheduled\": " + to_string(statistics.tasks_scheduled.load()) + ", \n";
+		ss << "   \"tasks_executed\": " + to_string(statistics.tasks_executed.load()) + ", \n";
+		ss << "   \"tasks_preempted\": " + to_string(statistics.tasks_preempted.load()) + ", \n";
+		ss << "   \"peak_threads\": " + to_string(statistics.peak_threads.load()) + "\n";
+		ss << "   },\n";
+	}
 	// recursively print the physical operator tree
 	ss << "   \"children\": [\n";
 	ToJSONRecursive(*root, ss);
@@ -78,6 +78,54 @@ Value AllowPersistentSecrets::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = BooleanValue::Get(input);
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Background Checkpoint Interval
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointIntervalSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint_interval = input.GetValue<uint64_t>();
+}
+
+void BackgroundCheckpointIntervalSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint_interval = DBConfig().options.background_checkpoint_interval;
+}
+
+Value BackgroundCheckpointIntervalSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.background_checkpoint_interval);
+}
+
+//===--------------------------------------------------------------------===//
+// Background Checkpoint Timeout
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointTimeoutSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint_timeout = input.GetValue<uint64_t>();
+}
+
+void BackgroundCheckpointTimeoutSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint_timeout = DBConfig().options.background_checkpoint_timeout;
+}
+
+Value BackgroundCheckpointTimeoutSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.background_checkpoint_timeout);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -95,6 +143,23 @@ Value CheckpointThresholdSetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Checkpoint Write Rate Limit
+//===--------------------------------------------------------------------===//
+void CheckpointWriteRateLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto new_limit = DBConfig::ParseMemoryLimit(input.ToString());
+	config.options.checkpoint_write_rate_limit = new_limit == DConstants::INVALID_INDEX ? 0 : new_limit;
+}
+
+void CheckpointWriteRateLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_write_rate_limit = DBConfig().options.checkpoint_write_rate_limit;
+}
+
+Value CheckpointWriteRateLimitSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_write_rate_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -937,6 +1002,42 @@ Value ImmediateTransactionModeSetting::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(config.options.immediate_transaction_mode);
 }
 
+//===--------------------------------------------------------------------===//
+// Index Scan Max Count
+//===--------------------------------------------------------------------===//
+void IndexScanMaxCountSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.index_scan_max_count = input.GetValue<uint64_t>();
+}
+
+void IndexScanMaxCountSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.index_scan_max_count = DBConfig().options.index_scan_max_count;
+}
+
+Value IndexScanMaxCountSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.index_scan_max_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Scan Percentage
+//===--------------------------------------------------------------------===//
+void IndexScanPercentageSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto index_scan_percentage = input.GetValue<double>();
+	if (index_scan_percentage < 0 || index_scan_percentage > 1) {
+		throw InvalidInputException("index_scan_percentage must be between 0 and 1");
+	}
+	config.options.index_scan_percentage = index_scan_percentage;
+}
+
+void IndexScanPercentageSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.index_scan_percentage = DBConfig().options.index_scan_percentage;
+}
+
+Value IndexScanPercentageSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.index_scan_percentage);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Expression Depth
 //===--------------------------------------------------------------------===//
@@ -1037,6 +1138,32 @@ Value PerfectHashThresholdSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).perfect_ht_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "auto") {
+		config.options.pin_threads = ThreadPinMode::AUTO;
+	} else if (parameter == "on") {
+		config.options.pin_threads = ThreadPinMode::ON;
+	} else if (parameter == "off") {
+		config.options.pin_threads = ThreadPinMode::OFF;
+	} else {
+		throw InvalidInputException("Unrecognized value \"%s\" for pin_threads, expected either AUTO, ON or OFF",
+		                            parameter);
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+}
+
+Value PinThreadsSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.pin_threads)));
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1067,6 +1194,22 @@ Value PivotLimitSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).pivot_limit);
 }
 
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<uint64_t>();
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+}
+
+Value PlanCacheSizeSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -1189,6 +1332,47 @@ Value ProgressBarTimeSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Max Threads
+//===--------------------------------------------------------------------===//
+void QueryMaxThreadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_max_threads = ClientConfig().query_max_threads;
+}
+
+void QueryMaxThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).query_max_threads = input.GetValue<idx_t>();
+}
+
+Value QueryMaxThreadsSetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_max_threads);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (parameter == "low") {
+		config.query_priority = TaskPriority::LOW;
+	} else if (parameter == "normal") {
+		config.query_priority = TaskPriority::NORMAL;
+	} else if (parameter == "high") {
+		config.query_priority = TaskPriority::HIGH;
+	} else {
+		throw InvalidInputException("Unrecognized query priority \"%s\", expected either LOW, NORMAL or HIGH",
+		                            parameter);
+	}
+}
+
+Value QueryPrioritySetting::GetSetting(ClientContext &context) {
+	return Value(StringUtil::Lower(EnumUtil::ToString(ClientConfig::GetConfig(context).query_priority)));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1246,6 +1430,41 @@ Value SecretDirectorySetting::GetSetting(ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Synchronous
+//===--------------------------------------------------------------------===//
+void SynchronousSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "off") {
+		config.options.synchronous = WALSynchronousMode::OFF;
+	} else if (parameter == "normal") {
+		config.options.synchronous = WALSynchronousMode::NORMAL;
+	} else if (parameter == "full") {
+		config.options.synchronous = WALSynchronousMode::FULL;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option SYNCHRONOUS \"%s\". Expected OFF, NORMAL or FULL.", parameter);
+	}
+}
+
+void SynchronousSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.synchronous = DBConfig().options.synchronous;
+}
+
+Value SynchronousSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.synchronous) {
+	case WALSynchronousMode::OFF:
+		return "off";
+	case WALSynchronousMode::NORMAL:
+		return "normal";
+	case WALSynchronousMode::FULL:
+		return "full";
+	default:
+		throw InternalException("Unknown synchronous mode setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -1272,6 +1491,22 @@ Value TempDirectorySetting::GetSetting(ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = BooleanValue::Get(input);
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -435,6 +436,17 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
+//! Sorts the values of an (integral) IN list, and checks whether they form a consecutive range
+static bool IsConsecutiveInList(vector<Value> &in_values) {
+	sort(in_values.begin(), in_values.end());
+	for (idx_t val_idx = 1; val_idx < in_values.size(); val_idx++) {
+		if (in_values[val_idx].GetValue<hugeint_t>() - in_values[val_idx - 1].GetValue<hugeint_t>() > 1) {
+			return false;
+		}
+	}
+	return true;
+}
+
 TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_ids) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
@@ -546,7 +558,6 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			}
 		} else if (remaining_filter->type == ExpressionType::COMPARE_IN) {
 			auto &func = remaining_filter->Cast<BoundOperatorExpression>();
-			vector<hugeint_t> in_values;
 			D_ASSERT(func.children.size() > 1);
 			if (func.children[0]->expression_class != ExpressionClass::BOUND_COLUMN_REF) {
 				continue;
@@ -568,46 +579,44 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			}
 			auto &fst_const_value_expr = func.children[1]->Cast<BoundConstantExpression>();
 			auto &type = fst_const_value_expr.value.type();
-
-			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
-			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
+			if (type != column_ref.return_type) {
 				continue;
 			}
 
-			bool can_simplify_in_clause = true;
+			bool has_null = false;
+			vector<Value> in_values;
 			for (idx_t i = 1; i < func.children.size(); i++) {
 				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
 				if (const_value_expr.value.IsNull()) {
-					can_simplify_in_clause = false;
+					has_null = true;
 					break;
 				}
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				in_values.push_back(const_value_expr.value);
 			}
-			if (!can_simplify_in_clause || in_values.empty()) {
+			if (has_null || in_values.empty()) {
 				continue;
 			}
 
-			sort(in_values.begin(), in_values.end());
-
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
-				}
-			}
-			if (!can_simplify_in_clause) {
+			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
+			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
+			if (type.IsIntegral() && IsConsecutiveInList(in_values)) {
+				auto lower_bound =
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, in_values.front());
+				auto upper_bound =
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, in_values.back());
+				table_filters.PushFilter(column_index, std::move(lower_bound));
+				table_filters.PushFilter(column_index, std::move(upper_bound));
+			} else if (InFilter::SupportsType(type)) {
+				//! Otherwise we push the set of values into the scan, which can prune segments through their zonemaps
+				// e.g. x IN (1, 5, 10) only needs to scan segments that could contain 1, 5 or 10
+				table_filters.PushFilter(column_index, make_uniq<InFilter>(std::move(in_values)));
+			} else {
 				continue;
 			}
-			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.front()));
-			auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.back()));
-			table_filters.PushFilter(column_index, std::move(lower_bound));
-			table_filters.PushFilter(column_index, std::move(upper_bound));
 			table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 
 			remaining_filters.erase(remaining_filters.begin() + rem_fil_idx);
+			rem_fil_idx--;
 		}
 	}
 
@@ -0,0 +1,160 @@
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+	}
+	VisitOperatorChildren(op);
+}
+
+void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+		// rows on the probe side (LHS) that have no match on the build side (RHS) are not part of the result
+		break;
+	default:
+		return;
+	}
+	auto filter_pushdown = make_uniq<JoinFilterPushdownInfo>();
+	vector<PushdownColumn> pushdown_columns;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF) {
+			// only simple column references on the probe side can be traced back to a scan
+			continue;
+		}
+		if (!JoinFilterPushdownInfo::CanPushFilter(cond.left->return_type)) {
+			continue;
+		}
+		auto &colref = cond.left->Cast<BoundColumnRefExpression>();
+		pushdown_columns.push_back(PushdownColumn {filter_pushdown->join_condition.size(), colref.binding});
+		filter_pushdown->join_condition.push_back(cond_idx);
+	}
+	if (pushdown_columns.empty()) {
+		return;
+	}
+	GetPushdownFilterTargets(*join.children[0], std::move(pushdown_columns), filter_pushdown->probe_info);
+	if (filter_pushdown->probe_info.empty()) {
+		return;
+	}
+	join.filter_pushdown = std::move(filter_pushdown);
+}
+
+void JoinFilterPushdownOptimizer::GetPushdownFilterTargets(LogicalOperator &op, vector<PushdownColumn> columns,
+                                                           vector<JoinFilterPushdownFilter> &targets) {
+	if (columns.empty()) {
+		return;
+	}
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (!get.function.filter_pushdown || !get.function.dynamic_filter_pushdown || !get.children.empty()) {
+			return;
+		}
+		JoinFilterPushdownFilter target;
+		for (auto &column : columns) {
+			if (column.binding.table_index != get.table_index) {
+				continue;
+			}
+			auto column_index = column.binding.column_index;
+			if (column_index >= get.column_ids.size() || get.column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+				continue;
+			}
+			target.columns.push_back(JoinFilterPushdownColumn {column.filter_idx, column_index});
+		}
+		if (target.columns.empty()) {
+			return;
+		}
+		if (!get.dynamic_filters) {
+			get.dynamic_filters = make_shared<DynamicTableFilterSet>();
+		}
+		target.dynamic_filters = get.dynamic_filters;
+		targets.push_back(std::move(target));
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		// filters do not change the column bindings
+		GetPushdownFilterTargets(*op.children[0], std::move(columns), targets);
+		break;
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		// replace the bindings with the bindings of the projected column references
+		auto &proj = op.Cast<LogicalProjection>();
+		vector<PushdownColumn> child_columns;
+		for (auto &column : columns) {
+			if (column.binding.table_index != proj.table_index) {
+				continue;
+			}
+			auto &expr = *proj.expressions[column.binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				continue;
+			}
+			auto &colref = expr.Cast<BoundColumnRefExpression>();
+			child_columns.push_back(PushdownColumn {column.filter_idx, colref.binding});
+		}
+		GetPushdownFilterTargets(*op.children[0], std::move(child_columns), targets);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		// filtering on a group removes entire groups, so we can push through group columns
+		auto &aggr = op.Cast<LogicalAggregate>();
+		if (aggr.grouping_sets.size() > 1) {
+			return;
+		}
+		vector<PushdownColumn> child_columns;
+		for (auto &column : columns) {
+			if (column.binding.table_index != aggr.group_index) {
+				continue;
+			}
+			auto &expr = *aggr.groups[column.binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				continue;
+			}
+			auto &colref = expr.Cast<BoundColumnRefExpression>();
+			child_columns.push_back(PushdownColumn {column.filter_idx, colref.binding});
+		}
+		GetPushdownFilterTargets(*op.children[0], std::move(child_columns), targets);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+		GetPushdownFilterTargets(*op.children[0], columns, targets);
+		GetPushdownFilterTargets(*op.children[1], std::move(columns), targets);
+		break;
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		switch (join.join_type) {
+		case JoinType::INNER:
+			// the output of an inner join only contains rows that exist in both sides
+			GetPushdownFilterTargets(*op.children[0], columns, targets);
+			GetPushdownFilterTargets(*op.children[1], std::move(columns), targets);
+			break;
+		case JoinType::LEFT:
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+		case JoinType::MARK:
+			// these joins only produce (a subset of) the rows of the LHS
+			GetPushdownFilterTargets(*op.children[0], std::move(columns), targets);
+			break;
+		default:
+			break;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+} // namespace duckdb
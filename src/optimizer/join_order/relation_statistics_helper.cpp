@@ -8,6 +8,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 
 namespace duckdb {
 
@@ -372,6 +373,16 @@ idx_t RelationStatisticsHelper::InspectConjunctionAND(idx_t cardinality, idx_t c
                                                       ConjunctionAndFilter &filter, BaseStatistics &base_stats) {
 	auto cardinality_after_filters = cardinality;
 	for (auto &child_filter : filter.child_filters) {
+		if (child_filter->filter_type == TableFilterType::IN_FILTER) {
+			// every value in the IN list is expected to match cardinality/column_count rows
+			auto &in_filter = child_filter->Cast<InFilter>();
+			auto column_count = base_stats.GetDistinctCount();
+			if (column_count > 0) {
+				auto in_cardinality = (cardinality * in_filter.values.size() + column_count - 1) / column_count;
+				cardinality_after_filters = MinValue(cardinality_after_filters, in_cardinality);
+			}
+			continue;
+		}
 		if (child_filter->filter_type != TableFilterType::CONSTANT_COMPARISON) {
 			continue;
 		}
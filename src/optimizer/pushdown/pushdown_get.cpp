@@ -11,10 +11,11 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperat
 	D_ASSERT(op->type == LogicalOperatorType::LOGICAL_GET);
 	auto &get = op->Cast<LogicalGet>();
 
-	if (get.function.pushdown_complex_filter || get.function.filter_pushdown) {
+	if ((get.function.pushdown_complex_filter || get.function.filter_pushdown) && !optimizer.keep_parameters) {
 		// this scan supports some form of filter push-down
 		// check if there are any parameters
 		// if there are, invalidate them to force a re-bind on execution
+		// plans that are cached for all parameter values instead keep the filters with parameters above the scan
 		for (auto &filter : filters) {
 			if (filter->filter->HasParameter()) {
 				// there is a parameter in the filters! invalidate it
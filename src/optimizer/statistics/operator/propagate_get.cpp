@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -25,6 +26,13 @@ void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &input, TableFi
 		UpdateFilterStatistics(input, constant_filter.comparison_type, constant_filter.constant);
 		break;
 	}
+	case TableFilterType::IN_FILTER: {
+		// the values are sorted, so the smallest and largest value bound the column
+		auto &in_filter = filter.Cast<InFilter>();
+		UpdateFilterStatistics(input, ExpressionType::COMPARE_GREATERTHANOREQUALTO, in_filter.values.front());
+		UpdateFilterStatistics(input, ExpressionType::COMPARE_LESSTHANOREQUALTO, in_filter.values.back());
+		break;
+	}
 	default:
 		break;
 	}
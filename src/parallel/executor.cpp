@@ -2,6 +2,7 @@
 
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/set/physical_cte.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -148,9 +149,11 @@ void Executor::SchedulePipeline(const shared_ptr<MetaPipeline> &meta_pipeline, S
 	// set up the dependencies within this MetaPipeline
 	for (auto &pipeline : pipelines) {
 		auto source = pipeline->GetSource();
-		if (source->type == PhysicalOperatorType::TABLE_SCAN) {
+		if (source->type == PhysicalOperatorType::TABLE_SCAN &&
+		    !source->Cast<PhysicalTableScan>().dynamic_filters) {
 			// we have to reset the source here (in the main thread), because some of our clients (looking at you, R)
 			// do not like it when threads other than the main thread call into R, for e.g., arrow scans
+			// scans with dynamic filters are reset when they are scheduled: their filters are not known until then
 			pipeline->ResetSource(true);
 		}
 
@@ -355,7 +358,9 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		auto &config = ClientConfig::GetConfig(context);
+		this->producer = scheduler.CreateProducer(config.query_priority, config.query_max_threads);
+		profiler->SetSchedulerStatistics(producer->statistics);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
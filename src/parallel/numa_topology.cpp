@@ -0,0 +1,146 @@
+#include "duckdb/parallel/numa_topology.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
+
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+NumaTopology NumaTopology::Detect(FileSystem &fs) {
+	NumaTopology result;
+#ifdef __linux__
+	static constexpr const char *NODE_DIRECTORY = "/sys/devices/system/node";
+	try {
+		if (!fs.DirectoryExists(NODE_DIRECTORY)) {
+			return result;
+		}
+		vector<idx_t> node_ids;
+		fs.ListFiles(NODE_DIRECTORY, [&](const string &name, bool is_directory) {
+			if (!is_directory || !StringUtil::StartsWith(name, "node") || name.size() == 4) {
+				return;
+			}
+			for (idx_t i = 4; i < name.size(); i++) {
+				if (!StringUtil::CharacterIsDigit(name[i])) {
+					return;
+				}
+			}
+			node_ids.push_back(std::stoull(name.substr(4)));
+		});
+		std::sort(node_ids.begin(), node_ids.end());
+		for (auto &node_id : node_ids) {
+			auto path = StringUtil::Format("%s/node%llu/cpulist", NODE_DIRECTORY, node_id);
+			if (!fs.FileExists(path)) {
+				continue;
+			}
+			char byte_buffer[4096];
+			auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+			auto read_bytes = fs.Read(*handle, (void *)byte_buffer, sizeof(byte_buffer) - 1);
+			byte_buffer[read_bytes] = '\0';
+			NumaNode node;
+			node.id = node_id;
+			node.cpus = RestrictToAllowedCPUs(ParseCPUList(byte_buffer));
+			if (node.cpus.empty()) {
+				// memory-only nodes, or nodes whose CPUs we may not run on, have no CPUs to run threads on
+				continue;
+			}
+			result.nodes.push_back(std::move(node));
+		}
+	} catch (std::exception &ex) {
+		// failed to read the topology - treat the system as a system without NUMA nodes
+		result.nodes.clear();
+	}
+#endif
+	return result;
+}
+
+vector<idx_t> NumaTopology::RestrictToAllowedCPUs(vector<idx_t> cpus) {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	// the process can be restricted to a subset of the CPUs (e.g. by taskset or a cgroup cpuset)
+	cpu_set_t allowed_cpus;
+	CPU_ZERO(&allowed_cpus);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed_cpus) != 0) {
+		return cpus;
+	}
+	vector<idx_t> result;
+	for (auto &cpu : cpus) {
+		if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed_cpus)) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+#else
+	return cpus;
+#endif
+}
+
+vector<idx_t> NumaTopology::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	for (auto &entry : StringUtil::Split(cpu_list, ',')) {
+		StringUtil::Trim(entry);
+		if (entry.empty()) {
+			continue;
+		}
+		auto range = StringUtil::Split(entry, '-');
+		if (range.size() == 1) {
+			result.push_back(std::stoull(range[0]));
+		} else if (range.size() == 2) {
+			auto start = std::stoull(range[0]);
+			auto end = std::stoull(range[1]);
+			for (idx_t cpu = start; cpu <= end; cpu++) {
+				result.push_back(cpu);
+			}
+		}
+	}
+	return result;
+}
+
+bool NumaTopology::PinThread(const NumaNode &node) {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : node.cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+bool NumaTopology::PreferNodeMemory(const NumaNode &node) {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS) && defined(SYS_set_mempolicy)
+	// MPOL_PREFERRED from <linux/mempolicy.h>: allocate on the given node, fall back to other nodes when it is full
+	static constexpr const int PREFERRED_POLICY = 1;
+	static constexpr const idx_t MASK_BITS = sizeof(unsigned long) * 8;
+	if (node.id >= MASK_BITS * 16) {
+		return false;
+	}
+	unsigned long node_mask[16] = {};
+	node_mask[node.id / MASK_BITS] |= 1UL << (node.id % MASK_BITS);
+	return syscall(SYS_set_mempolicy, PREFERRED_POLICY, node_mask, MASK_BITS * 16 + 1) == 0;
+#else
+	return false;
+#endif
+}
+
+idx_t NumaTopology::MinimumCPUsPerNode() const {
+	idx_t result = 0;
+	for (auto &node : nodes) {
+		if (result == 0 || node.cpus.size() < result) {
+			result = node.cpus.size();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
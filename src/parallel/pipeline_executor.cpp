@@ -164,7 +164,27 @@ SinkNextBatchType PipelineExecutor::NextBatch(duckdb::DataChunk &source_chunk) {
 	return SinkNextBatchType::READY;
 }
 
+//! Marks a call to Execute as a task of the operator profiler, also when the execution throws
+struct ProfilerTaskGuard {
+	explicit ProfilerTaskGuard(OperatorProfiler &profiler) : profiler(profiler) {
+		profiler.StartTask();
+	}
+	~ProfilerTaskGuard() {
+		try {
+			profiler.EndTask();
+		} catch (...) { // NOLINT - cannot throw in destructor
+		}
+	}
+
+	OperatorProfiler &profiler;
+};
+
 PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
+	ProfilerTaskGuard task_guard(context.thread.profiler);
+	return ExecuteInternal(max_chunks);
+}
+
+PipelineExecuteResult PipelineExecutor::ExecuteInternal(idx_t max_chunks) {
 	D_ASSERT(pipeline.sink);
 	auto &source_chunk = pipeline.operators.empty() ? final_chunk : *intermediate_chunks[0];
 	for (idx_t i = 0; i < max_chunks; i++) {
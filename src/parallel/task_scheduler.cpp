@@ -4,6 +4,8 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
@@ -30,54 +32,94 @@ struct SchedulerThread {
 #endif
 };
 
+//! A task in the queue, together with the scheduling state of the producer that scheduled it
+struct QueuedTask {
+	shared_ptr<Task> task;
+	shared_ptr<ProducerStatistics> producer;
+};
+
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+typedef duckdb_moodycamel::ConcurrentQueue<QueuedTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	explicit ConcurrentQueue(idx_t queue_count) {
+		for (idx_t i = 0; i < queue_count; i++) {
+			queues.push_back(make_uniq<concurrent_queue_t>());
+		}
+	}
+
+	//! The lock-free task queues, see TaskScheduler::GetQueueIndex
+	vector<unique_ptr<concurrent_queue_t>> queues;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, QueuedTask task);
+	//! Enqueues a task that is no longer associated with the queue of its producer
+	void EnqueueUnowned(idx_t queue_idx, QueuedTask task);
+	bool DequeueFromProducer(ProducerToken &token, QueuedTask &task);
+	//! Dequeues a task of any producer from the given queue, without taking any locks
+	bool TryDequeue(idx_t queue_idx, QueuedTask &task);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t queue_idx)
+	    : queue(*queue.queues[queue_idx]), queue_token(*queue.queues[queue_idx]) {
 	}
 
+	concurrent_queue_t &queue;
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, QueuedTask task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
-	} else {
+	if (!token.token->queue.enqueue(token.token->queue_token, std::move(task))) {
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+void ConcurrentQueue::EnqueueUnowned(idx_t queue_idx, QueuedTask task) {
+	if (!queues[queue_idx]->enqueue(std::move(task))) {
+		throw InternalException("Could not schedule task!");
+	}
+}
+
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, QueuedTask &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	return token.token->queue.try_dequeue_from_producer(token.token->queue_token, task);
+}
+
+bool ConcurrentQueue::TryDequeue(idx_t queue_idx, QueuedTask &task) {
+	return queues[queue_idx]->try_dequeue(task);
 }
 
 #else
 struct ConcurrentQueue {
-	std::queue<shared_ptr<Task>> q;
+	explicit ConcurrentQueue(idx_t queue_count) {
+	}
+
+	std::queue<QueuedTask> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, QueuedTask task);
+	void EnqueueUnowned(idx_t queue_idx, QueuedTask task);
+	bool DequeueFromProducer(ProducerToken &token, QueuedTask &task);
+	bool TryDequeue(idx_t queue_idx, QueuedTask &task);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, QueuedTask task) {
+	EnqueueUnowned(0, std::move(task));
+}
+
+void ConcurrentQueue::EnqueueUnowned(idx_t queue_idx, QueuedTask task) {
 	lock_guard<mutex> lock(qlock);
 	q.push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, QueuedTask &task) {
+	return TryDequeue(0, task);
+}
+
+bool ConcurrentQueue::TryDequeue(idx_t queue_idx, QueuedTask &task) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
 		return false;
@@ -88,22 +130,32 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t queue_idx) {
 	}
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token,
+                             shared_ptr<ProducerStatistics> statistics_p, idx_t numa_node)
+    : scheduler(scheduler), token(std::move(token)), statistics(std::move(statistics_p)), numa_node(numa_node) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.UnregisterProducer(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
-      allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
-      current_thread_count(1) {
+    : db(db), allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
+      current_thread_count(1), virtual_time(0), limited_pending_tasks(0),
+      numa_topology(make_uniq<NumaTopology>(NumaTopology::Detect(FileSystem::GetFileSystem(db)))),
+      numa_node_count(MaxValue<idx_t>(numa_topology->NodeCount(), 1)), threads_pinned(false), next_numa_node(0) {
+	queue = make_uniq<ConcurrentQueue>(GetLimitedQueueIndex() + 1);
+	for (idx_t i = 0; i < PRIORITY_COUNT; i++) {
+		class_virtual_time[i] = 0;
+		producer_virtual_time[i] = 0;
+		pending_tasks[i] = 0;
+		waiting_producers[i] = 0;
+	}
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -120,42 +172,339 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(TaskPriority priority, idx_t max_threads) {
+	idx_t numa_node = 0;
+	if (threads_pinned) {
+		// spread the producers over the NUMA nodes
+		numa_node = next_numa_node++ % numa_topology->NodeCount();
+	}
+	auto queue_idx = max_threads > 0 ? GetLimitedQueueIndex() : GetQueueIndex(numa_node, priority);
+	auto token = make_uniq<QueueProducerToken>(*queue, queue_idx);
+	auto statistics = make_shared<ProducerStatistics>(priority, max_threads);
+	auto producer = make_uniq<ProducerToken>(*this, std::move(token), std::move(statistics), numa_node);
+	RegisterProducer(*producer);
+	return producer;
+}
+
+void TaskScheduler::RegisterProducer(ProducerToken &producer) {
+	lock_guard<mutex> guard(scheduling_lock);
+	producers.push_back(producer);
+}
+
+void TaskScheduler::UnregisterProducer(ProducerToken &producer) {
+	lock_guard<mutex> guard(scheduling_lock);
+	for (idx_t i = 0; i < producers.size(); i++) {
+		if (&producers[i].get() == &producer) {
+			producers.erase(producers.begin() + i);
+			break;
+		}
+	}
+	if (producer.statistics->max_threads == 0) {
+		// the remaining tasks are in the queue of their priority class already
+		return;
+	}
+	// tasks that outlive the producer are no longer limited: move them to the queue of their priority class
+	QueuedTask task;
+	idx_t moved_tasks = 0;
+	while (queue->DequeueFromProducer(producer, task)) {
+		limited_pending_tasks--;
+		queue->EnqueueUnowned(GetQueueIndex(producer.numa_node, task.producer->priority), std::move(task));
+		moved_tasks++;
+	}
+	if (moved_tasks > 0) {
+		Signal(moved_tasks);
+	}
+}
+
+idx_t TaskScheduler::GetQueueIndex(idx_t numa_node, TaskPriority priority) const {
+	D_ASSERT(numa_node < numa_node_count);
+	return numa_node * PRIORITY_COUNT + static_cast<uint8_t>(priority);
+}
+
+idx_t TaskScheduler::GetLimitedQueueIndex() const {
+	return numa_node_count * PRIORITY_COUNT;
+}
+
+idx_t TaskScheduler::GetPriorityWeight(TaskPriority priority) {
+	switch (priority) {
+	case TaskPriority::LOW:
+		return 1;
+	case TaskPriority::NORMAL:
+		return 4;
+	case TaskPriority::HIGH:
+		return 16;
+	default:
+		throw InternalException("Unsupported task priority");
+	}
+}
+
+void TaskScheduler::TaskEnqueued(ProducerStatistics &producer) {
+	if (producer.pending_tasks++ == 0) {
+		waiting_producers[static_cast<uint8_t>(producer.priority)]++;
+	}
+	producer.tasks_scheduled++;
+	pending_tasks[static_cast<uint8_t>(producer.priority)]++;
+	if (producer.max_threads > 0) {
+		limited_pending_tasks++;
+	}
+}
+
+void TaskScheduler::TaskDequeued(ProducerStatistics &producer) {
+	if (--producer.pending_tasks == 0) {
+		waiting_producers[static_cast<uint8_t>(producer.priority)]--;
+	}
+	pending_tasks[static_cast<uint8_t>(producer.priority)]--;
+}
+
+void TaskScheduler::TaskStarted(ProducerStatistics &producer) {
+	auto active_threads = ++producer.active_threads;
+	if (active_threads > producer.peak_threads) {
+		producer.peak_threads = active_threads;
+	}
+}
+
+bool TaskScheduler::HasHigherPriorityTasks(TaskPriority priority) {
+	for (idx_t i = static_cast<uint8_t>(priority) + 1; i < PRIORITY_COUNT; i++) {
+		if (pending_tasks[i] > 0) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
-	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	// the task is counted before it is published, so the counters never drop below zero when it is dequeued right away
+	TaskEnqueued(*token.statistics);
+	queue->Enqueue(token, QueuedTask {std::move(task), token.statistics});
+	// only signal the sleeping threads once the task can be dequeued
+	Signal(1);
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	QueuedTask queued_task;
+	if (!queue->DequeueFromProducer(token, queued_task)) {
+		return false;
+	}
+	TaskDequeued(*queued_task.producer);
+	if (queued_task.producer->max_threads > 0) {
+		limited_pending_tasks--;
+	}
+	task = std::move(queued_task.task);
+	return true;
+}
+
+optional_idx TaskScheduler::SelectPriorityClass() {
+	idx_t waiting_classes = 0;
+	idx_t waiting_class = 0;
+	for (idx_t i = 0; i < PRIORITY_COUNT; i++) {
+		if (pending_tasks[i] > 0) {
+			waiting_classes++;
+			waiting_class = i;
+		}
+	}
+	if (waiting_classes <= 1) {
+		// there is no need to divide the threads between the classes
+		return waiting_classes == 0 ? optional_idx() : optional_idx(waiting_class);
+	}
+	// weighted fair scheduling: every task a class receives advances its virtual time inversely proportional to the
+	// weight of the class, and we pick the class with the lowest virtual time
+	// on ties, the higher class is selected, so a task that yielded its thread does not take it back right away
+	lock_guard<mutex> guard(scheduling_lock);
+	optional_idx next_class;
+	for (idx_t i = PRIORITY_COUNT; i-- > 0;) {
+		if (pending_tasks[i] == 0) {
+			continue;
+		}
+		// classes that were idle for a while should not be able to claim all threads until they have caught up
+		class_virtual_time[i] = MaxValue<idx_t>(class_virtual_time[i], virtual_time);
+		if (!next_class.IsValid() || class_virtual_time[i] < class_virtual_time[next_class.GetIndex()]) {
+			next_class = i;
+		}
+	}
+	if (!next_class.IsValid()) {
+		return next_class;
+	}
+	auto selected = next_class.GetIndex();
+	virtual_time = class_virtual_time[selected];
+	class_virtual_time[selected] += VIRTUAL_TIME_PER_TASK / GetPriorityWeight(static_cast<TaskPriority>(selected));
+	return next_class;
 }
 
-void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
+bool TaskScheduler::DequeueTask(QueuedTask &task, optional_idx numa_node) {
+	auto selected_class = SelectPriorityClass();
+	if (!selected_class.IsValid()) {
+		return false;
+	}
+	// try the selected class first, then the other classes from high to low
+	for (idx_t i = 0; i <= PRIORITY_COUNT; i++) {
+		idx_t class_idx = i == 0 ? selected_class.GetIndex() : PRIORITY_COUNT - i;
+		if ((i > 0 && class_idx == selected_class.GetIndex()) || pending_tasks[class_idx] == 0) {
+			continue;
+		}
+		auto priority = static_cast<TaskPriority>(class_idx);
+		// if several producers of the class are waiting, the lock-free queues do not divide the threads fairly
+		if ((waiting_producers[class_idx] > 1 || limited_pending_tasks > 0) &&
+		    DequeueProducerTask(task, priority, numa_node)) {
+			return true;
+		}
+		// threads that belong to a NUMA node take the tasks of their own node first, but steal work from other nodes
+		idx_t first_node = numa_node.IsValid() ? numa_node.GetIndex() : 0;
+		for (idx_t node_offset = 0; node_offset < numa_node_count; node_offset++) {
+			auto node = (first_node + node_offset) % numa_node_count;
+			if (queue->TryDequeue(GetQueueIndex(node, priority), task)) {
+				TaskDequeued(*task.producer);
+				TaskStarted(*task.producer);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool TaskScheduler::DequeueProducerTask(QueuedTask &task, TaskPriority priority, optional_idx numa_node) {
+	lock_guard<mutex> guard(scheduling_lock);
+	auto class_idx = static_cast<uint8_t>(priority);
+	optional_ptr<ProducerToken> next_producer;
+	for (auto &entry : producers) {
+		auto &candidate = entry.get();
+		auto &statistics = *candidate.statistics;
+		if (statistics.priority != priority || statistics.pending_tasks == 0) {
+			continue;
+		}
+		if (statistics.max_threads > 0 && statistics.active_threads + 1 >= statistics.max_threads) {
+			// the thread that owns the producer counts towards the limit as well
+			continue;
+		}
+		// producers that were idle for a while should not be able to claim all threads until they have caught up
+		statistics.virtual_time = MaxValue<idx_t>(statistics.virtual_time, producer_virtual_time[class_idx]);
+		if (!next_producer) {
+			next_producer = &candidate;
+			continue;
+		}
+		// on ties, the tasks of producers of our own NUMA node are preferred
+		auto &next_statistics = *next_producer->statistics;
+		if (statistics.virtual_time < next_statistics.virtual_time ||
+		    (statistics.virtual_time == next_statistics.virtual_time && numa_node.IsValid() &&
+		     candidate.numa_node == numa_node.GetIndex() && next_producer->numa_node != numa_node.GetIndex())) {
+			next_producer = &candidate;
+		}
+	}
+	if (!next_producer || !queue->DequeueFromProducer(*next_producer, task)) {
+		return false;
+	}
+	// every task a producer receives advances its virtual time, so the producers of a class take turns
+	auto &statistics = *next_producer->statistics;
+	producer_virtual_time[class_idx] = statistics.virtual_time;
+	statistics.virtual_time += VIRTUAL_TIME_PER_TASK / GetPriorityWeight(priority);
+	if (statistics.max_threads > 0) {
+		limited_pending_tasks--;
+	}
+	TaskDequeued(*task.producer);
+	// claim the thread before releasing the lock so concurrent dequeues respect the thread limit
+	TaskStarted(*task.producer);
+	return true;
+}
+
+void TaskScheduler::RescheduleTask(QueuedTask task, optional_idx numa_node) {
+	auto &producer = *task.producer;
+	TaskEnqueued(producer);
+	{
+		// put the task back into the queue of its producer, so it takes its turn with the other tasks of the producer
+		lock_guard<mutex> guard(scheduling_lock);
+		for (auto &entry : producers) {
+			if (entry.get().statistics.get() == &producer) {
+				queue->Enqueue(entry.get(), std::move(task));
+				Signal(1);
+				return;
+			}
+		}
+	}
+	if (producer.max_threads > 0) {
+		// the producer has been destroyed: the task is no longer limited
+		limited_pending_tasks--;
+	}
+	auto node = numa_node.IsValid() ? numa_node.GetIndex() : 0;
+	queue->EnqueueUnowned(GetQueueIndex(node, producer.priority), std::move(task));
+	Signal(1);
+}
+
+bool TaskScheduler::ExecuteTask(QueuedTask &task, optional_idx numa_node) {
+	auto &producer = *task.producer;
+	// tasks are executed in chunks, so they can yield to tasks of higher classes
+	// tasks of the highest class never yield, so they are executed as a whole
+	auto mode = producer.priority == TaskPriority::HIGH ? TaskExecutionMode::PROCESS_ALL
+	                                                     : TaskExecutionMode::PROCESS_PARTIAL;
+	TaskExecutionResult execute_result;
+	do {
+		try {
+			execute_result = task.task->Execute(mode);
+		} catch (...) {
+			producer.active_threads--;
+			throw;
+		}
+		if (execute_result == TaskExecutionResult::TASK_NOT_FINISHED && mode == TaskExecutionMode::PROCESS_ALL) {
+			throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
+		}
+	} while (execute_result == TaskExecutionResult::TASK_NOT_FINISHED && !HasHigherPriorityTasks(producer.priority));
+
+	producer.active_threads--;
+	if (producer.max_threads > 0 && producer.pending_tasks > 0) {
+		// other threads might have skipped the tasks of this producer because of the thread limit
+		Signal(1);
+	}
+	switch (execute_result) {
+	case TaskExecutionResult::TASK_FINISHED:
+	case TaskExecutionResult::TASK_ERROR:
+		producer.tasks_executed++;
+		task.task.reset();
+		return true;
+	case TaskExecutionResult::TASK_NOT_FINISHED:
+		// a task of a higher priority class is waiting: put the task back into the queue
+		producer.tasks_preempted++;
+		RescheduleTask(std::move(task), numa_node);
+		return false;
+	case TaskExecutionResult::TASK_BLOCKED:
+		task.task->Deschedule();
+		task.task.reset();
+		return false;
+	default:
+		throw InternalException("Unsupported task execution result");
+	}
+}
+
+//! The NUMA node the calling thread is pinned to, or INVALID_INDEX if it is not pinned
+static thread_local idx_t thread_numa_node = DConstants::INVALID_INDEX;
+
+optional_idx TaskScheduler::GetThreadNumaNode() {
+	if (thread_numa_node == DConstants::INVALID_INDEX) {
+		return optional_idx();
+	}
+	return thread_numa_node;
+}
+
+idx_t TaskScheduler::NumaNodeCount() const {
+	return numa_node_count;
+}
+
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, optional_idx numa_node) {
 #ifndef DUCKDB_NO_THREADS
-	shared_ptr<Task> task;
+	if (numa_node.IsValid()) {
+		// pin the thread to the CPUs of the node, and place the memory it allocates on that node
+		D_ASSERT(numa_node.GetIndex() < numa_topology->NodeCount());
+		auto &node = numa_topology->nodes[numa_node.GetIndex()];
+		if (NumaTopology::PinThread(node)) {
+			NumaTopology::PreferNodeMemory(node);
+			thread_numa_node = numa_node.GetIndex();
+		}
+	}
+	QueuedTask task;
 	// loop until the marker is set to false
 	while (*marker) {
 		// wait for a signal with a timeout
 		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+		if (DequeueTask(task, numa_node)) {
+			ExecuteTask(task, numa_node);
+			task.producer.reset();
 
 			// Flushes the outstanding allocator's outstanding allocations
 			Allocator::ThreadFlush(allocator_flush_threshold);
@@ -171,24 +520,12 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	idx_t completed_tasks = 0;
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
-		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		QueuedTask task;
+		if (!DequeueTask(task)) {
 			return completed_tasks;
 		}
-		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-		switch (execute_result) {
-		case TaskExecutionResult::TASK_FINISHED:
-		case TaskExecutionResult::TASK_ERROR:
-			task.reset();
+		if (ExecuteTask(task)) {
 			completed_tasks++;
-			break;
-		case TaskExecutionResult::TASK_NOT_FINISHED:
-			throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-		case TaskExecutionResult::TASK_BLOCKED:
-			task->Deschedule();
-			task.reset();
-			break;
 		}
 	}
 	return completed_tasks;
@@ -199,26 +536,15 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
-	shared_ptr<Task> task;
+	QueuedTask task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return;
 		}
 		try {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+			ExecuteTask(task);
+			task.producer.reset();
 		} catch (...) {
 			return;
 		}
@@ -229,8 +555,8 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, optional_idx numa_node) {
+	scheduler->ExecuteForever(marker, numa_node);
 }
 #endif
 
@@ -276,16 +602,33 @@ void TaskScheduler::RelaunchThreads() {
 	RelaunchThreadsInternal(n);
 }
 
+bool TaskScheduler::ShouldPinThreads(idx_t thread_count) {
+	auto &config = DBConfig::GetConfig(db);
+	if (config.options.pin_threads == ThreadPinMode::OFF || thread_count == 0) {
+		return false;
+	}
+	if (numa_topology->NodeCount() == 0) {
+		return false;
+	}
+	if (config.options.pin_threads == ThreadPinMode::ON) {
+		return true;
+	}
+	// AUTO: only pin if the threads do not fit on a single node
+	auto total_threads = thread_count + config.options.external_threads;
+	return numa_topology->NodeCount() > 1 && total_threads > numa_topology->MinimumCPUsPerNode();
+}
+
 void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	idx_t new_thread_count = n;
-	if (threads.size() == new_thread_count) {
+	auto pin_threads = ShouldPinThreads(new_thread_count);
+	if (threads.size() == new_thread_count && pin_threads == threads_pinned) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (threads.size() > new_thread_count || pin_threads != threads_pinned) {
+		// we are reducing the number of threads or changing how they are pinned: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -298,15 +641,21 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		threads.clear();
 		markers.clear();
 	}
+	threads_pinned = pin_threads;
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			// pinned threads are distributed over the NUMA nodes round-robin
+			optional_idx numa_node;
+			if (pin_threads) {
+				numa_node = threads.size() % numa_topology->NodeCount();
+			}
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), numa_node);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
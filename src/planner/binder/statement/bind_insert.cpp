@@ -405,6 +405,10 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 	if (!table.temporary) {
 		// inserting into a non-temporary table: alters underlying database
 		properties.modified_databases.insert(table.catalog.GetName());
+		if (!stmt.on_conflict_info || stmt.on_conflict_info->action_type == OnConflictAction::NOTHING) {
+			// the rows are only appended: existing rows are not updated in place
+			properties.appended_databases.insert(table.catalog.GetName());
+		}
 	}
 
 	auto insert = make_uniq<LogicalInsert>(table, GenerateTableIndex());
@@ -0,0 +1,107 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(vector<uint64_t> blocks_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), blocks(std::move(blocks_p)), probe_count(0), pass_count(0) {
+	D_ASSERT(IsPowerOfTwo(blocks.size()));
+}
+
+unique_ptr<BloomFilter> BloomFilter::Create(idx_t expected_cardinality) {
+	auto block_count = NextPowerOfTwo(MaxValue<idx_t>(expected_cardinality, 1) * BITS_PER_VALUE / 64);
+	block_count = MinValue<idx_t>(MaxValue<idx_t>(block_count, MINIMUM_BLOCK_COUNT), MAXIMUM_BLOCK_COUNT);
+	return make_uniq<BloomFilter>(vector<uint64_t>(block_count, 0));
+}
+
+void BloomFilter::Insert(Vector &input, idx_t count) {
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, count);
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			// NULL values never match, we don't need to insert them
+			continue;
+		}
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		blocks[BlockIndex(hash)] |= BlockMask(hash);
+	}
+}
+
+void BloomFilter::Merge(const BloomFilter &other) {
+	D_ASSERT(blocks.size() == other.blocks.size());
+	for (idx_t i = 0; i < blocks.size(); i++) {
+		blocks[i] |= other.blocks[i];
+	}
+}
+
+bool BloomFilter::IsSelective(idx_t count) const {
+	return blocks.size() * 64 >= count * MINIMUM_BITS_PER_VALUE;
+}
+
+idx_t BloomFilter::Filter(Vector &input, SelectionVector &sel, idx_t &approved_tuple_count, idx_t scan_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	if (probe_count >= ADAPTIVE_SAMPLE_COUNT && pass_count * 20 >= probe_count * 19) {
+		// more than 95% of the probed rows pass the filter: it is not worth probing
+		return approved_tuple_count;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, scan_count);
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(scan_count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(scan_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			continue;
+		}
+		if (Lookup(hash_data[hdata.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	probe_count += approved_tuple_count;
+	pass_count += result_count;
+
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(blocks.size() * 64) + " bits)";
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(blocks);
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.blocks == blocks;
+}
+
+} // namespace duckdb
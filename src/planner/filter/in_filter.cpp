@@ -0,0 +1,187 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	D_ASSERT(!values.empty());
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+#ifdef DEBUG
+	for (auto &value : values) {
+		D_ASSERT(!value.IsNull());
+		D_ASSERT(value.type() == values[0].type());
+	}
+#endif
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	case LogicalTypeId::VARCHAR:
+		return StringType::GetCollation(type).empty();
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static idx_t TemplatedInFilter(UnifiedVectorFormat &vdata, const vector<Value> &values, SelectionVector &sel,
+                               idx_t &approved_tuple_count) {
+	// the values are sorted, so we can binary search them
+	vector<T> in_values;
+	in_values.reserve(values.size());
+	for (auto &value : values) {
+		in_values.push_back(value.GetValueUnsafe<T>());
+	}
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (!vdata.validity.RowIsValid(vector_idx)) {
+			continue;
+		}
+		auto entry = std::lower_bound(in_values.begin(), in_values.end(), data[vector_idx],
+		                              [](const T &a, const T &b) { return LessThan::Operation(a, b); });
+		if (entry != in_values.end() && Equals::Operation<T>(*entry, data[vector_idx])) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+idx_t InFilter::Filter(UnifiedVectorFormat &vdata, const LogicalType &type, SelectionVector &sel,
+                       idx_t &approved_tuple_count) const {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedInFilter<bool>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::UINT8:
+		return TemplatedInFilter<uint8_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::UINT16:
+		return TemplatedInFilter<uint16_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::UINT32:
+		return TemplatedInFilter<uint32_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::UINT64:
+		return TemplatedInFilter<uint64_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::UINT128:
+		return TemplatedInFilter<uhugeint_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::INT8:
+		return TemplatedInFilter<int8_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::INT16:
+		return TemplatedInFilter<int16_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::INT32:
+		return TemplatedInFilter<int32_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::INT64:
+		return TemplatedInFilter<int64_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::INT128:
+		return TemplatedInFilter<hugeint_t>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::FLOAT:
+		return TemplatedInFilter<float>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::DOUBLE:
+		return TemplatedInFilter<double>(vdata, values, sel, approved_tuple_count);
+	case PhysicalType::VARCHAR:
+		return TemplatedInFilter<string_t>(vdata, values, sel, approved_tuple_count);
+	default:
+		throw InvalidTypeException(type, "Invalid type for IN filter pushed down to table scan");
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE: {
+		if (!NumericStats::HasMinMax(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		// the values are sorted: find the smallest value that is >= min, and check if it is <= max
+		auto min = NumericStats::Min(stats);
+		auto max = NumericStats::Max(stats);
+		auto entry = std::lower_bound(values.begin(), values.end(), min);
+		if (entry == values.end() || *entry > max) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		if (min == max && !stats.CanHaveNull()) {
+			// the only value in the segment is in the set
+			return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case PhysicalType::VARCHAR:
+		// check the values against the min/max prefix of the strings
+		for (auto &value : values) {
+			auto prune_result =
+			    StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &value : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += value.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+} // namespace duckdb
@@ -21,6 +21,10 @@ string StructFilter::ToString(const string &column_name) {
 	return child_filter->ToString(column_name + "." + child_name);
 }
 
+unique_ptr<TableFilter> StructFilter::Copy() const {
+	return make_uniq<StructFilter>(child_idx, child_name, child_filter->Copy());
+}
+
 bool StructFilter::Equals(const TableFilter &other_p) const {
 	if (!TableFilter::Equals(other_p)) {
 		return false;
@@ -66,9 +66,25 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	return false;
 }
 
+//! The operator that the calling thread is executing, set by the profiler. The buffer pool is shared by all threads
+//! and has no notion of operators, so the attribution is per thread.
+static thread_local OperatorMemoryInformation *operator_memory_information = nullptr;
+
+void BufferPool::SetOperatorMemoryInformation(optional_ptr<OperatorMemoryInformation> information) {
+	operator_memory_information = information.get();
+}
+
+optional_ptr<OperatorMemoryInformation> BufferPool::GetOperatorMemoryInformation() {
+	return operator_memory_information;
+}
+
 void BufferPool::IncreaseUsedMemory(MemoryTag tag, idx_t size) {
 	current_memory += size;
 	memory_usage_per_tag[uint8_t(tag)] += size;
+	if (operator_memory_information) {
+		// negative sizes are passed as wrapped-around unsigned values
+		operator_memory_information->AddMemory(tag, static_cast<int64_t>(size));
+	}
 }
 
 idx_t BufferPool::GetUsedMemory() const {
@@ -87,6 +103,23 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+//! Unloaded blocks were not reserved by the operator that is executing on this thread: their memory is not released
+//! by that operator, only the data they spill is attributed to it
+struct OperatorEvictionGuard {
+	OperatorEvictionGuard() : information(operator_memory_information) {
+		if (information) {
+			information->evicting = true;
+		}
+	}
+	~OperatorEvictionGuard() {
+		if (information) {
+			information->evicting = false;
+		}
+	}
+
+	OperatorMemoryInformation *information;
+};
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
 	BufferEvictionNode node;
@@ -120,6 +153,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		}
 
 		// hooray, we can unload the block
+		OperatorEvictionGuard eviction_guard;
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
@@ -364,7 +364,7 @@ public:
 	explicit BitpackingCompressState(ColumnDataCheckpointer &checkpointer)
 	    : checkpointer(checkpointer),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_BITPACKING)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		state.data_ptr = reinterpret_cast<void *>(this);
 
@@ -7,6 +7,7 @@
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 
 namespace duckdb {
@@ -104,6 +105,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -133,7 +136,7 @@ struct DictionaryCompressionCompressState : public DictionaryCompressionState {
 	    : checkpointer(checkpointer_p),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_DICTIONARY)),
 	      heap(BufferAllocator::Get(checkpointer.GetDatabase())) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 	}
 
 	ColumnDataCheckpointer &checkpointer;
@@ -432,6 +435,11 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The number of entries in the dictionary
+	idx_t dictionary_size = 0;
+	//! The filter that has been evaluated against the dictionary, and for every dictionary entry whether it passed
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> filter_result;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -451,6 +459,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -540,6 +549,53 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	StringScan(segment, state, scan_count, result);
+	if (result.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		// we did not emit a dictionary vector: evaluate the filter for every row
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(scan_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, approved_tuple_count);
+		return;
+	}
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	if (scan_state.filter.get() != &filter) {
+		// evaluate the filter once for every entry in the dictionary of this segment
+		scan_state.filter_result = make_unsafe_uniq_array<bool>(scan_state.dictionary_size);
+		memset(scan_state.filter_result.get(), 0, scan_state.dictionary_size * sizeof(bool));
+		for (idx_t offset = 0; offset < scan_state.dictionary_size; offset += STANDARD_VECTOR_SIZE) {
+			auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, scan_state.dictionary_size - offset);
+			Vector dictionary_slice(*scan_state.dictionary, offset, offset + count);
+			UnifiedVectorFormat vdata;
+			dictionary_slice.ToUnifiedFormat(count, vdata);
+			SelectionVector dictionary_sel;
+			idx_t dictionary_count = count;
+			ColumnSegment::FilterSelection(dictionary_sel, dictionary_slice, vdata, filter, count, dictionary_count);
+			for (idx_t i = 0; i < dictionary_count; i++) {
+				scan_state.filter_result[offset + dictionary_sel.get_index(i)] = true;
+			}
+		}
+		scan_state.filter = &filter;
+	}
+	// now look up the result of every row in the dictionary
+	auto &dictionary_sel = DictionaryVector::SelVector(result);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (scan_state.filter_result[dictionary_sel.get_index(idx)]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -636,13 +692,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
@@ -56,7 +56,7 @@ struct UncompressedCompressState : public CompressionState {
 
 UncompressedCompressState::UncompressedCompressState(ColumnDataCheckpointer &checkpointer)
     : checkpointer(checkpointer) {
-	UncompressedCompressState::CreateEmptySegment(checkpointer.GetRowGroup().start);
+	UncompressedCompressState::CreateEmptySegment(checkpointer.GetRowStart());
 }
 
 void UncompressedCompressState::CreateEmptySegment(idx_t row_start) {
@@ -201,7 +201,7 @@ class FSSTCompressionState : public CompressionState {
 public:
 	explicit FSSTCompressionState(ColumnDataCheckpointer &checkpointer)
 	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_FSST)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 	}
 
 	~FSSTCompressionState() override {
@@ -138,7 +138,7 @@ struct RLECompressState : public CompressionState {
 	explicit RLECompressState(ColumnDataCheckpointer &checkpointer_p)
 	    : checkpointer(checkpointer_p),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_RLE)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		state.dataptr = (void *)this;
 		max_rle_count = MaxRLECount();
@@ -0,0 +1,578 @@
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/checkpoint/write_overflow_strings_to_disk.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, followed by a sequence of zstd frames.
+// Every frame holds a number of consecutive strings: when decompressed, it contains the string lengths (uint32_t)
+// followed by the concatenated string data. NULL values are stored as empty strings.
+// A string that does not fit in a frame by itself gets an overflow frame: its compressed data is written to the
+// overflow blocks of the segment (as for uncompressed strings), and the frame only holds its location.
+typedef struct {
+	uint32_t frame_count;
+} zstd_compression_header_t;
+
+typedef struct {
+	uint32_t row_count;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_header_t;
+
+struct ZSTDStorage {
+	//! The maximum uncompressed size of a frame - the compressed frame must always fit in an empty block
+	static constexpr idx_t FRAME_SIZE_LIMIT = Storage::BLOCK_SIZE / 4;
+	//! The compression level used to compress the frames
+	static constexpr int COMPRESSION_LEVEL = ZSTD_CLEVEL_DEFAULT;
+	//! zstd is only chosen if it beats the other methods by this margin, as decompression is more expensive
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.5;
+	//! For short strings the lightweight methods (dictionary, FSST) are preferred, unless zstd is forced
+	static constexpr idx_t MINIMUM_AVERAGE_STRING_LENGTH = 32;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	//! The maximum amount of uncompressed data that is sampled to estimate the compression ratio
+	static constexpr idx_t ANALYSIS_SAMPLE_LIMIT = 16 * FRAME_SIZE_LIMIT;
+	//! Stored as the uncompressed size of an overflow frame, whose data consists of the location of the compressed
+	//! string in the overflow blocks, followed by the uncompressed size of the string
+	static constexpr uint32_t OVERFLOW_FRAME_MARKER = NumericLimits<uint32_t>::Maximum();
+	static constexpr idx_t OVERFLOW_FRAME_SIZE = UncompressedStringStorage::BIG_STRING_MARKER_SIZE + sizeof(uint32_t);
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	static idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, const_data_ptr_t data, idx_t size, vector<data_t> &result);
+	static idx_t CompressFrame(duckdb_zstd::ZSTD_CCtx *context, const vector<uint32_t> &lengths,
+	                           const vector<data_t> &data, vector<data_t> &frame_buffer, vector<data_t> &result);
+	static void Decompress(duckdb_zstd::ZSTD_DCtx *context, const_data_ptr_t data, idx_t size, data_ptr_t result,
+	                       idx_t result_size);
+	static void DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t frame_ptr, data_ptr_t result);
+};
+
+//===--------------------------------------------------------------------===//
+// Frame Helpers
+//===--------------------------------------------------------------------===//
+//! Holds the strings of a frame that has not been compressed yet
+struct ZSTDFrameBuilder {
+	vector<uint32_t> lengths;
+	vector<data_t> data;
+
+	idx_t UncompressedSize() const {
+		return lengths.size() * sizeof(uint32_t) + data.size();
+	}
+	bool HasSpace(idx_t string_size) const {
+		return UncompressedSize() + sizeof(uint32_t) + string_size <= ZSTDStorage::FRAME_SIZE_LIMIT;
+	}
+	void Append(const string_t &str) {
+		auto size = str.GetSize();
+		lengths.push_back(UnsafeNumericCast<uint32_t>(size));
+		auto ptr = const_data_ptr_cast(str.GetData());
+		data.insert(data.end(), ptr, ptr + size);
+	}
+	void Reset() {
+		lengths.clear();
+		data.clear();
+	}
+};
+
+idx_t ZSTDStorage::Compress(duckdb_zstd::ZSTD_CCtx *context, const_data_ptr_t data, idx_t size,
+                            vector<data_t> &result) {
+	result.resize(duckdb_zstd::ZSTD_compressBound(size));
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compressCCtx(context, result.data(), result.size(), data, size, COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		throw InternalException("ZSTD string compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+	}
+	return compressed_size;
+}
+
+idx_t ZSTDStorage::CompressFrame(duckdb_zstd::ZSTD_CCtx *context, const vector<uint32_t> &lengths,
+                                 const vector<data_t> &data, vector<data_t> &frame_buffer, vector<data_t> &result) {
+	// lay out the lengths and the string data in a single buffer
+	auto lengths_size = lengths.size() * sizeof(uint32_t);
+	frame_buffer.resize(lengths_size + data.size());
+	for (idx_t i = 0; i < lengths.size(); i++) {
+		Store<uint32_t>(lengths[i], frame_buffer.data() + i * sizeof(uint32_t));
+	}
+	if (!data.empty()) {
+		memcpy(frame_buffer.data() + lengths_size, data.data(), data.size());
+	}
+	return Compress(context, frame_buffer.data(), frame_buffer.size(), result);
+}
+
+void ZSTDStorage::Decompress(duckdb_zstd::ZSTD_DCtx *context, const_data_ptr_t data, idx_t size, data_ptr_t result,
+                             idx_t result_size) {
+	auto decompressed_size = duckdb_zstd::ZSTD_decompressDCtx(context, result, result_size, data, size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != result_size) {
+		throw IOException("Failed to decompress ZSTD compressed string segment - the database file may be corrupt");
+	}
+}
+
+void ZSTDStorage::DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t frame_ptr, data_ptr_t result) {
+	auto header = reinterpret_cast<zstd_frame_header_t *>(frame_ptr);
+	auto compressed_size = Load<uint32_t>(data_ptr_cast(&header->compressed_size));
+	auto uncompressed_size = Load<uint32_t>(data_ptr_cast(&header->uncompressed_size));
+	Decompress(context, frame_ptr + sizeof(zstd_frame_header_t), compressed_size, result, uncompressed_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState() : context(duckdb_zstd::ZSTD_createCCtx()) {
+	}
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	RandomEngine random_engine;
+	bool sample_full = false;
+
+	//! The uncompressed size of all strings (including their lengths)
+	idx_t total_size = 0;
+	//! The amount of (non-NULL) strings and their total size
+	idx_t string_count = 0;
+	idx_t string_size = 0;
+	//! The sampled strings and their uncompressed size - they are only compressed in the final analysis, so no time
+	//! is spent on compression if the strings turn out to be too short for zstd
+	vector<ZSTDFrameBuilder> sample;
+	idx_t sample_size = 0;
+
+	//! Adds a string to the sample, returns false if the sample is full
+	bool AddToSample(const string_t &str) {
+		// strings that do not fit in a frame are sampled by their prefix
+		auto size = MinValue<idx_t>(str.GetSize(), ZSTDStorage::FRAME_SIZE_LIMIT - sizeof(uint32_t));
+		if (sample_size + sizeof(uint32_t) + size > ZSTDStorage::ANALYSIS_SAMPLE_LIMIT) {
+			return false;
+		}
+		if (sample.empty() || !sample.back().HasSpace(size)) {
+			sample.emplace_back();
+		}
+		sample.back().Append(string_t(str.GetData(), UnsafeNumericCast<uint32_t>(size)));
+		sample_size += sizeof(uint32_t) + size;
+		return true;
+	}
+
+	//! Compresses the sampled frames, and returns their total compressed size (including the frame headers)
+	idx_t CompressSample() {
+		vector<data_t> frame_buffer;
+		vector<data_t> compressed_buffer;
+		idx_t compressed_size = 0;
+		for (auto &frame : sample) {
+			compressed_size += sizeof(zstd_frame_header_t);
+			compressed_size +=
+			    ZSTDStorage::CompressFrame(context, frame.lengths, frame.data, frame_buffer, compressed_buffer);
+		}
+		return compressed_size;
+	}
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<ZSTDAnalyzeState>();
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// always sample the first vector, so we never end up without a sample
+	bool sample_selected =
+	    !state.sample_full && (state.sample.empty() || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		auto str = vdata.validity.RowIsValid(idx) ? data[idx] : string_t(nullptr, 0);
+		state.total_size += str.GetSize() + sizeof(uint32_t);
+		if (vdata.validity.RowIsValid(idx)) {
+			state.string_count++;
+			state.string_size += str.GetSize();
+		}
+		if (sample_selected && !state.AddToSample(str)) {
+			state.sample_full = true;
+			sample_selected = false;
+		}
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.sample.empty()) {
+		return DConstants::INVALID_INDEX;
+	}
+	// the strings are too short for zstd to be worth it: don't credit it with any compression
+	double compression_ratio = 1;
+	if (state.string_count > 0 && state.string_size / state.string_count >= MINIMUM_AVERAGE_STRING_LENGTH) {
+		// extrapolate the compression ratio of the sample to all strings
+		compression_ratio = double(state.CompressSample()) / double(state.sample_size);
+	}
+	auto estimated_size = double(state.total_size) * compression_ratio;
+	auto num_blocks = estimated_size / double(Storage::BLOCK_SIZE - sizeof(zstd_compression_header_t));
+	estimated_size += num_blocks * double(sizeof(zstd_compression_header_t));
+	return idx_t(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	explicit ZSTDCompressionState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      context(duckdb_zstd::ZSTD_createCCtx()),
+	      frame_stats(StringStats::CreateEmpty(checkpointer.GetType())) {
+		CreateEmptySegment(checkpointer.GetRowStart());
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+		auto &state = current_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
+		state.overflow_writer = make_uniq<WriteOverflowStringsToDisk>(checkpointer.GetRowGroup().GetBlockManager());
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		segment_size = sizeof(zstd_compression_header_t);
+		frame_count = 0;
+	}
+
+	void AddString(const string_t &str) {
+		if (str.GetSize() + sizeof(uint32_t) > ZSTDStorage::FRAME_SIZE_LIMIT) {
+			// the string does not fit in a frame by itself
+			FlushFrame();
+			WriteOverflowFrame(str);
+			return;
+		}
+		if (!frame.HasSpace(str.GetSize())) {
+			FlushFrame();
+		}
+		frame.Append(str);
+		StringStats::Update(frame_stats, str);
+	}
+
+	void AddNull() {
+		if (!frame.HasSpace(0)) {
+			FlushFrame();
+		}
+		frame.Append(string_t(nullptr, 0));
+	}
+
+	void FlushFrame() {
+		if (frame.lengths.empty()) {
+			return;
+		}
+		auto compressed_size =
+		    ZSTDStorage::CompressFrame(context, frame.lengths, frame.data, frame_buffer, compressed_buffer);
+		auto required_space = sizeof(zstd_frame_header_t) + compressed_size;
+		if (segment_size + required_space > Storage::BLOCK_SIZE) {
+			// the frame does not fit in this segment anymore: start a new one
+			FlushSegment();
+			if (segment_size + required_space > Storage::BLOCK_SIZE) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+
+		auto frame_data = AppendFrame(frame.lengths.size(), compressed_size, frame.UncompressedSize());
+		memcpy(frame_data, compressed_buffer.data(), compressed_size);
+		StringStats::Merge(current_segment->stats.statistics, frame_stats);
+
+		frame.Reset();
+		frame_stats = StringStats::CreateEmpty(checkpointer.GetType());
+	}
+
+	void WriteOverflowFrame(const string_t &str) {
+		auto compressed_size =
+		    ZSTDStorage::Compress(context, const_data_ptr_cast(str.GetData()), str.GetSize(), compressed_buffer);
+		if (segment_size + sizeof(zstd_frame_header_t) + ZSTDStorage::OVERFLOW_FRAME_SIZE > Storage::BLOCK_SIZE) {
+			FlushSegment();
+		}
+
+		// write the compressed string to the overflow blocks, and its location to the frame
+		auto &state = current_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
+		block_id_t block;
+		int32_t offset;
+		string_t compressed(char_ptr_cast(compressed_buffer.data()), NumericCast<uint32_t>(compressed_size));
+		state.overflow_writer->WriteString(state, compressed, block, offset);
+
+		auto frame_data = AppendFrame(1, ZSTDStorage::OVERFLOW_FRAME_SIZE, ZSTDStorage::OVERFLOW_FRAME_MARKER);
+		UncompressedStringStorage::WriteStringMarker(frame_data, block, offset);
+		Store<uint32_t>(NumericCast<uint32_t>(str.GetSize()),
+		                frame_data + UncompressedStringStorage::BIG_STRING_MARKER_SIZE);
+		StringStats::Update(current_segment->stats.statistics, str);
+	}
+
+	//! Writes the header of a frame to the current segment, and returns where its data has to be written
+	data_ptr_t AppendFrame(idx_t row_count, idx_t compressed_size, idx_t uncompressed_size) {
+		auto frame_ptr = current_handle.Ptr() + segment_size;
+		auto header = reinterpret_cast<zstd_frame_header_t *>(frame_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(row_count), data_ptr_cast(&header->row_count));
+		Store<uint32_t>(NumericCast<uint32_t>(compressed_size), data_ptr_cast(&header->compressed_size));
+		Store<uint32_t>(NumericCast<uint32_t>(uncompressed_size), data_ptr_cast(&header->uncompressed_size));
+
+		segment_size += sizeof(zstd_frame_header_t) + compressed_size;
+		frame_count++;
+		current_segment->count += row_count;
+		return frame_ptr + sizeof(zstd_frame_header_t);
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		auto header = reinterpret_cast<zstd_compression_header_t *>(current_handle.Ptr());
+		Store<uint32_t>(NumericCast<uint32_t>(frame_count), data_ptr_cast(&header->frame_count));
+		current_handle.Destroy();
+
+		auto &segment_state = current_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
+		segment_state.overflow_writer->Flush();
+		segment_state.overflow_writer.reset();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment(true);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	duckdb_zstd::ZSTD_CCtx *context;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	idx_t segment_size;
+	idx_t frame_count;
+
+	// State regarding the current (not yet compressed) frame
+	ZSTDFrameBuilder frame;
+	BaseStatistics frame_stats;
+	vector<data_t> frame_buffer;
+	vector<data_t> compressed_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.AddNull();
+		} else {
+			state.AddString(data[idx]);
+		}
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public SegmentScanState {
+	explicit ZSTDScanState(ColumnSegment &segment) : segment(segment), context(duckdb_zstd::ZSTD_createDCtx()) {
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	ColumnSegment &segment;
+	BufferHandle handle;
+	duckdb_zstd::ZSTD_DCtx *context;
+	data_ptr_t base_ptr;
+	idx_t frame_count;
+
+	//! The frame the scan is currently positioned at
+	idx_t frame_idx;
+	idx_t frame_offset;
+	idx_t frame_start_row;
+	idx_t frame_row_count;
+
+	//! The decompressed data of the current frame (if any), and the offsets of the strings within it
+	buffer_ptr<VectorBuffer> frame_data;
+	vector<uint32_t> string_offsets;
+
+	void Reset() {
+		frame_idx = 0;
+		frame_offset = sizeof(zstd_compression_header_t);
+		frame_start_row = 0;
+		frame_row_count = ReadFrameRowCount();
+		frame_data.reset();
+	}
+
+	idx_t ReadFrameRowCount() {
+		if (frame_idx >= frame_count) {
+			return 0;
+		}
+		auto header = reinterpret_cast<zstd_frame_header_t *>(base_ptr + frame_offset);
+		return Load<uint32_t>(data_ptr_cast(&header->row_count));
+	}
+
+	//! Moves the scan to the frame that contains the given row, and makes sure it is decompressed
+	void SeekToRow(idx_t row) {
+		if (row < frame_start_row) {
+			Reset();
+		}
+		while (row >= frame_start_row + frame_row_count) {
+			D_ASSERT(frame_idx < frame_count);
+			auto header = reinterpret_cast<zstd_frame_header_t *>(base_ptr + frame_offset);
+			frame_offset += sizeof(zstd_frame_header_t) + Load<uint32_t>(data_ptr_cast(&header->compressed_size));
+			frame_start_row += frame_row_count;
+			frame_idx++;
+			frame_row_count = ReadFrameRowCount();
+			frame_data.reset();
+		}
+		if (frame_data) {
+			return;
+		}
+		auto frame_ptr = base_ptr + frame_offset;
+		auto header = reinterpret_cast<zstd_frame_header_t *>(frame_ptr);
+		auto uncompressed_size = Load<uint32_t>(data_ptr_cast(&header->uncompressed_size));
+		if (uncompressed_size == ZSTDStorage::OVERFLOW_FRAME_MARKER) {
+			ReadOverflowFrame(frame_ptr + sizeof(zstd_frame_header_t));
+		} else {
+			frame_data = make_buffer<VectorBuffer>(uncompressed_size);
+			ZSTDStorage::DecompressFrame(context, frame_ptr, frame_data->GetData());
+		}
+
+		// compute the offsets of the strings in the frame from their lengths
+		auto lengths = frame_data->GetData();
+		string_offsets.resize(frame_row_count);
+		uint32_t offset = UnsafeNumericCast<uint32_t>(frame_row_count * sizeof(uint32_t));
+		for (idx_t i = 0; i < frame_row_count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(lengths + i * sizeof(uint32_t));
+		}
+	}
+
+	//! Decompresses the string of an overflow frame into the same layout as a regular decompressed frame
+	void ReadOverflowFrame(data_ptr_t overflow_frame_ptr) {
+		block_id_t block;
+		int32_t offset;
+		UncompressedStringStorage::ReadStringMarker(overflow_frame_ptr, block, offset);
+		auto string_size = Load<uint32_t>(overflow_frame_ptr + UncompressedStringStorage::BIG_STRING_MARKER_SIZE);
+
+		// the vector keeps the compressed string alive until it has been decompressed
+		Vector compressed_vector(LogicalType::BLOB, nullptr);
+		auto compressed = UncompressedStringStorage::ReadOverflowString(segment, compressed_vector, block, offset);
+		frame_data = make_buffer<VectorBuffer>(sizeof(uint32_t) + string_size);
+		Store<uint32_t>(string_size, frame_data->GetData());
+		ZSTDStorage::Decompress(context, const_data_ptr_cast(compressed.GetData()), compressed.GetSize(),
+		                        frame_data->GetData() + sizeof(uint32_t), string_size);
+	}
+
+	string_t GetString(idx_t row) {
+		D_ASSERT(row >= frame_start_row && row < frame_start_row + frame_row_count);
+		auto frame_row = row - frame_start_row;
+		auto lengths = frame_data->GetData();
+		auto length = Load<uint32_t>(lengths + frame_row * sizeof(uint32_t));
+		return string_t(char_ptr_cast(frame_data->GetData() + string_offsets[frame_row]), length);
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>(segment);
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	state->base_ptr = state->handle.Ptr() + segment.GetBlockOffset();
+	auto header = reinterpret_cast<zstd_compression_header_t *>(state->base_ptr);
+	state->frame_count = Load<uint32_t>(data_ptr_cast(&header->frame_count));
+	state->Reset();
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		scan_state.SeekToRow(start + scanned);
+		// the strings point directly into the decompressed frame
+		StringVector::AddBuffer(result, scan_state.frame_data);
+		auto frame_end = scan_state.frame_start_row + scan_state.frame_row_count;
+		auto scan_end = MinValue<idx_t>(start + scan_count, frame_end);
+		for (idx_t row = start + scanned; row < scan_end; row++) {
+			result_data[result_offset + row - start] = scan_state.GetString(row);
+		}
+		scanned = scan_end - start;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto scan_state = StringInitScan(segment);
+	auto &zstd_state = scan_state->Cast<ZSTDScanState>();
+	zstd_state.SeekToRow(UnsafeNumericCast<idx_t>(row_id));
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto str = zstd_state.GetString(UnsafeNumericCast<idx_t>(row_id));
+	result_data[result_idx] = StringVector::AddStringOrBlob(result, str);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip,
+	    UncompressedStringStorage::StringInitSegment, nullptr, nullptr, nullptr, nullptr,
+	    UncompressedStringStorage::SerializeState, UncompressedStringStorage::DeserializeState,
+	    UncompressedStringStorage::CleanupState);
+}
+
+bool ZSTDFun::TypeIsSupported(PhysicalType type) {
+	return type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
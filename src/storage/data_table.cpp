@@ -18,6 +18,7 @@
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/table/standard_column_data.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
@@ -30,8 +31,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), schema(std::move(schema)),
-      table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), data_version(0),
+      schema(std::move(schema)), table(std::move(table)) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context) {
@@ -206,6 +207,7 @@ void DataTable::InitializeScan(TableScanState &state, const vector<column_t> &co
 
 void DataTable::InitializeScan(DuckTransaction &transaction, TableScanState &state, const vector<column_t> &column_ids,
                                TableFilterSet *table_filters) {
+	state.checkpoint_lock = transaction.SharedLockTable(*info);
 	InitializeScan(state, column_ids, table_filters);
 	auto &local_storage = LocalStorage::Get(transaction);
 	local_storage.InitializeScan(*this, state.local_state, table_filters);
@@ -227,6 +229,8 @@ idx_t DataTable::MaxThreads(ClientContext &context) {
 }
 
 void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScanState &state) {
+	auto &transaction = DuckTransaction::Get(context, db);
+	state.checkpoint_lock = transaction.SharedLockTable(*info);
 	row_groups->InitializeParallelScan(state.scan_state);
 
 	auto &local_storage = LocalStorage::Get(context, db);
@@ -271,6 +275,7 @@ bool DataTable::IndexNameIsUnique(const string &name) {
 //===--------------------------------------------------------------------===//
 void DataTable::Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
                       const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+	auto lock = transaction.SharedLockTable(*info);
 	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state);
 }
 
@@ -757,6 +762,7 @@ void DataTable::InitializeAppend(DuckTransaction &transaction, TableAppendState
 void DataTable::Append(DataChunk &chunk, TableAppendState &state) {
 	D_ASSERT(is_root);
 	row_groups->Append(chunk, state);
+	info->data_version++;
 }
 
 void DataTable::FinalizeAppend(DuckTransaction &transaction, TableAppendState &state) {
@@ -820,6 +826,7 @@ void DataTable::ScanTableSegment(idx_t row_start, idx_t count, const std::functi
 void DataTable::MergeStorage(RowGroupCollection &data, TableIndexList &indexes) {
 	row_groups->MergeStorage(data);
 	row_groups->Verify();
+	info->data_version++;
 }
 
 void DataTable::WriteToLog(WriteAheadLog &log, idx_t row_start, idx_t count) {
@@ -1190,6 +1197,7 @@ void DataTable::Update(TableCatalogEntry &table, ClientContext &context, Vector
 
 		row_groups->Update(DuckTransaction::Get(context, db), FlatVector::GetData<row_t>(row_ids_slice), column_ids,
 		                   updates_slice);
+		info->data_version++;
 	}
 }
 
@@ -1212,6 +1220,7 @@ void DataTable::UpdateColumn(TableCatalogEntry &table, ClientContext &context, V
 	updates.Flatten();
 	row_ids.Flatten(updates.size());
 	row_groups->UpdateColumn(transaction, row_ids, column_path, updates);
+	info->data_version++;
 }
 
 //===--------------------------------------------------------------------===//
@@ -1233,6 +1242,11 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 // Checkpoint
 //===--------------------------------------------------------------------===//
 void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
+	// transactions can scan the table during a background checkpoint: wait for them before rewriting it
+	unique_ptr<StorageLockKey> lock;
+	if (writer.IsConcurrentCheckpoint()) {
+		lock = info->checkpoint_lock.GetExclusiveLock();
+	}
 
 	// checkpoint each individual row group
 	TableStatistics global_stats;
@@ -1245,6 +1259,12 @@ void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
 	//   table pointer
 	//   index data
 	writer.FinalizeTable(global_stats, info.get(), serializer);
+
+	if (lock) {
+		lock.reset();
+		// transactions that append to the table can commit now
+		DuckTransactionManager::Get(info->db).TableCheckpointed(*info);
+	}
 }
 
 void DataTable::CommitDropColumn(idx_t index) {
@@ -1270,6 +1290,7 @@ void DataTable::CommitDropTable() {
 // GetColumnSegmentInfo
 //===--------------------------------------------------------------------===//
 vector<ColumnSegmentInfo> DataTable::GetColumnSegmentInfo() {
+	auto lock = info->checkpoint_lock.GetSharedLock();
 	return row_groups->GetColumnSegmentInfo();
 }
 
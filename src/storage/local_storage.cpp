@@ -229,6 +229,18 @@ void LocalTableStorage::FinalizeOptimisticWriter(OptimisticDataWriter &writer) {
 	optimistic_writer.Merge(*owned_writer);
 }
 
+bool LocalTableStorage::HoldsWriteLock() {
+	if (optimistic_writer.HoldsWriteLock()) {
+		return true;
+	}
+	for (auto &writer : optimistic_writers) {
+		if (writer->HoldsWriteLock()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void LocalTableStorage::Rollback() {
 	for (auto &writer : optimistic_writers) {
 		writer->Rollback();
@@ -246,6 +258,25 @@ optional_ptr<LocalTableStorage> LocalTableManager::GetStorage(DataTable &table)
 	return entry == table_storage.end() ? nullptr : entry->second.get();
 }
 
+vector<reference<DataTable>> LocalTableManager::GetTables() {
+	lock_guard<mutex> l(table_storage_lock);
+	vector<reference<DataTable>> result;
+	for (auto &entry : table_storage) {
+		result.push_back(entry.first);
+	}
+	return result;
+}
+
+bool LocalTableManager::HoldsWriteLock() {
+	lock_guard<mutex> l(table_storage_lock);
+	for (auto &entry : table_storage) {
+		if (entry.second->HoldsWriteLock()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 LocalTableStorage &LocalTableManager::GetOrCreateStorage(DataTable &table) {
 	lock_guard<mutex> l(table_storage_lock);
 	auto entry = table_storage.find(table);
@@ -411,6 +442,14 @@ bool LocalStorage::Find(DataTable &table) {
 	return table_manager.GetStorage(table) != nullptr;
 }
 
+vector<reference<DataTable>> LocalStorage::GetTables() {
+	return table_manager.GetTables();
+}
+
+bool LocalStorage::HoldsWriteLock() {
+	return table_manager.HoldsWriteLock();
+}
+
 idx_t LocalStorage::EstimatedSize() {
 	return table_manager.EstimatedSize();
 }
@@ -15,6 +15,7 @@ MetadataManager::~MetadataManager() {
 }
 
 MetadataHandle MetadataManager::AllocateHandle() {
+	lock_guard<mutex> guard(block_lock);
 	// check if there is any free space left in an existing block
 	// if not allocate a new block
 	block_id_t free_block = INVALID_BLOCK;
@@ -47,17 +48,24 @@ MetadataHandle MetadataManager::AllocateHandle() {
 	block.free_blocks.pop_back();
 	D_ASSERT(pointer.index < METADATA_BLOCK_COUNT);
 	// pin the block
-	return Pin(pointer);
+	return Pin(block.block, pointer);
 }
 
 MetadataHandle MetadataManager::Pin(MetadataPointer pointer) {
 	D_ASSERT(pointer.index < METADATA_BLOCK_COUNT);
-	auto &block = blocks[pointer.block_index];
+	shared_ptr<BlockHandle> block;
+	{
+		lock_guard<mutex> guard(block_lock);
+		block = blocks[pointer.block_index].block;
+	}
+	return Pin(std::move(block), pointer);
+}
 
+MetadataHandle MetadataManager::Pin(shared_ptr<BlockHandle> block, MetadataPointer pointer) {
 	MetadataHandle handle;
 	handle.pointer.block_index = pointer.block_index;
 	handle.pointer.index = pointer.index;
-	handle.handle = buffer_manager.Pin(block.block);
+	handle.handle = buffer_manager.Pin(block);
 	return handle;
 }
 
@@ -128,6 +136,7 @@ uint32_t MetaBlockPointer::GetBlockIndex() const {
 MetadataPointer MetadataManager::FromDiskPointer(MetaBlockPointer pointer) {
 	auto block_id = pointer.GetBlockId();
 	auto index = pointer.GetBlockIndex();
+	lock_guard<mutex> guard(block_lock);
 	auto entry = blocks.find(block_id);
 	if (entry == blocks.end()) { // LCOV_EXCL_START
 		throw InternalException("Failed to load metadata pointer (id %llu, idx %llu, ptr %llu)\n", block_id, index,
@@ -143,7 +152,10 @@ MetadataPointer MetadataManager::RegisterDiskPointer(MetaBlockPointer pointer) {
 	auto block_id = pointer.GetBlockId();
 	MetadataBlock block;
 	block.block_id = block_id;
-	AddAndRegisterBlock(block);
+	{
+		lock_guard<mutex> guard(block_lock);
+		AddAndRegisterBlock(block);
+	}
 	return FromDiskPointer(pointer);
 }
 
@@ -170,11 +182,13 @@ MetaBlockPointer MetadataManager::FromBlockPointer(BlockPointer block_pointer) {
 }
 
 idx_t MetadataManager::BlockCount() {
+	lock_guard<mutex> guard(block_lock);
 	return blocks.size();
 }
 
 void MetadataManager::Flush() {
 	const idx_t total_metadata_size = MetadataManager::METADATA_BLOCK_SIZE * MetadataManager::METADATA_BLOCK_COUNT;
+	lock_guard<mutex> guard(block_lock);
 	// write the blocks of the metadata manager to disk
 	for (auto &kv : blocks) {
 		auto &block = kv.second;
@@ -194,6 +208,7 @@ void MetadataManager::Flush() {
 }
 
 void MetadataManager::Write(WriteStream &sink) {
+	lock_guard<mutex> guard(block_lock);
 	sink.Write<uint64_t>(blocks.size());
 	for (auto &kv : blocks) {
 		kv.second.Write(sink);
@@ -202,6 +217,7 @@ void MetadataManager::Write(WriteStream &sink) {
 
 void MetadataManager::Read(ReadStream &source) {
 	auto block_count = source.Read<uint64_t>();
+	lock_guard<mutex> guard(block_lock);
 	for (idx_t i = 0; i < block_count; i++) {
 		auto block = MetadataBlock::Read(source);
 		auto entry = blocks.find(block.block_id);
@@ -253,6 +269,7 @@ void MetadataBlock::FreeBlocksFromInteger(idx_t free_list) {
 }
 
 void MetadataManager::MarkBlocksAsModified() {
+	lock_guard<mutex> guard(block_lock);
 	// for any blocks that were modified in the last checkpoint - set them to free blocks currently
 	for (auto &kv : modified_blocks) {
 		auto block_id = kv.first;
@@ -283,6 +300,7 @@ void MetadataManager::MarkBlocksAsModified() {
 }
 
 void MetadataManager::ClearModifiedBlocks(const vector<MetaBlockPointer> &pointers) {
+	lock_guard<mutex> guard(block_lock);
 	for (auto &pointer : pointers) {
 		auto block_id = pointer.GetBlockId();
 		auto block_index = pointer.GetBlockIndex();
@@ -300,6 +318,7 @@ void MetadataManager::ClearModifiedBlocks(const vector<MetaBlockPointer> &pointe
 
 vector<MetadataBlockInfo> MetadataManager::GetMetadataInfo() const {
 	vector<MetadataBlockInfo> result;
+	lock_guard<mutex> guard(block_lock);
 	for (auto &block : blocks) {
 		MetadataBlockInfo block_info;
 		block_info.block_id = block.second.block_id;
@@ -2,6 +2,8 @@
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/storage_lock.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -12,6 +14,7 @@ OptimisticDataWriter::OptimisticDataWriter(DataTable &table, OptimisticDataWrite
 	if (parent.partial_manager) {
 		parent.partial_manager->ClearBlocks();
 	}
+	write_lock = std::move(parent.write_lock);
 }
 
 OptimisticDataWriter::~OptimisticDataWriter() {
@@ -22,6 +25,14 @@ bool OptimisticDataWriter::PrepareWrite() {
 	if (table.info->IsTemporary() || StorageManager::Get(table.info->db).InMemory()) {
 		return false;
 	}
+	if (!write_lock) {
+		// a background checkpoint rewrites the block lists of the database file: while it runs, appended rows stay in
+		// memory until the transaction commits
+		write_lock = DuckTransactionManager::Get(table.info->db).TrySharedWriteLock();
+		if (!write_lock) {
+			return false;
+		}
+	}
 	// we should! write the second-to-last row group to disk
 	// allocate the partial block-manager if none is allocated yet
 	if (!partial_manager) {
@@ -71,6 +82,9 @@ void OptimisticDataWriter::Merge(OptimisticDataWriter &other) {
 	if (!other.partial_manager) {
 		return;
 	}
+	if (!write_lock) {
+		write_lock = std::move(other.write_lock);
+	}
 	if (!partial_manager) {
 		partial_manager = std::move(other.partial_manager);
 		return;
@@ -4,6 +4,7 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/metadata/metadata_writer.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -59,7 +60,7 @@ MainHeader MainHeader::Read(ReadStream &source) {
 	}
 	header.version_number = source.Read<uint64_t>();
 	// check the version number
-	if (header.version_number != VERSION_NUMBER) {
+	if (header.version_number < VERSION_NUMBER_LOWER || header.version_number > VERSION_NUMBER) {
 		auto version = GetDuckDBVersion(header.version_number);
 		string version_text;
 		if (version) {
@@ -70,7 +71,7 @@ MainHeader MainHeader::Read(ReadStream &source) {
 			               string(" version of DuckDB");
 		}
 		throw IOException(
-		    "Trying to read a database file with version number %lld, but we can only read version %lld.\n"
+		    "Trying to read a database file with version number %lld, but we can only read versions %lld to %lld.\n"
 		    "The database file was created with %s.\n\n"
 		    "The storage of DuckDB is not yet stable; newer versions of DuckDB cannot read old database files and "
 		    "vice versa.\n"
@@ -79,7 +80,7 @@ MainHeader MainHeader::Read(ReadStream &source) {
 		    "EXPORT DATABASE command "
 		    "followed by IMPORT DATABASE on the current version of DuckDB.\n\n"
 		    "See the storage page for more information: https://duckdb.org/internals/storage",
-		    header.version_number, VERSION_NUMBER, version_text);
+		    header.version_number, VERSION_NUMBER_LOWER, VERSION_NUMBER, version_text);
 	}
 	// read the flags
 	for (idx_t i = 0; i < FLAG_COUNT; i++) {
@@ -145,9 +146,9 @@ T DeserializeHeaderStructure(data_ptr_t ptr) {
 
 SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path_p, StorageManagerOptions options)
     : BlockManager(BufferManager::GetBufferManager(db)), db(db), path(std::move(path_p)),
-      header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
-                    Storage::FILE_HEADER_SIZE - Storage::BLOCK_HEADER_SIZE),
-      iteration_count(0), options(options) {
+      version_number(VERSION_NUMBER), header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
+                                                    Storage::FILE_HEADER_SIZE - Storage::BLOCK_HEADER_SIZE),
+      bytes_written(0), write_rate_limit(0), throttled_bytes(0), iteration_count(0), options(options) {
 }
 
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
@@ -182,6 +183,7 @@ void SingleFileBlockManager::CreateNewDatabase() {
 
 	MainHeader main_header;
 	main_header.version_number = VERSION_NUMBER;
+	version_number = VERSION_NUMBER;
 	memset(main_header.flags, 0, sizeof(uint64_t) * 4);
 
 	SerializeHeaderStructure<MainHeader>(main_header, header_buffer.buffer);
@@ -234,7 +236,8 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 	MainHeader::CheckMagicBytes(*handle);
 	// otherwise, we check the metadata of the file
 	ReadAndChecksum(header_buffer, 0);
-	DeserializeHeaderStructure<MainHeader>(header_buffer.buffer);
+	auto main_header = DeserializeHeaderStructure<MainHeader>(header_buffer.buffer);
+	version_number = main_header.version_number;
 
 	// read the database headers from disk
 	DatabaseHeader h1;
@@ -394,6 +397,14 @@ idx_t SingleFileBlockManager::FreeBlocks() {
 	return free_list.size();
 }
 
+uint64_t SingleFileBlockManager::GetVersionNumber() {
+	return version_number;
+}
+
+idx_t SingleFileBlockManager::GetBytesWritten() {
+	return bytes_written;
+}
+
 unique_ptr<Block> SingleFileBlockManager::ConvertBlock(block_id_t block_id, FileBuffer &source_buffer) {
 	D_ASSERT(source_buffer.AllocSize() == Storage::BLOCK_ALLOC_SIZE);
 	return make_uniq<Block>(source_buffer, block_id);
@@ -418,7 +429,34 @@ void SingleFileBlockManager::Read(Block &block) {
 
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
+	ThrottleWrite(buffer.AllocSize());
 	ChecksumAndWrite(buffer, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
+	bytes_written += buffer.AllocSize();
+}
+
+void SingleFileBlockManager::SetWriteRateLimit(idx_t bytes_per_second) {
+	lock_guard<mutex> guard(throttle_lock);
+	write_rate_limit = bytes_per_second;
+	throttle_start = steady_clock::now();
+	throttled_bytes = 0;
+}
+
+void SingleFileBlockManager::ThrottleWrite(idx_t bytes) {
+	if (write_rate_limit == 0) {
+		return;
+	}
+	time_point<steady_clock> target;
+	{
+		lock_guard<mutex> guard(throttle_lock);
+		if (write_rate_limit == 0) {
+			return;
+		}
+		// the bytes written so far (including this write) may not be written before this point in time
+		throttled_bytes += bytes;
+		auto delay = std::chrono::microseconds(throttled_bytes * 1000000 / write_rate_limit);
+		target = throttle_start + delay;
+	}
+	std::this_thread::sleep_until(target);
 }
 
 void SingleFileBlockManager::Truncate() {
@@ -549,6 +587,7 @@ void SingleFileBlockManager::WriteHeader(DatabaseHeader header) {
 	// now write the header to the file, active_header determines whether we write to h1 or h2
 	// note that if active_header is h1 we write to h2, and vice versa
 	ChecksumAndWrite(header_buffer, active_header == 1 ? Storage::FILE_HEADER_SIZE : Storage::FILE_HEADER_SIZE * 2);
+	bytes_written += header_buffer.AllocSize();
 	// switch active header to the other header
 	active_header = 1 - active_header;
 	//! Ensure the header write ends up on disk
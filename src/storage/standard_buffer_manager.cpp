@@ -49,6 +49,8 @@ StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		evicted_data_per_tag[i] = 0;
+		spilled_data_per_tag[i] = 0;
+		read_back_data_per_tag[i] = 0;
 	}
 }
 
@@ -243,6 +245,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.spilled_data = spilled_data_per_tag[k].load();
+		info.read_back_data = read_back_data_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -277,12 +281,18 @@ void StandardBufferManager::RequireTemporaryDirectory() {
 
 void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 	RequireTemporaryDirectory();
+	auto operator_info = BufferPool::GetOperatorMemoryInformation();
+	if (operator_info) {
+		operator_info->spilled_data += buffer.size;
+	}
 	if (buffer.size == Storage::BLOCK_SIZE) {
 		evicted_data_per_tag[uint8_t(tag)] += Storage::BLOCK_SIZE;
+		spilled_data_per_tag[uint8_t(tag)] += Storage::BLOCK_SIZE;
 		temp_directory_handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
 		return;
 	}
 	evicted_data_per_tag[uint8_t(tag)] += buffer.size;
+	spilled_data_per_tag[uint8_t(tag)] += buffer.size;
 	// get the path to write to
 	auto path = GetTemporaryPath(block_id);
 	D_ASSERT(buffer.size > Storage::BLOCK_SIZE);
@@ -297,8 +307,13 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
                                                                   unique_ptr<FileBuffer> reusable_buffer) {
 	D_ASSERT(!temp_directory.empty());
 	D_ASSERT(temp_directory_handle.get());
+	auto operator_info = BufferPool::GetOperatorMemoryInformation();
 	if (temp_directory_handle->GetTempFile().HasTemporaryBuffer(id)) {
 		evicted_data_per_tag[uint8_t(tag)] -= Storage::BLOCK_SIZE;
+		read_back_data_per_tag[uint8_t(tag)] += Storage::BLOCK_SIZE;
+		if (operator_info) {
+			operator_info->read_back_data += Storage::BLOCK_SIZE;
+		}
 		return temp_directory_handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
 	}
 	idx_t block_size;
@@ -308,6 +323,10 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
 	handle->Read(&block_size, sizeof(idx_t), 0);
 	evicted_data_per_tag[uint8_t(tag)] -= block_size;
+	read_back_data_per_tag[uint8_t(tag)] += block_size;
+	if (operator_info) {
+		operator_info->read_back_data += block_size;
+	}
 
 	// now allocate a buffer of this size and read the data into that buffer
 	auto buffer = ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t), block_size, std::move(reusable_buffer));
@@ -368,6 +387,8 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		info.path = name;
 		auto handle = fs.OpenFile(name, FileFlags::FILE_FLAGS_READ);
 		info.size = fs.GetFileSize(*handle);
+		info.uncompressed_size = info.size;
+		info.compressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
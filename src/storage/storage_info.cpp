@@ -2,7 +2,8 @@
 
 namespace duckdb {
 
-const uint64_t VERSION_NUMBER = 64;
+const uint64_t VERSION_NUMBER = 65;
+const uint64_t VERSION_NUMBER_LOWER = 64;
 
 struct StorageVersionInfo {
 	const char *version_name;
@@ -16,16 +16,37 @@ StorageLockKey::~StorageLockKey() {
 	}
 }
 
-StorageLock::StorageLock() : read_count(0) {
+StorageLock::StorageLock() : read_count(0), exclusive_waiting(false) {
 }
 
 unique_ptr<StorageLockKey> StorageLock::GetExclusiveLock() {
 	exclusive_lock.lock();
-	while (read_count != 0) {
+	WaitForReaders();
+	return make_uniq<StorageLockKey>(*this, StorageLockType::EXCLUSIVE);
+}
+
+unique_ptr<StorageLockKey> StorageLock::TryGetExclusiveLock() {
+	if (!exclusive_lock.try_lock()) {
+		return nullptr;
+	}
+	if (read_count != 0) {
+		exclusive_lock.unlock();
+		return nullptr;
 	}
 	return make_uniq<StorageLockKey>(*this, StorageLockType::EXCLUSIVE);
 }
 
+void StorageLock::WaitForReaders() {
+	if (read_count == 0) {
+		return;
+	}
+	// new readers are blocked by the exclusive_lock: wait for the current ones to finish
+	unique_lock<mutex> guard(wait_lock);
+	exclusive_waiting = true;
+	readers_finished.wait(guard, [&]() { return read_count == 0; });
+	exclusive_waiting = false;
+}
+
 unique_ptr<StorageLockKey> StorageLock::GetSharedLock() {
 	exclusive_lock.lock();
 	read_count++;
@@ -33,12 +54,30 @@ unique_ptr<StorageLockKey> StorageLock::GetSharedLock() {
 	return make_uniq<StorageLockKey>(*this, StorageLockType::SHARED);
 }
 
+unique_ptr<StorageLockKey> StorageLock::TryGetSharedLock() {
+	if (!exclusive_lock.try_lock()) {
+		return nullptr;
+	}
+	read_count++;
+	exclusive_lock.unlock();
+	return make_uniq<StorageLockKey>(*this, StorageLockType::SHARED);
+}
+
+unique_ptr<StorageLockKey> StorageLock::AddSharedLock() {
+	D_ASSERT(read_count > 0);
+	read_count++;
+	return make_uniq<StorageLockKey>(*this, StorageLockType::SHARED);
+}
+
 void StorageLock::ReleaseExclusiveLock() {
 	exclusive_lock.unlock();
 }
 
 void StorageLock::ReleaseSharedLock() {
-	read_count--;
+	if (--read_count == 0 && exclusive_waiting) {
+		lock_guard<mutex> guard(wait_lock);
+		readers_finished.notify_one();
+	}
 }
 
 } // namespace duckdb
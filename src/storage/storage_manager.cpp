@@ -53,29 +53,68 @@ bool ObjectCache::ObjectCacheEnabled(ClientContext &context) {
 }
 
 optional_ptr<WriteAheadLog> StorageManager::GetWriteAheadLog() {
+	return GetSharedWriteAheadLog().get();
+}
+
+shared_ptr<WriteAheadLog> StorageManager::GetSharedWriteAheadLog() {
 	if (InMemory() || read_only || !load_complete) {
 		return nullptr;
 	}
 
 	if (wal) {
-		return wal.get();
+		return wal;
 	}
 
 	// lazy WAL creation
-	wal = make_uniq<WriteAheadLog>(db, GetWALPath());
-	return wal.get();
+	wal = make_shared<WriteAheadLog>(db, checkpointed_wal ? GetCheckpointWALPath() : GetWALPath());
+	return wal;
 }
 
-string StorageManager::GetWALPath() {
+optional_ptr<WriteAheadLog> StorageManager::GetWriteAheadLogToCheckpoint() {
+	if (checkpointed_wal) {
+		return checkpointed_wal.get();
+	}
+	return GetWriteAheadLog();
+}
+
+void StorageManager::BeginConcurrentCheckpoint() {
+	D_ASSERT(!checkpointed_wal);
+	if (!GetWriteAheadLog()) {
+		return;
+	}
+	// the next commit creates a new WAL
+	checkpointed_wal = std::move(wal);
+}
+
+void StorageManager::FinishConcurrentCheckpoint() {
+	if (!checkpointed_wal) {
+		return;
+	}
+	// the contents of the checkpointed WAL are in the database file now
+	checkpointed_wal->Delete();
+	checkpointed_wal.reset();
+	if (wal) {
+		wal->Move(GetWALPath());
+	}
+}
 
+static string AddPathSuffix(const string &path, const string &suffix) {
 	std::size_t question_mark_pos = path.find('?');
-	auto wal_path = path;
+	auto result = path;
 	if (question_mark_pos != std::string::npos) {
-		wal_path.insert(question_mark_pos, ".wal");
+		result.insert(question_mark_pos, suffix);
 	} else {
-		wal_path += ".wal";
+		result += suffix;
 	}
-	return wal_path;
+	return result;
+}
+
+string StorageManager::GetWALPath() {
+	return AddPathSuffix(path, ".wal");
+}
+
+string StorageManager::GetCheckpointWALPath() {
+	return AddPathSuffix(path, ".wal.checkpoint");
 }
 
 bool StorageManager::InMemory() {
@@ -113,6 +152,32 @@ public:
 	}
 };
 
+//! Append the complete transactions in the WAL left behind by a background checkpoint to the main WAL, which
+//! contains wal_size bytes of complete transactions
+static void MergeCheckpointWAL(FileSystem &fs, const string &wal_path, idx_t wal_size,
+                               const string &checkpoint_wal_path, idx_t checkpoint_wal_size) {
+	auto version_size = WriteAheadLog::VersionMarkerSize();
+	if (checkpoint_wal_size > version_size) {
+		// the main WAL keeps its own version marker (if it has one)
+		idx_t source_offset = wal_size == 0 ? 0 : version_size;
+		auto source = fs.OpenFile(checkpoint_wal_path, FileFlags::FILE_FLAGS_READ);
+		auto target = fs.OpenFile(wal_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+		auto buffer = make_unsafe_uniq_array<data_t>(Storage::BLOCK_ALLOC_SIZE);
+		idx_t target_offset = wal_size;
+		while (source_offset < checkpoint_wal_size) {
+			auto copy_size = MinValue<idx_t>(Storage::BLOCK_ALLOC_SIZE, checkpoint_wal_size - source_offset);
+			source->Read(buffer.get(), copy_size, source_offset);
+			target->Write(buffer.get(), copy_size, target_offset);
+			source_offset += copy_size;
+			target_offset += copy_size;
+		}
+		// drop a torn transaction at the end of the main WAL
+		target->Truncate(NumericCast<int64_t>(target_offset));
+		target->Sync();
+	}
+	fs.RemoveFile(checkpoint_wal_path);
+}
+
 SingleFileStorageManager::SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only)
     : StorageManager(db, std::move(path), read_only) {
 }
@@ -149,6 +214,10 @@ void SingleFileStorageManager::LoadDatabase(optional_ptr<ClientContext> context)
 			// remove the WAL
 			fs.RemoveFile(wal_path);
 		}
+		auto checkpoint_wal_path = GetCheckpointWALPath();
+		if (fs.FileExists(checkpoint_wal_path)) {
+			fs.RemoveFile(checkpoint_wal_path);
+		}
 
 		// initialize the block manager while creating a new db file
 		auto sf_block_manager = make_uniq<SingleFileBlockManager>(db, path, options);
@@ -171,11 +240,25 @@ void SingleFileStorageManager::LoadDatabase(optional_ptr<ClientContext> context)
 
 		// check if the WAL file exists
 		auto wal_path = GetWALPath();
+		idx_t wal_size = 0;
 		auto handle = fs.OpenFile(wal_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
 		if (handle) {
 			// replay the WAL
-			if (WriteAheadLog::Replay(db, std::move(handle))) {
+			if (WriteAheadLog::Replay(db, std::move(handle), wal_size)) {
 				fs.RemoveFile(wal_path);
+				wal_size = 0;
+			}
+		}
+		// a background checkpoint that did not finish leaves the WAL of the commits made while it ran behind: these
+		// commits come after the ones in the main WAL
+		auto checkpoint_wal_path = GetCheckpointWALPath();
+		handle =
+		    fs.OpenFile(checkpoint_wal_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (handle) {
+			idx_t checkpoint_wal_size = 0;
+			WriteAheadLog::Replay(db, std::move(handle), checkpoint_wal_size);
+			if (!read_only) {
+				MergeCheckpointWAL(fs, wal_path, wal_size, checkpoint_wal_path, checkpoint_wal_size);
 			}
 		}
 	}
@@ -206,7 +289,7 @@ public:
 	}
 
 	// Make the commit persistent
-	void FlushCommit() override;
+	idx_t FlushCommit() override;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
@@ -229,19 +312,21 @@ SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &stora
 }
 
 // Make the commit persistent
-void SingleFileStorageCommitState::FlushCommit() {
+idx_t SingleFileStorageCommitState::FlushCommit() {
+	idx_t sync_position = 0;
 	if (log) {
 		// flush the WAL if any changes were made
 		if (log->GetTotalWritten() > initial_written) {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			sync_position = log->FlushCommit();
 		}
 		log->skip_writing = false;
 	}
 	// Null so that the destructor will not truncate the log.
 	log = nullptr;
+	return sync_position;
 }
 
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(Transaction &transaction,
@@ -253,22 +338,33 @@ bool SingleFileStorageManager::IsCheckpointClean(MetaBlockPointer checkpoint_id)
 	return block_manager->IsRootBlock(checkpoint_id);
 }
 
-void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint) {
-	if (InMemory() || read_only || !wal) {
+void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint, bool concurrent) {
+	auto log = concurrent ? checkpointed_wal.get() : wal.get();
+	if (InMemory() || read_only || !log) {
 		return;
 	}
 	auto &config = DBConfig::Get(db);
-	if (wal->GetWALSize() > 0 || config.options.force_checkpoint || force_checkpoint) {
+	if (log->GetWALSize() > 0 || config.options.force_checkpoint || force_checkpoint) {
 		// we only need to checkpoint if there is anything in the WAL
+		auto initial_bytes_written = block_manager->GetBytesWritten();
+		block_manager->SetWriteRateLimit(config.options.checkpoint_write_rate_limit);
 		try {
-			SingleFileCheckpointWriter checkpointer(db, *block_manager);
+			SingleFileCheckpointWriter checkpointer(db, *block_manager, concurrent);
 			checkpointer.CreateCheckpoint();
 		} catch (std::exception &ex) {
+			block_manager->SetWriteRateLimit(0);
 			ErrorData error(ex);
 			throw FatalException("Failed to create checkpoint because of error: %s", error.RawMessage());
 		}
+		block_manager->SetWriteRateLimit(0);
+		auto bytes_written = block_manager->GetBytesWritten() - initial_bytes_written;
+		lock_guard<mutex> guard(stats_lock);
+		checkpoint_stats.checkpoint_count++;
+		checkpoint_stats.last_bytes_written = bytes_written;
+		checkpoint_stats.total_bytes_written += bytes_written;
 	}
 	if (delete_wal) {
+		D_ASSERT(!concurrent);
 		wal->Delete();
 		wal.reset();
 	}
@@ -290,6 +386,11 @@ DatabaseSize SingleFileStorageManager::GetDatabaseSize() {
 	return ds;
 }
 
+CheckpointStatistics SingleFileStorageManager::GetCheckpointStatistics() {
+	lock_guard<mutex> guard(stats_lock);
+	return checkpoint_stats;
+}
+
 vector<MetadataBlockInfo> SingleFileStorageManager::GetMetadataInfo() {
 	auto &metadata_manager = block_manager->GetMetadataManager();
 	return metadata_manager.GetMetadataInfo();
@@ -81,7 +81,7 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.last_offset = 0;
 }
 
-idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, bool has_updates) {
+void ColumnData::BeginScanVectorInternal(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (!state.initialized) {
 		D_ASSERT(state.current);
@@ -95,6 +95,10 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		state.current->Skip(state);
 	}
 	D_ASSERT(state.current->type == type);
+}
+
+idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, bool has_updates) {
+	BeginScanVectorInternal(state);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
 		D_ASSERT(state.row_index >= state.current->start &&
@@ -208,6 +212,31 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, count);
 }
 
+bool ColumnData::TryFilterVector(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                 idx_t &approved_tuple_count, const TableFilter &filter) {
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (updates) {
+			return false;
+		}
+	}
+	if (state.scan_options && state.scan_options->force_fetch_row) {
+		return false;
+	}
+	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
+	auto vector_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - current_row);
+	BeginScanVectorInternal(state);
+	auto &segment = *state.current;
+	if (!segment.SupportsFilter() || state.row_index + vector_count > segment.start + segment.count) {
+		// the segment cannot filter, or the vector crosses a segment boundary
+		return false;
+	}
+	segment.Filter(state, vector_count, result, sel, approved_tuple_count, filter);
+	state.row_index += vector_count;
+	state.internal_index = state.row_index;
+	return true;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t count) {
 	Scan(transaction, vector_index, state, result);
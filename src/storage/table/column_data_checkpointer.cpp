@@ -4,6 +4,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 
@@ -15,7 +16,12 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
       checkpoint_info(checkpoint_info_p) {
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	auto functions = config.GetCompressionFunctions(GetType().InternalType());
+	// database files of an older storage version can only hold the compression methods that version knew about
+	auto legacy_storage = col_data.GetBlockManager().GetVersionNumber() <= VERSION_NUMBER_LOWER;
 	for (auto &func : functions) {
+		if (legacy_storage && func.get().type == CompressionType::COMPRESSION_ZSTD) {
+			continue;
+		}
 		compression_functions.push_back(&func.get());
 	}
 }
@@ -40,6 +46,11 @@ ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
+idx_t ColumnDataCheckpointer::GetRowStart() const {
+	D_ASSERT(!nodes.empty());
+	return nodes[0].node->start;
+}
+
 void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
@@ -174,7 +185,7 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 
 void ColumnDataCheckpointer::WriteToDisk() {
 	// there were changes or transient segments
-	// we need to rewrite the column segments to disk
+	// we need to rewrite this run of column segments to disk
 
 	// first we check the current segments
 	// if there are any persistent segments, we will mark their old block ids as modified
@@ -204,19 +215,21 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	nodes.clear();
 }
 
+bool ColumnDataCheckpointer::HasChanges(ColumnSegment &segment) {
+	if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+		// transient segment: always need to write to disk
+		return true;
+	}
+	// persistent segment; check if there were any updates or deletions in this segment
+	idx_t start_row_idx = segment.start - row_group.start;
+	idx_t end_row_idx = start_row_idx + segment.count;
+	return col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx);
+}
+
 bool ColumnDataCheckpointer::HasChanges() {
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = nodes[segment_idx].node.get();
-		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
-			// transient segment: always need to write to disk
+		if (HasChanges(*nodes[segment_idx].node)) {
 			return true;
-		} else {
-			// persistent segment; check if there were any updates or deletions in this segment
-			idx_t start_row_idx = segment->start - row_group.start;
-			idx_t end_row_idx = start_row_idx + segment->count;
-			if (col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx)) {
-				return true;
-			}
 		}
 	}
 	return false;
@@ -257,10 +270,51 @@ void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes
 	if (!HasChanges()) {
 		// no changes: only need to write the metadata for this column
 		WritePersistentSegments();
-	} else {
-		// there are changes: rewrite the set of columns);
-		WriteToDisk();
+		return;
+	}
+	// there are changes: figure out which segments need to be rewritten
+	// unchanged persistent segments keep their blocks, so a few updates only rewrite the segments they touch
+	auto segments = std::move(nodes);
+	vector<bool> rewrite(segments.size());
+	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
+		rewrite[segment_idx] = HasChanges(*segments[segment_idx].node);
 	}
+	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
+		if (rewrite[segment_idx]) {
+			continue;
+		}
+		auto &segment = *segments[segment_idx].node;
+		bool next_is_transient = segment_idx + 1 < segments.size() &&
+		                         segments[segment_idx + 1].node->segment_type == ColumnSegmentType::TRANSIENT;
+		bool next_is_rewritten = segment_idx + 1 < segments.size() && rewrite[segment_idx + 1];
+		bool prev_is_rewritten = segment_idx > 0 && rewrite[segment_idx - 1];
+		if (next_is_transient) {
+			// appended data follows this segment: merge the two so repeated appends do not fragment the column
+			rewrite[segment_idx] = true;
+		} else if ((next_is_rewritten || prev_is_rewritten) && segment.count < STANDARD_VECTOR_SIZE) {
+			// small leftover segment next to a rewritten segment: merge it as well
+			rewrite[segment_idx] = true;
+		}
+	}
+	// now write the segments as consecutive runs that are either kept as-is or rewritten
+	idx_t run_start = 0;
+	while (run_start < segments.size()) {
+		idx_t run_end = run_start + 1;
+		while (run_end < segments.size() && rewrite[run_end] == rewrite[run_start]) {
+			run_end++;
+		}
+		nodes.clear();
+		for (idx_t segment_idx = run_start; segment_idx < run_end; segment_idx++) {
+			nodes.push_back(std::move(segments[segment_idx]));
+		}
+		if (rewrite[run_start]) {
+			WriteToDisk();
+		} else {
+			WritePersistentSegments();
+		}
+		run_start = run_end;
+	}
+	nodes.clear();
 }
 
 CompressionFunction &ColumnDataCheckpointer::GetCompressionFunction(CompressionType compression_type) {
@@ -171,11 +171,22 @@ void CollectionScanState::Initialize(const vector<LogicalType> &types) {
 	}
 }
 
+//! The number of rows a scan of the row group that starts at the given vector would read
+static idx_t GetScanRowCount(const RowGroup &row_group, const CollectionScanState &state, idx_t vector_offset) {
+	if (row_group.start > state.max_row) {
+		return 0;
+	}
+	auto row_count = MinValue<idx_t>(row_group.count, state.max_row - row_group.start);
+	auto start_row = vector_offset * STANDARD_VECTOR_SIZE;
+	return row_count > start_row ? row_count - start_row : 0;
+}
+
 bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset) {
 	auto &column_ids = state.GetColumnIds();
 	auto filters = state.GetFilters();
 	if (filters) {
 		if (!CheckZonemap(*filters, column_ids)) {
+			state.zonemap_pruned_rows += GetScanRowCount(*this, state, vector_offset);
 			return false;
 		}
 	}
@@ -208,6 +219,7 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	auto filters = state.GetFilters();
 	if (filters) {
 		if (!CheckZonemap(*filters, column_ids)) {
+			state.zonemap_pruned_rows += GetScanRowCount(*this, state, 0);
 			return false;
 		}
 	}
@@ -396,6 +408,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -430,6 +444,8 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 				// exceedingly rare
 				return true;
 			}
+			auto skipped_rows = MinValue<idx_t>(target_vector_index * STANDARD_VECTOR_SIZE, state.max_row_group_row);
+			state.zonemap_pruned_rows += skipped_rows - state.vector_index * STANDARD_VECTOR_SIZE;
 			while (state.vector_index < target_vector_index) {
 				NextVector(state);
 			}
@@ -168,6 +168,37 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.node_row_groups.clear();
+}
+
+//! Stripes the remaining row groups over the NUMA nodes: node n scans the row groups whose index % node_count == n,
+//! so repeated scans by pinned threads keep reading the row groups whose blocks were loaded into their node's memory
+static void InitializeNodeRowGroups(RowGroupSegmentTree &row_groups, ParallelCollectionScanState &state,
+                                    idx_t node_count) {
+	D_ASSERT(state.current_row_group);
+	auto start = state.current_row_group->index;
+	state.node_row_groups.resize(node_count);
+	for (idx_t node = 0; node < node_count; node++) {
+		auto offset = (node + node_count - start % node_count) % node_count;
+		state.node_row_groups[node] = row_groups.GetSegmentByIndex(NumericCast<int64_t>(start + offset));
+	}
+	state.current_row_group = nullptr;
+}
+
+//! Takes the next row group of the given node, or steals one from the other nodes once those are exhausted
+static RowGroup *NextNodeRowGroup(RowGroupSegmentTree &row_groups, ParallelCollectionScanState &state, idx_t node) {
+	auto node_count = state.node_row_groups.size();
+	for (idx_t i = 0; i < node_count; i++) {
+		auto &cursor = state.node_row_groups[(node + i) % node_count];
+		if (!cursor || cursor->count == 0) {
+			cursor = nullptr;
+			continue;
+		}
+		auto row_group = cursor;
+		cursor = row_groups.GetSegmentByIndex(NumericCast<int64_t>(row_group->index + node_count));
+		return row_group;
+	}
+	return nullptr;
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
@@ -180,31 +211,56 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
-			if (!state.current_row_group || state.current_row_group->count == 0) {
-				// no more data left to scan
-				break;
+			auto verify_parallelism = ClientConfig::GetConfig(context).verify_parallelism;
+			auto numa_node = TaskScheduler::GetThreadNumaNode();
+			if (state.node_row_groups.empty() && scan_state.GetOptions().prefer_local_row_groups &&
+			    !verify_parallelism && numa_node.IsValid() && state.current_row_group &&
+			    state.current_row_group->count > 0) {
+				auto node_count = TaskScheduler::GetScheduler(context).NumaNodeCount();
+				if (node_count > 1) {
+					InitializeNodeRowGroups(*row_groups, state, node_count);
+				}
 			}
-			collection = state.collection;
-			row_group = state.current_row_group;
-			if (ClientConfig::GetConfig(context).verify_parallelism) {
-				vector_index = state.vector_index;
-				max_row = state.current_row_group->start +
-				          MinValue<idx_t>(state.current_row_group->count,
-				                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
-				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
-				state.vector_index++;
-				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
-					state.vector_index = 0;
+			if (!state.node_row_groups.empty()) {
+				// the row groups are striped over the NUMA nodes - threads that are not pinned start at the first node
+				auto node = numa_node.IsValid() ? numa_node.GetIndex() : 0;
+				row_group = NextNodeRowGroup(*row_groups, state, node);
+				if (!row_group) {
+					// no more data left to scan
+					break;
 				}
-			} else {
-				state.processed_rows += state.current_row_group->count;
+				collection = state.collection;
+				state.processed_rows += row_group->count;
 				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				max_row = MinValue<idx_t>(row_group->start + row_group->count, state.max_row);
+				scan_state.batch_index = ++state.batch_index;
+			} else {
+				if (!state.current_row_group || state.current_row_group->count == 0) {
+					// no more data left to scan
+					break;
+				}
+				collection = state.collection;
+				row_group = state.current_row_group;
+				if (verify_parallelism) {
+					vector_index = state.vector_index;
+					max_row = state.current_row_group->start +
+					          MinValue<idx_t>(state.current_row_group->count,
+					                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
+					D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
+					state.vector_index++;
+					if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
+						state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+						state.vector_index = 0;
+					}
+				} else {
+					state.processed_rows += state.current_row_group->count;
+					vector_index = 0;
+					max_row = state.current_row_group->start + state.current_row_group->count;
+					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				}
+				max_row = MinValue<idx_t>(max_row, state.max_row);
+				scan_state.batch_index = ++state.batch_index;
 			}
-			max_row = MinValue<idx_t>(max_row, state.max_row);
-			scan_state.batch_index = ++state.batch_index;
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
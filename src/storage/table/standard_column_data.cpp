@@ -2,6 +2,7 @@
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
@@ -75,6 +76,28 @@ idx_t StandardColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &sta
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	// try to evaluate the filter directly on the compressed data (e.g. once per dictionary entry)
+	SelectionVector segment_sel(sel);
+	idx_t segment_count = count;
+	if (!TryFilterVector(vector_index, state, result, segment_sel, segment_count, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	auto scan_count = validity.Scan(transaction, vector_index, state.child_states[0], result);
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	if (vdata.validity.AllValid()) {
+		sel.Initialize(segment_sel);
+		count = segment_count;
+		return;
+	}
+	// the segment filter does not know about NULL values: evaluate the filter on the (now flat) vector instead
+	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, count);
+}
+
 idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t count) {
 	auto scan_count = ColumnData::ScanCount(state, result, count);
 	validity.ScanCount(state.child_states[0], result, count);
@@ -4,6 +4,7 @@
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/execution/index/unknown_index.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/config.hpp"
@@ -146,6 +147,9 @@ vector<IndexStorageInfo> TableIndexList::GetStorageInfos() {
 
 	vector<IndexStorageInfo> index_storage_infos;
 	for (auto &index : indexes) {
+		// a background checkpoint serializes the index while transactions can still scan it
+		IndexLock index_lock;
+		index->InitializeLock(index_lock);
 		auto index_storage_info = index->GetStorageInfo(false);
 		D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
 		index_storage_infos.push_back(index_storage_info);
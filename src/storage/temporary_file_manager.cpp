@@ -1,6 +1,8 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -68,16 +70,24 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(TemporaryFileIdentifier identifier) {
+	if (identifier.size == TemporaryBufferSize::DEFAULT) {
+		return "duckdb_temp_storage-" + to_string(identifier.file_index) + ".tmp";
+	}
+	auto size_in_kb = static_cast<idx_t>(identifier.size) / 1024;
+	return "duckdb_temp_storage_S" + to_string(size_in_kb) + "K-" + to_string(identifier.file_index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")) {
+                                         TemporaryFileIdentifier identifier_p)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), identifier(identifier_p),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(identifier))) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
 }
 
-TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
+TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex(idx_t written_size) {
 	TemporaryFileLock lock(file_lock);
 	if (index_manager.GetMaxIndex() >= max_allowed_index && index_manager.HasFreeBlocks()) {
 		// file is at capacity
@@ -87,19 +97,54 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	CreateFileIfNotExists(lock);
 	// fetch a new block index to write to
 	auto block_index = index_manager.GetNewBlockIndex();
-	return TemporaryFileIndex(file_index, block_index);
+	// account for the slot while holding the lock, so GetTemporaryFile never sees a slot without its size
+	written_sizes[block_index] = written_size;
+	compressed_size += written_size;
+	return TemporaryFileIndex(identifier, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer, idx_t written_size) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	D_ASSERT(index.identifier.size == identifier.size);
+	if (identifier.size == TemporaryBufferSize::DEFAULT) {
+		D_ASSERT(written_size == buffer.AllocSize());
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+	} else {
+		// the compressed buffer is prefixed with its size
+		D_ASSERT(written_size <= static_cast<idx_t>(identifier.size));
+		handle->Write(compressed_buffer.get(), written_size, GetPositionInFile(index.block_index));
+	}
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (identifier.size == TemporaryBufferSize::DEFAULT) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position,
+		                                                          Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	}
+
+	// only the compressed bytes of a slot are written, so the last slot of the file can be shorter than the slot size:
+	// read the size prefix first, and then only the compressed data
+	auto slot_size = static_cast<idx_t>(identifier.size);
+	data_t size_prefix[sizeof(idx_t)];
+	handle->Read(size_prefix, sizeof(idx_t), position);
+	auto compressed_size = Load<idx_t>(size_prefix);
+	if (sizeof(idx_t) + compressed_size > slot_size) {
+		throw IOException("Corrupt compressed buffer in temporary file \"%s\"", path);
+	}
+	auto compressed_buffer = Allocator::Get(db).Allocate(compressed_size);
+	handle->Read(compressed_buffer.get(), compressed_size, position + sizeof(idx_t));
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_zstd::ZSTD_decompress(buffer->InternalBuffer(), buffer->AllocSize(),
+	                                                      compressed_buffer.get(), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress temporary buffer in file \"%s\"", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -127,6 +172,8 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.uncompressed_size = written_sizes.size() * Storage::BLOCK_ALLOC_SIZE;
+	info.compressed_size = compressed_size;
 	return info;
 }
 
@@ -140,6 +187,11 @@ void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 }
 
 void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index) {
+	auto entry = written_sizes.find(index);
+	if (entry != written_sizes.end()) {
+		compressed_size -= entry->second;
+		written_sizes.erase(entry);
+	}
 	// remove the block index from the index manager
 	if (index_manager.RemoveIndex(index)) {
 		// the max_index that is currently in use has decreased
@@ -153,7 +205,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * static_cast<idx_t>(identifier.size);
 }
 
 //===--------------------------------------------------------------------===//
@@ -209,15 +261,23 @@ TemporaryFileManager &TemporaryDirectoryHandle::GetTempFile() {
 }
 
 //===--------------------------------------------------------------------===//
-// TemporaryFileIndex
+// TemporaryFileIdentifier/TemporaryFileIndex
 //===--------------------------------------------------------------------===//
 
-TemporaryFileIndex::TemporaryFileIndex(idx_t file_index, idx_t block_index)
-    : file_index(file_index), block_index(block_index) {
+TemporaryFileIdentifier::TemporaryFileIdentifier(TemporaryBufferSize size, idx_t file_index)
+    : size(size), file_index(file_index) {
+}
+
+bool TemporaryFileIdentifier::IsValid() const {
+	return size != TemporaryBufferSize::INVALID && file_index != DConstants::INVALID_INDEX;
+}
+
+TemporaryFileIndex::TemporaryFileIndex(TemporaryFileIdentifier identifier, idx_t block_index)
+    : identifier(identifier), block_index(block_index) {
 }
 
 bool TemporaryFileIndex::IsValid() const {
-	return block_index != DConstants::INVALID_INDEX;
+	return identifier.IsValid() && block_index != DConstants::INVALID_INDEX;
 }
 
 //===--------------------------------------------------------------------===//
@@ -231,17 +291,50 @@ TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &t
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+TemporaryBufferSize TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer,
+                                                         idx_t &compressed_size) {
+	compressed_size = buffer.AllocSize();
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	// compress the buffer, prefixed with the compressed size
+	auto bound = duckdb_zstd::ZSTD_compressBound(buffer.AllocSize());
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + bound);
+	auto zstd_size = duckdb_zstd::ZSTD_compress(compressed_buffer.get() + sizeof(idx_t), bound,
+	                                            buffer.InternalBuffer(), buffer.AllocSize(), COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(zstd_size)) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	Store<idx_t>(zstd_size, compressed_buffer.get());
+
+	// find the smallest slot size the compressed buffer fits in
+	auto required_size = sizeof(idx_t) + zstd_size;
+	auto slot_size = AlignValue<idx_t, static_cast<idx_t>(TemporaryBufferSize::S32K)>(required_size);
+	if (slot_size > static_cast<idx_t>(TemporaryBufferSize::S224K)) {
+		// the buffer does not compress well enough: write it uncompressed
+		compressed_buffer.Reset();
+		return TemporaryBufferSize::DEFAULT;
+	}
+	compressed_size = required_size;
+	return static_cast<TemporaryBufferSize>(slot_size);
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	// compress the buffer before grabbing the lock
+	AllocatedData compressed_buffer;
+	idx_t compressed_size;
+	auto size = CompressBuffer(buffer, compressed_buffer, compressed_size);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
-
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
-		for (auto &entry : files) {
+		// first check if we can write to an open existing file with the same slot size
+		auto &size_files = files[size];
+		for (auto &entry : size_files) {
 			auto &temp_file = entry.second;
-			index = temp_file->TryGetBlockIndex();
+			index = temp_file->TryGetBlockIndex(compressed_size);
 			if (index.IsValid()) {
 				handle = entry.second.get();
 				break;
@@ -249,19 +342,20 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		}
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
-			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index);
+			auto new_file_index = index_managers[size].GetNewBlockIndex();
+			TemporaryFileIdentifier identifier(size, new_file_index);
+			auto new_file = make_uniq<TemporaryFileHandle>(size_files.size(), db, temp_directory, identifier);
 			handle = new_file.get();
-			files[new_file_index] = std::move(new_file);
+			size_files[new_file_index] = std::move(new_file);
 
-			index = handle->TryGetBlockIndex();
+			index = handle->TryGetBlockIndex(compressed_size);
 		}
 		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
 		used_blocks[block_id] = index;
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer, compressed_size);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -276,7 +370,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 	{
 		TemporaryManagerLock lock(manager_lock);
 		index = GetTempBlockIndex(lock, id);
-		handle = GetFileHandle(lock, index.file_index);
+		handle = GetFileHandle(lock, index.identifier);
 	}
 	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
 	{
@@ -290,15 +384,17 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 void TemporaryFileManager::DeleteTemporaryBuffer(block_id_t id) {
 	TemporaryManagerLock lock(manager_lock);
 	auto index = GetTempBlockIndex(lock, id);
-	auto handle = GetFileHandle(lock, index.file_index);
+	auto handle = GetFileHandle(lock, index.identifier);
 	EraseUsedBlock(lock, id, handle, index);
 }
 
 vector<TemporaryFileInformation> TemporaryFileManager::GetTemporaryFiles() {
 	lock_guard<mutex> lock(manager_lock);
 	vector<TemporaryFileInformation> result;
-	for (auto &file : files) {
-		result.push_back(file.second->GetTemporaryFile());
+	for (auto &size_files : files) {
+		for (auto &file : size_files.second) {
+			result.push_back(file.second->GetTemporaryFile());
+		}
 	}
 	return result;
 }
@@ -312,13 +408,14 @@ void TemporaryFileManager::EraseUsedBlock(TemporaryManagerLock &lock, block_id_t
 	used_blocks.erase(entry);
 	handle->EraseBlockIndex(index.block_index);
 	if (handle->DeleteIfEmpty()) {
-		EraseFileHandle(lock, index.file_index);
+		EraseFileHandle(lock, index.identifier);
 	}
 }
 
 // FIXME: returning a raw pointer???
-TemporaryFileHandle *TemporaryFileManager::GetFileHandle(TemporaryManagerLock &, idx_t index) {
-	return files[index].get();
+TemporaryFileHandle *TemporaryFileManager::GetFileHandle(TemporaryManagerLock &, TemporaryFileIdentifier identifier) {
+	D_ASSERT(identifier.IsValid());
+	return files[identifier.size][identifier.file_index].get();
 }
 
 TemporaryFileIndex TemporaryFileManager::GetTempBlockIndex(TemporaryManagerLock &, block_id_t id) {
@@ -326,9 +423,9 @@ TemporaryFileIndex TemporaryFileManager::GetTempBlockIndex(TemporaryManagerLock
 	return used_blocks[id];
 }
 
-void TemporaryFileManager::EraseFileHandle(TemporaryManagerLock &, idx_t file_index) {
-	files.erase(file_index);
-	index_manager.RemoveIndex(file_index);
+void TemporaryFileManager::EraseFileHandle(TemporaryManagerLock &, TemporaryFileIdentifier identifier) {
+	files[identifier.size].erase(identifier.file_index);
+	index_managers[identifier.size].RemoveIndex(identifier.file_index);
 }
 
 } // namespace duckdb
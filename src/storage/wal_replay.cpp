@@ -25,6 +25,12 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/task_error_manager.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
 
@@ -39,6 +45,8 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! The offset in the WAL up to which it contains complete (flushed) transactions
+	idx_t flushed_offset = 0;
 };
 
 class WriteAheadLogDeserializer {
@@ -63,8 +71,15 @@ public:
 			throw IOException("Failed to read WAL of version %llu - can only read version 1 and 2",
 			                  state_p.wal_version);
 		}
+		idx_t size;
+		auto buffer = ReadEntry(stream, size);
+		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+	}
+
+	//! Read a checksummed (version 2) entry from the WAL and verify its checksum
+	static unique_ptr<data_t[]> ReadEntry(BufferedFileReader &stream, idx_t &size) {
 		// read the checksum and size
-		auto size = stream.Read<uint64_t>();
+		size = stream.Read<uint64_t>();
 		auto stored_checksum = stream.Read<uint64_t>();
 		auto offset = stream.CurrentOffset();
 		auto file_size = stream.FileSize();
@@ -88,7 +103,7 @@ public:
 			    "stored checksum %llu",
 			    offset, computed_checksum, stored_checksum);
 		}
-		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+		return buffer;
 	}
 
 	bool ReplayEntry() {
@@ -98,6 +113,11 @@ public:
 			deserializer.End();
 			return true;
 		}
+		if (deserialize_only && data && wal_type != WALType::WAL_VERSION && wal_type != WALType::CHECKPOINT) {
+			// the initial read only looks for the checkpoint flag - checksummed entries are read as a whole, so we
+			// don't need to decode the remainder of the entry to get to the next one
+			return false;
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -155,12 +175,450 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Parallel Replay
+//===--------------------------------------------------------------------===//
+//! The amount of WAL data that is read (and decoded) at a time
+static constexpr idx_t WAL_REPLAY_BATCH_SIZE = 16ULL * 1024ULL * 1024ULL;
+//! The amount of WAL data that is decoded by a single task
+static constexpr idx_t WAL_DECODE_TASK_SIZE = 1024ULL * 1024ULL;
+
+class WALReplayTaskState {
+public:
+	explicit WALReplayTaskState(TaskScheduler &scheduler)
+	    : scheduler(scheduler), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0) {
+	}
+
+	TaskScheduler &scheduler;
+
+public:
+	void ScheduleTask(shared_ptr<Task> task) {
+		++total_tasks;
+		scheduler.ScheduleTask(*token, std::move(task));
+	}
+	void FinishTask() {
+		++completed_tasks;
+	}
+	void PushError(ErrorData error) {
+		error_manager.PushError(std::move(error));
+	}
+	bool HasError() {
+		return error_manager.HasError();
+	}
+	//! Work on the scheduled tasks until all of them have finished, then throw the first error that occurred (if any)
+	void Finish() {
+		shared_ptr<Task> task;
+		while (completed_tasks < total_tasks) {
+			if (scheduler.GetTaskFromProducer(*token, task)) {
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
+				task.reset();
+			}
+		}
+		if (error_manager.HasError()) {
+			error_manager.ThrowException();
+		}
+	}
+
+private:
+	TaskErrorManager error_manager;
+	unique_ptr<ProducerToken> token;
+	atomic<idx_t> completed_tasks;
+	atomic<idx_t> total_tasks;
+};
+
+class BaseWALReplayTask : public Task {
+public:
+	explicit BaseWALReplayTask(WALReplayTaskState &replay_state) : replay_state(replay_state) {
+	}
+
+	virtual void ExecuteTask() = 0;
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		if (!replay_state.HasError()) {
+			try {
+				ExecuteTask();
+			} catch (std::exception &ex) {
+				replay_state.PushError(ErrorData(ex));
+			} catch (...) { // LCOV_EXCL_START
+				replay_state.PushError(ErrorData("Unknown exception during WAL replay!"));
+			} // LCOV_EXCL_STOP
+		}
+		replay_state.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+protected:
+	WALReplayTaskState &replay_state;
+};
+
+//! An entry that has been read from the WAL, but not yet replayed
+struct WALReplayEntry {
+	unique_ptr<data_t[]> data;
+	idx_t size = 0;
+	//! The type of the entry - set when the entry is decoded
+	WALType type = WALType::INVALID;
+	//! The chunk of an insert - inserts are decoded up front, all other entries are deserialized while replaying
+	unique_ptr<DataChunk> chunk;
+};
+
+//! A batch of entries read from the WAL. Decoding a batch happens in parallel to replaying the previous batch.
+struct WALReplayBatch {
+	explicit WALReplayBatch(TaskScheduler &scheduler) : decode_state(scheduler) {
+	}
+
+	vector<WALReplayEntry> entries;
+	WALReplayTaskState decode_state;
+};
+
+class WALDecodeTask : public BaseWALReplayTask {
+public:
+	WALDecodeTask(shared_ptr<WALReplayBatch> batch_p, idx_t start, idx_t end)
+	    : BaseWALReplayTask(batch_p->decode_state), batch(std::move(batch_p)), start(start), end(end) {
+	}
+
+	void ExecuteTask() override {
+		for (idx_t i = start; i < end; i++) {
+			auto &entry = batch->entries[i];
+			MemoryStream stream(entry.data.get(), entry.size);
+			BinaryDeserializer deserializer(stream);
+			deserializer.Begin();
+			entry.type = deserializer.ReadProperty<WALType>(100, "wal_type");
+			if (entry.type != WALType::INSERT_TUPLE) {
+				continue;
+			}
+			entry.chunk = make_uniq<DataChunk>();
+			deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { entry.chunk->Deserialize(object); });
+			deserializer.End();
+		}
+	}
+
+private:
+	//! The task keeps the batch (and the producer of its decode state) alive
+	shared_ptr<WALReplayBatch> batch;
+	idx_t start;
+	idx_t end;
+};
+
+//! The inserts into a single table that are replayed together
+struct WALTableInserts {
+	explicit WALTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<reference<DataChunk>> chunks;
+	LocalAppendState append_state;
+};
+
+//! The indexes of a table that are rebuilt once the inserts into the table have been replayed
+struct WALDeferredIndexes {
+	explicit WALDeferredIndexes(DataTable &storage) : storage(storage) {
+	}
+
+	DataTable &storage;
+	TableIndexList indexes;
+};
+
+class WALInsertTask : public BaseWALReplayTask {
+public:
+	WALInsertTask(shared_ptr<WALReplayTaskState> insert_state_p, ClientContext &context, WALTableInserts &inserts)
+	    : BaseWALReplayTask(*insert_state_p), insert_state(std::move(insert_state_p)), context(context),
+	      inserts(inserts) {
+	}
+
+	void ExecuteTask() override {
+		auto &storage = inserts.table.GetStorage();
+		for (auto &chunk : inserts.chunks) {
+			// the constraints were verified when the transaction originally committed
+			storage.LocalAppend(inserts.append_state, inserts.table, context, chunk.get(), true);
+		}
+	}
+
+private:
+	//! The scheduler might still refer to the producer of the state after the task has finished
+	shared_ptr<WALReplayTaskState> insert_state;
+	ClientContext &context;
+	WALTableInserts &inserts;
+};
+
+//! Replays a checksummed WAL. Entries are read in batches, and the next batch is decoded in parallel while the
+//! current batch is replayed. Inserts into different tables are appended in parallel, and consecutive transactions
+//! that only insert are replayed as a single transaction. The indexes of the tables that are inserted into are not
+//! maintained while replaying: they are rebuilt in bulk from the committed rows once the replay is done, or before a
+//! catalog change that might depend on them.
+class WALParallelReplay {
+public:
+	WALParallelReplay(Connection &con, ReplayState &state, BufferedFileReader &reader)
+	    : con(con), state(state), context(*con.context), reader(reader),
+	      scheduler(TaskScheduler::GetScheduler(context)) {
+	}
+
+	void Replay() {
+		// the version entry is not checksummed - replay it first
+		auto version_deserializer = WriteAheadLogDeserializer::Open(state, reader);
+		version_deserializer.ReplayEntry();
+
+		auto batch = ReadBatch();
+		while (batch) {
+			batch->decode_state.Finish();
+			auto next_batch = ReadBatch();
+			try {
+				ReplayBatch(*batch);
+			} catch (...) {
+				RebuildIndexesAfterError();
+				if (next_batch) {
+					// wait for the next batch to be decoded before bailing out
+					try {
+						next_batch->decode_state.Finish();
+					} catch (...) { // NOLINT
+					}
+				}
+				throw;
+			}
+			batch = std::move(next_batch);
+		}
+		con.Commit();
+		RebuildIndexes();
+	}
+
+	//! Rebuild the deferred indexes when the replay fails, so the database is not left without them
+	void RebuildIndexesAfterError() {
+		try {
+			RebuildIndexes();
+		} catch (...) { // NOLINT
+		}
+	}
+
+private:
+	//! Read the next batch of entries from the WAL and schedule decoding it
+	shared_ptr<WALReplayBatch> ReadBatch() {
+		if (reader.CurrentOffset() >= state.flushed_offset) {
+			return nullptr;
+		}
+		auto batch = make_shared<WALReplayBatch>(scheduler);
+		idx_t batch_size = 0;
+		while (reader.CurrentOffset() < state.flushed_offset && batch_size < WAL_REPLAY_BATCH_SIZE) {
+			WALReplayEntry entry;
+			entry.data = WriteAheadLogDeserializer::ReadEntry(reader, entry.size);
+			batch_size += entry.size;
+			batch->entries.push_back(std::move(entry));
+		}
+		idx_t task_start = 0;
+		idx_t task_size = 0;
+		for (idx_t i = 0; i < batch->entries.size(); i++) {
+			task_size += batch->entries[i].size;
+			if (task_size >= WAL_DECODE_TASK_SIZE || i + 1 == batch->entries.size()) {
+				batch->decode_state.ScheduleTask(make_shared<WALDecodeTask>(batch, task_start, i + 1));
+				task_start = i + 1;
+				task_size = 0;
+			}
+		}
+		return batch;
+	}
+
+	//! Whether or not the entry can be replayed in the same transaction as the preceding transactions in the WAL.
+	//! Entries that refer to row ids or to the stored state of the database require everything before them to be
+	//! committed.
+	static bool CanReplayInSameTransaction(WALType type) {
+		switch (type) {
+		case WALType::CREATE_TABLE:
+		case WALType::CREATE_SCHEMA:
+		case WALType::CREATE_VIEW:
+		case WALType::CREATE_SEQUENCE:
+		case WALType::SEQUENCE_VALUE:
+		case WALType::CREATE_MACRO:
+		case WALType::CREATE_TYPE:
+		case WALType::CREATE_TABLE_MACRO:
+		case WALType::USE_TABLE:
+		case WALType::INSERT_TUPLE:
+		case WALType::WAL_VERSION:
+		case WALType::CHECKPOINT:
+		case WALType::WAL_FLUSH:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	void ReplayBatch(WALReplayBatch &batch) {
+		for (auto &entry : batch.entries) {
+			switch (entry.type) {
+			case WALType::INSERT_TUPLE:
+				AddInsert(*entry.chunk);
+				continue;
+			case WALType::USE_TABLE:
+			case WALType::SEQUENCE_VALUE:
+				break;
+			case WALType::WAL_FLUSH:
+				if (commit_on_flush) {
+					// the original transaction has to be committed on its own
+					CommitTransaction();
+				}
+				break;
+			default:
+				// any other entry might depend on the inserts replayed so far
+				FlushInserts();
+				break;
+			}
+			if (!CanReplayInSameTransaction(entry.type)) {
+				CommitTransaction();
+				if (entry.type != WALType::DELETE_TUPLE && entry.type != WALType::UPDATE_TUPLE) {
+					// catalog changes (e.g. ALTER, CREATE INDEX or DROP INDEX) see the indexes in their final state
+					RebuildIndexes();
+				}
+				// the remainder of the original transaction is committed before the next transaction is replayed
+				commit_on_flush = true;
+			}
+			WriteAheadLogDeserializer deserializer(state, std::move(entry.data), entry.size);
+			deserializer.ReplayEntry();
+		}
+		// the chunks are owned by the batch: append them before moving on to the next batch
+		FlushInserts();
+	}
+
+	void AddInsert(DataChunk &chunk) {
+		if (!state.current_table) {
+			throw InternalException("Corrupt WAL: insert without table");
+		}
+		auto &table = *state.current_table;
+		if (!table.GetStorage().info->indexes.Empty() && !DeferIndexes(table)) {
+			// unique constraints are only verified when the transaction commits: inserts into indexed tables cannot be
+			// merged with later transactions, as these might re-insert keys that this transaction deletes
+			// these indexes are therefore maintained once per original transaction, as in a sequential replay
+			commit_on_flush = true;
+		}
+		auto entry = table_inserts.find(table);
+		if (entry == table_inserts.end()) {
+			entry = table_inserts.insert(make_pair(std::ref(table), inserts.size())).first;
+			inserts.push_back(make_uniq<WALTableInserts>(table));
+		}
+		inserts[entry->second]->chunks.push_back(chunk);
+	}
+
+	//! Commit everything replayed so far and start a new transaction
+	void CommitTransaction() {
+		FlushInserts();
+		con.Commit();
+		con.BeginTransaction();
+		commit_on_flush = false;
+	}
+
+	//! Append the pending inserts, appending to different tables in parallel
+	void FlushInserts() {
+		if (inserts.empty()) {
+			return;
+		}
+		for (auto &table_insert : inserts) {
+			table_insert->table.GetStorage().InitializeLocalAppend(table_insert->append_state, context);
+		}
+		auto insert_state = make_shared<WALReplayTaskState>(scheduler);
+		for (auto &table_insert : inserts) {
+			insert_state->ScheduleTask(make_shared<WALInsertTask>(insert_state, context, *table_insert));
+		}
+		insert_state->Finish();
+		for (auto &table_insert : inserts) {
+			table_insert->table.GetStorage().FinalizeLocalAppend(table_insert->append_state);
+		}
+		inserts.clear();
+		table_inserts.clear();
+	}
+
+	//! Detach the indexes of the table, so the inserts are appended without maintaining them. Returns false if the
+	//! indexes cannot be rebuilt from the table: indexes of other types than ART, and indexes that are used to verify
+	//! foreign keys, are maintained while replaying
+	bool DeferIndexes(TableCatalogEntry &table) {
+		for (auto &constraint : table.GetBoundConstraints()) {
+			if (constraint->type == ConstraintType::FOREIGN_KEY) {
+				return false;
+			}
+		}
+		auto &storage = table.GetStorage();
+		bool can_rebuild = true;
+		storage.info->indexes.Scan([&](Index &index) {
+			if (index.IsUnknown() || index.index_type != ART::TYPE_NAME) {
+				can_rebuild = false;
+				return true;
+			}
+			return false;
+		});
+		if (!can_rebuild) {
+			return false;
+		}
+		auto deferred = make_uniq<WALDeferredIndexes>(storage);
+		deferred->indexes.Move(storage.info->indexes);
+		deferred_indexes.push_back(std::move(deferred));
+		return true;
+	}
+
+	//! Rebuild the detached indexes from the committed rows of their tables and attach them again
+	void RebuildIndexes() {
+		for (auto &deferred : deferred_indexes) {
+			auto &storage = deferred->storage;
+			deferred->indexes.Scan([&](Index &index) {
+				index.CommitDrop();
+				return false;
+			});
+
+			// scan all columns of the table, followed by the row ids
+			auto types = storage.GetTypes();
+			vector<column_t> column_ids;
+			for (idx_t i = 0; i < types.size(); i++) {
+				column_ids.push_back(i);
+			}
+			auto table_columns = column_ids;
+			auto scan_types = types;
+			column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			scan_types.push_back(LogicalType::ROW_TYPE);
+
+			DataChunk scan_chunk;
+			scan_chunk.Initialize(Allocator::Get(context), scan_types);
+			DataChunk table_chunk;
+			table_chunk.InitializeEmpty(types);
+
+			CreateIndexScanState scan_state;
+			storage.InitializeScan(scan_state, column_ids);
+			while (true) {
+				scan_chunk.Reset();
+				storage.CreateIndexScan(scan_state, scan_chunk,
+				                        TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+				if (scan_chunk.size() == 0) {
+					break;
+				}
+				table_chunk.ReferenceColumns(scan_chunk, table_columns);
+				auto &row_identifiers = scan_chunk.data[types.size()];
+				deferred->indexes.Scan([&](Index &index) {
+					auto error = index.Append(table_chunk, row_identifiers);
+					if (error.HasError()) {
+						error.Throw();
+					}
+					return false;
+				});
+			}
+			storage.info->indexes.Move(deferred->indexes);
+		}
+		deferred_indexes.clear();
+	}
+
+private:
+	Connection &con;
+	ReplayState &state;
+	ClientContext &context;
+	BufferedFileReader &reader;
+	TaskScheduler &scheduler;
+	//! The pending inserts, per table
+	vector<unique_ptr<WALTableInserts>> inserts;
+	reference_map_t<TableCatalogEntry, idx_t> table_inserts;
+	//! The indexes that are detached from their tables until they are rebuilt
+	vector<unique_ptr<WALDeferredIndexes>> deferred_indexes;
+	//! Whether the current transaction has to be committed at the end of the original transaction (WAL_FLUSH)
+	bool commit_on_flush = false;
+};
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
-bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle) {
+bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle, idx_t &complete_size) {
 	Connection con(database.GetDatabase());
 	BufferedFileReader reader(FileSystem::Get(database), std::move(handle));
+	complete_size = 0;
 	if (reader.Finished()) {
 		// WAL is empty
 		return false;
@@ -176,6 +634,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			// read the current entry (deserialize only)
 			auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
 			if (deserializer.ReplayEntry()) {
+				checkpoint_state.flushed_offset = reader.CurrentOffset();
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -190,12 +649,15 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			// continue reading
 		} else {
 			Printer::PrintF("Exception in WAL playback during initial read: %s\n", error.RawMessage());
+			complete_size = checkpoint_state.flushed_offset;
 			return false;
 		}
 	} catch (...) {
 		Printer::Print("Unknown Exception in WAL playback during initial read");
+		complete_size = checkpoint_state.flushed_offset;
 		return false;
 	} // LCOV_EXCL_STOP
+	complete_size = checkpoint_state.flushed_offset;
 	if (checkpoint_state.checkpoint_id.IsValid()) {
 		// there is a checkpoint flag: check if we need to deserialize the WAL
 		auto &manager = database.GetStorageManager();
@@ -217,6 +679,16 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	// there can be errors in WAL replay because of a corrupt WAL file
 	// in this case we should throw a warning but startup anyway
 	try {
+		if (checkpoint_state.wal_version != 1) {
+			// checksummed WAL: we know where the last complete transaction ends, replay up to there in parallel
+			state.flushed_offset = checkpoint_state.flushed_offset;
+			// the catalog has been loaded at this point: launch the threads so they can help replaying
+			// the worker threads only decode and append, all catalog changes are replayed by this thread
+			TaskScheduler::GetScheduler(*con.context).RelaunchThreads();
+			WALParallelReplay replay(con, state, reader);
+			replay.Replay();
+			return false;
+		}
 		while (true) {
 			// read the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
@@ -10,6 +10,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/storage/index.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
@@ -19,7 +20,9 @@ namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
-WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path) : skip_writing(false), database(database) {
+WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path)
+    : skip_writing(false), database(database), sync_in_progress(false), pending_syncs(0), flushed_position(0),
+      synced_position(0) {
 	wal_path = path;
 	writer = make_uniq<BufferedFileWriter>(FileSystem::Get(database), path,
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
@@ -27,6 +30,14 @@ WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path) : s
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	if (!writer) {
+		return;
+	}
+	// with synchronous=off, the last commits might still be sitting in the buffer
+	try {
+		writer->Flush();
+	} catch (...) { // NOLINT
+	}
 }
 
 int64_t WriteAheadLog::GetWALSize() {
@@ -39,7 +50,16 @@ idx_t WriteAheadLog::GetTotalWritten() {
 	return writer->GetTotalWritten();
 }
 
+void WriteAheadLog::WaitForPendingSyncs(unique_lock<mutex> &guard) {
+	// committers only enter SyncCommit after writing their commit, and leave it once the commit is synced: after a
+	// checkpoint has flushed the WAL this does not have to wait for any further syncs
+	sync_cv.wait(guard, [&]() { return pending_syncs == 0; });
+}
+
 void WriteAheadLog::Truncate(int64_t size) {
+	// wait for the committers that are syncing the WAL before modifying the file
+	unique_lock<mutex> guard(sync_lock);
+	WaitForPendingSyncs(guard);
 	writer->Truncate(size);
 }
 
@@ -47,12 +67,42 @@ void WriteAheadLog::Delete() {
 	if (!writer) {
 		return;
 	}
-	writer.reset();
+	{
+		unique_lock<mutex> guard(sync_lock);
+		WaitForPendingSyncs(guard);
+		// the WAL is only deleted after a checkpoint: all commits are durable in the database file
+		synced_position = MaxValue<idx_t>(synced_position, flushed_position);
+		writer.reset();
+	}
 
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
 }
 
+void WriteAheadLog::Move(const string &new_path) {
+	D_ASSERT(writer);
+	unique_lock<mutex> guard(sync_lock);
+	WaitForPendingSyncs(guard);
+	// close the file before moving it, and continue counting from where we were: the sync positions of the
+	// committers refer to the total number of bytes written
+	auto total_written = writer->GetTotalWritten();
+	writer->Flush();
+	writer.reset();
+
+	auto &fs = FileSystem::Get(database);
+	auto open_flags = FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE | FileFlags::FILE_FLAGS_APPEND;
+	try {
+		fs.MoveFile(wal_path, new_path);
+	} catch (...) {
+		writer = make_uniq<BufferedFileWriter>(fs, wal_path, open_flags);
+		writer->total_written = total_written;
+		throw;
+	}
+	wal_path = new_path;
+	writer = make_uniq<BufferedFileWriter>(fs, wal_path, open_flags);
+	writer->total_written = total_written;
+}
+
 //===--------------------------------------------------------------------===//
 // Serializer
 //===--------------------------------------------------------------------===//
@@ -138,18 +188,28 @@ private:
 //===--------------------------------------------------------------------===//
 // Write Entries
 //===--------------------------------------------------------------------===//
+static void WriteVersionMarker(WriteStream &stream) {
+	// note that we explicitly do not checksum the version entry
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	serializer.WriteProperty(100, "wal_type", WALType::WAL_VERSION);
+	serializer.WriteProperty(101, "version", idx_t(WAL_VERSION_NUMBER));
+	serializer.End();
+}
+
 void WriteAheadLog::WriteVersion() {
 	if (writer->GetFileSize() > 0) {
 		// already written - no need to write a version marker
 		return;
 	}
 	// write the version marker
-	// note that we explicitly do not checksum the version entry
-	BinarySerializer serializer(*writer);
-	serializer.Begin();
-	serializer.WriteProperty(100, "wal_type", WALType::WAL_VERSION);
-	serializer.WriteProperty(101, "version", idx_t(WAL_VERSION_NUMBER));
-	serializer.End();
+	WriteVersionMarker(*writer);
+}
+
+idx_t WriteAheadLog::VersionMarkerSize() {
+	MemoryStream stream;
+	WriteVersionMarker(stream);
+	return stream.GetPosition();
 }
 
 void WriteAheadLog::WriteCheckpoint(MetaBlockPointer meta_block) {
@@ -246,6 +306,9 @@ void WriteAheadLog::WriteDropTableMacro(const TableMacroCatalogEntry &entry) {
 
 void SerializeIndexToWAL(WriteAheadLogSerializer &serializer, const unique_ptr<Index> &index) {
 
+	// the buffers point into the index, so we hold its lock until they are written
+	IndexLock index_lock;
+	index->InitializeLock(index_lock);
 	auto index_storage_info = index->GetStorageInfo(true);
 	serializer.WriteProperty(102, "index_storage_info", index_storage_info);
 
@@ -392,6 +455,71 @@ void WriteAheadLog::Flush() {
 
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_position = MaxValue<idx_t>(synced_position, writer->GetTotalWritten());
+	sync_cv.notify_all();
+}
+
+idx_t WriteAheadLog::FlushCommit() {
+	if (skip_writing) {
+		return 0;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	switch (DBConfig::Get(database).options.synchronous) {
+	case WALSynchronousMode::OFF:
+		// leave the commit in the buffer: it is written once the buffer is full, or on checkpoint
+		return 0;
+	case WALSynchronousMode::NORMAL:
+		// hand the commit to the OS: it survives a crash of the process, but not of the machine
+		writer->Flush();
+		return 0;
+	default:
+		// write the commit to the file, the caller syncs it after releasing the transaction lock
+		writer->Flush();
+		flushed_position = writer->GetTotalWritten();
+		return flushed_position;
+	}
+}
+
+void WriteAheadLog::SyncCommit(idx_t position) {
+	unique_lock<mutex> guard(sync_lock);
+	if (!writer) {
+		// the WAL was deleted after a checkpoint: the commit is durable in the database file
+		return;
+	}
+	pending_syncs++;
+	while (synced_position < position) {
+		if (sync_in_progress) {
+			// another committer is syncing the WAL - wait for it, it might have covered our commit as well
+			sync_cv.wait(guard);
+			continue;
+		}
+		// sync everything that has been written so far - this includes the commits of all transactions that
+		// finished writing to the WAL while the previous sync was running
+		idx_t sync_position = flushed_position;
+		sync_in_progress = true;
+		guard.unlock();
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			pending_syncs--;
+			sync_cv.notify_all();
+			throw;
+		}
+		guard.lock();
+		sync_in_progress = false;
+		synced_position = MaxValue<idx_t>(synced_position, sync_position);
+		sync_cv.notify_all();
+	}
+	pending_syncs--;
+	sync_cv.notify_all();
 }
 
 } // namespace duckdb
@@ -0,0 +1,101 @@
+#include "duckdb/transaction/background_checkpointer.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+BackgroundCheckpointer::BackgroundCheckpointer(DuckTransactionManager &manager)
+    : manager(manager), checkpoint_requested(false), transaction_finished(false), shutdown(false),
+      last_checkpoint(time_point<steady_clock>::min()) {
+	checkpoint_thread = make_uniq<thread>([this]() { Run(); });
+}
+
+BackgroundCheckpointer::~BackgroundCheckpointer() {
+	Stop();
+}
+
+void BackgroundCheckpointer::RequestCheckpoint() {
+	lock_guard<mutex> guard(lock);
+	if (checkpoint_requested) {
+		return;
+	}
+	checkpoint_requested = true;
+	requested_at = steady_clock::now();
+	cv.notify_one();
+}
+
+void BackgroundCheckpointer::TransactionFinished() {
+	lock_guard<mutex> guard(lock);
+	if (!checkpoint_requested) {
+		return;
+	}
+	transaction_finished = true;
+	cv.notify_one();
+}
+
+void BackgroundCheckpointer::Stop() {
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+		cv.notify_one();
+	}
+	if (checkpoint_thread && checkpoint_thread->joinable()) {
+		checkpoint_thread->join();
+	}
+}
+
+void BackgroundCheckpointer::Run() {
+	auto &db = manager.GetDB();
+	unique_lock<mutex> guard(lock);
+	while (true) {
+		cv.wait(guard, [&]() { return shutdown || checkpoint_requested; });
+		if (shutdown) {
+			return;
+		}
+		// pace the checkpoints: wait until the minimum interval since the previous checkpoint has passed
+		auto &options = DBConfig::Get(db).options;
+		auto next_checkpoint = last_checkpoint + milliseconds(options.background_checkpoint_interval);
+		if (steady_clock::now() < next_checkpoint) {
+			cv.wait_until(guard, next_checkpoint, [&]() { return shutdown; });
+			if (shutdown) {
+				return;
+			}
+		}
+		// once the checkpoint has been postponed for longer than the timeout, it takes precedence over new writers
+		auto due = MaxValue(next_checkpoint, requested_at);
+		auto overdue = due + milliseconds(options.background_checkpoint_timeout);
+		auto wait_for_writers = steady_clock::now() >= overdue;
+		transaction_finished = false;
+		guard.unlock();
+
+		bool checkpointed;
+		try {
+			checkpointed = manager.BackgroundCheckpoint(wait_for_writers);
+		} catch (std::exception &ex) {
+			// a failed checkpoint leaves the database in an unknown state: invalidate it
+			ErrorData error(ex);
+			ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+			return;
+		}
+
+		guard.lock();
+		if (checkpointed) {
+			checkpoint_requested = false;
+			last_checkpoint = steady_clock::now();
+			continue;
+		}
+		// other transactions prevented the checkpoint: retry once one of them has finished, or once the checkpoint
+		// is overdue
+		if (wait_for_writers) {
+			cv.wait(guard, [&]() { return shutdown || transaction_finished; });
+		} else {
+			cv.wait_until(guard, overdue, [&]() { return shutdown || transaction_finished; });
+		}
+	}
+}
+
+} // namespace duckdb
@@ -7,6 +7,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 #include "duckdb/transaction/append_info.hpp"
 #include "duckdb/transaction/delete_info.hpp"
@@ -16,6 +17,7 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -29,7 +31,8 @@ TransactionData::TransactionData(transaction_t transaction_id_p, transaction_t s
 DuckTransaction::DuckTransaction(TransactionManager &manager, ClientContext &context_p, transaction_t start_time,
                                  transaction_t transaction_id)
     : Transaction(manager, context_p), start_time(start_time), transaction_id(transaction_id), commit_id(0),
-      highest_active_query(0), undo_buffer(context_p), storage(make_uniq<LocalStorage>(context_p, *this)) {
+      highest_active_query(0), wal_sync_position(0), undo_buffer(context_p),
+      storage(make_uniq<LocalStorage>(context_p, *this)) {
 }
 
 DuckTransaction::~DuckTransaction() {
@@ -102,10 +105,36 @@ UpdateInfo *DuckTransaction::CreateUpdateInfo(idx_t type_size, idx_t entries) {
 	return update_info;
 }
 
+void DuckTransaction::SetReadWrite() {
+	if (!write_lock) {
+		auto &transaction_manager = DuckTransactionManager::Get(manager.GetDB());
+		write_lock = transaction_manager.SharedWriteLock(storage->HoldsWriteLock());
+		modified_in_place = true;
+	}
+}
+
+shared_ptr<StorageLockKey> DuckTransaction::SharedLockTable(DataTableInfo &info) {
+	lock_guard<mutex> guard(active_locks_lock);
+	auto entry = active_locks.find(info);
+	if (entry != active_locks.end()) {
+		auto lock = entry->second.lock();
+		if (lock) {
+			return lock;
+		}
+	}
+	shared_ptr<StorageLockKey> lock = info.checkpoint_lock.GetSharedLock();
+	active_locks[info] = lock;
+	return lock;
+}
+
 bool DuckTransaction::ChangesMade() {
 	return undo_buffer.ChangesMade() || storage->ChangesMade();
 }
 
+bool DuckTransaction::ChangesMadeInPlace() {
+	return undo_buffer.ChangesMade();
+}
+
 bool DuckTransaction::AutomaticCheckpoint(AttachedDatabase &db) {
 	auto &storage_manager = db.GetStorageManager();
 	return storage_manager.AutomaticCheckpoint(storage->EstimatedSize() + undo_buffer.EstimatedSize());
@@ -140,7 +169,7 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t commit_id,
 			}
 		}
 		if (storage_commit_state) {
-			storage_commit_state->FlushCommit();
+			wal_sync_position = storage_commit_state->FlushCommit();
 		}
 		return ErrorData();
 	} catch (std::exception &ex) {
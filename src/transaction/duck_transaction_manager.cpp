@@ -1,6 +1,7 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 
 #include "duckdb/catalog/catalog_set.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
@@ -8,11 +9,15 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
+#include "duckdb/transaction/background_checkpointer.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -43,7 +48,8 @@ struct CheckpointLock {
 };
 
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
-    : TransactionManager(db), thread_is_checkpointing(false) {
+    : TransactionManager(db), thread_is_checkpointing(false), background_checkpoint_running(false),
+      checkpoint_number(0) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
 	// transaction ID starts very high:
@@ -56,6 +62,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -148,6 +155,90 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint();
 }
 
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	optional_ptr<BackgroundCheckpointer> checkpointer;
+	{
+		lock_guard<mutex> lock(transaction_lock);
+		checkpointer = background_checkpointer.get();
+	}
+	if (checkpointer) {
+		checkpointer->Stop();
+	}
+}
+
+unique_ptr<StorageLockKey> DuckTransactionManager::SharedWriteLock(bool already_held) {
+	return already_held ? write_lock.AddSharedLock() : write_lock.GetSharedLock();
+}
+
+unique_ptr<StorageLockKey> DuckTransactionManager::TrySharedWriteLock() {
+	return write_lock.TryGetSharedLock();
+}
+
+void DuckTransactionManager::TableCheckpointed(DataTableInfo &info) {
+	lock_guard<mutex> lock(transaction_lock);
+	info.checkpoint_number = checkpoint_number;
+	checkpoint_progress.notify_all();
+}
+
+bool DuckTransactionManager::WaitForCheckpoint(DuckTransaction &transaction) {
+	if (!background_checkpoint_running) {
+		return false;
+	}
+	for (auto &table : transaction.GetLocalStorage().GetTables()) {
+		if (table.get().info->checkpoint_number != checkpoint_number) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool DuckTransactionManager::BackgroundCheckpoint(bool wait_for_writers) {
+	auto exclusive_write_lock = wait_for_writers ? write_lock.GetExclusiveLock() : write_lock.TryGetExclusiveLock();
+	if (!exclusive_write_lock) {
+		return false;
+	}
+	auto &storage_manager = db.GetStorageManager();
+	{
+		lock_guard<mutex> lock(transaction_lock);
+		// the checkpoint writes out the row versions of updates: it cannot run while transactions might need the
+		// versions of rows that were modified in place. The insert versions of appended rows are kept
+		auto modified_in_place = [](const unique_ptr<DuckTransaction> &transaction) {
+			return transaction->modified_in_place;
+		};
+		if (thread_is_checkpointing ||
+		    std::any_of(recently_committed_transactions.begin(), recently_committed_transactions.end(),
+		                modified_in_place) ||
+		    std::any_of(old_transactions.begin(), old_transactions.end(), modified_in_place)) {
+			return false;
+		}
+		thread_is_checkpointing = true;
+		// transactions that commit while the checkpoint runs write to a new WAL
+		storage_manager.BeginConcurrentCheckpoint();
+		background_checkpoint_running = true;
+		checkpoint_number++;
+	}
+	auto end_checkpoint = [&]() {
+		thread_is_checkpointing = false;
+		background_checkpoint_running = false;
+		checkpoint_progress.notify_all();
+	};
+	// no transaction can modify the database in place while we hold the write lock: checkpoint without holding the
+	// transaction lock, so that transactions can start and read the database in the meantime, and can commit appends
+	// to the tables that have been written
+	// commits that happened since the checkpoint was requested are in the WAL, so there is no need to force it
+	try {
+		storage_manager.CreateCheckpoint(false, false, true);
+		lock_guard<mutex> lock(transaction_lock);
+		storage_manager.FinishConcurrentCheckpoint();
+		end_checkpoint();
+	} catch (...) {
+		lock_guard<mutex> lock(transaction_lock);
+		end_checkpoint();
+		throw;
+	}
+	return true;
+}
+
 DuckTransactionManager::CheckpointDecision
 DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 	if (db.IsSystem()) {
@@ -171,6 +262,9 @@ DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 		                   StringUtil::Join(old_transactions, old_transactions.size(), ",", trans_to_string) + "]"};
 	}
 
+	if (!current && !active_transactions.empty()) {
+		return {false, "there are active transactions"};
+	}
 	for (auto &transaction : active_transactions) {
 		if (transaction.get() != current.get()) {
 			return {false, "current transaction [" + std::to_string(current->transaction_id) + "] isn't active"};
@@ -181,17 +275,36 @@ DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
+	if (!transaction.write_lock && transaction.ChangesMadeInPlace()) {
+		// in-place changes cannot be committed while a background checkpoint runs
+		transaction.SetReadWrite();
+	}
 	vector<ClientLockWrapper> client_locks;
-	auto lock = make_uniq<lock_guard<mutex>>(transaction_lock);
+	unique_lock<mutex> lock(transaction_lock);
+	if (!transaction.write_lock) {
+		// appends can be committed while a background checkpoint runs - but only to tables that it has written
+		checkpoint_progress.wait(lock, [&]() { return !WaitForCheckpoint(transaction); });
+	}
 	CheckpointLock checkpoint_lock(*this);
 	// check if we can checkpoint
 	auto checkpoint_decision = thread_is_checkpointing ? CheckpointDecision {false, "another thread is checkpointing"}
 	                                                   : CanCheckpoint(&transaction);
-	if (checkpoint_decision.can_checkpoint) {
-		if (transaction.AutomaticCheckpoint(db)) {
-			checkpoint_lock.Lock();
-		} else {
+	if (!thread_is_checkpointing && DBConfig::Get(db).options.background_checkpoint) {
+		// hand the checkpoint to the background thread instead of performing it as part of this commit: it runs once
+		// the transactions that prevent it have finished, so other transactions can be active
+		checkpoint_decision = {false, "no reason to automatically checkpoint"};
+		if (!db.IsSystem() && transaction.AutomaticCheckpoint(db)) {
+			if (!background_checkpointer) {
+				background_checkpointer = make_uniq<BackgroundCheckpointer>(*this);
+			}
+			background_checkpointer->RequestCheckpoint();
+			checkpoint_decision = {false, "checkpoint scheduled in the background"};
+		}
+	} else if (checkpoint_decision.can_checkpoint) {
+		if (!transaction.AutomaticCheckpoint(db)) {
 			checkpoint_decision = {false, "no reason to automatically checkpoint"};
+		} else {
+			checkpoint_lock.Lock();
 		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
@@ -212,6 +325,12 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		client_locks.clear();
 	}
 
+	auto wal_sync_position = error.HasError() ? 0 : transaction.wal_sync_position;
+	// keep the WAL alive while syncing it: a checkpoint can delete it once we release the transaction lock
+	shared_ptr<WriteAheadLog> wal;
+	if (wal_sync_position > 0) {
+		wal = db.GetStorageManager().GetSharedWriteAheadLog();
+	}
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	RemoveTransaction(transaction);
@@ -221,10 +340,27 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		// checkpoint the database to disk
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(false, true);
+	} else if (wal) {
+		// sync the WAL after releasing the transaction lock, so that transactions committing in the meantime can
+		// share the sync with this one
+		lock.unlock();
+		error = SyncCommit(*wal, wal_sync_position);
 	}
 	return error;
 }
 
+ErrorData DuckTransactionManager::SyncCommit(WriteAheadLog &log, idx_t wal_sync_position) {
+	try {
+		log.SyncCommit(wal_sync_position);
+		return ErrorData();
+	} catch (std::exception &ex) {
+		// the commit is already visible to other transactions: we cannot roll it back anymore
+		ErrorData error(ex);
+		ValidChecker::Invalidate(db.GetDatabase(), "Failed to sync the WAL: " + error.RawMessage());
+		return error;
+	}
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
@@ -240,6 +376,9 @@ void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 
 void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction) noexcept {
 	bool changes_made = transaction.ChangesMade();
+	// the transaction cannot modify the database anymore: release the write lock before a postponed background
+	// checkpoint is signalled below
+	transaction.write_lock.reset();
 	// remove the transaction from the list of active transactions
 	idx_t t_index = active_transactions.size();
 	// check for the lowest and highest start time in the list of transactions
@@ -328,6 +467,10 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction) noe
 		// we garbage collected transactions: remove them from the list
 		old_transactions.erase(old_transactions.begin(), old_transactions.begin() + i);
 	}
+	if (background_checkpointer) {
+		// a postponed background checkpoint might be able to run now
+		background_checkpointer->TransactionFinished();
+	}
 }
 
 } // namespace duckdb
@@ -127,21 +127,22 @@ void MetaTransaction::SetActiveQuery(transaction_t query_number) {
 	}
 }
 
-void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
+void MetaTransaction::ModifyDatabase(AttachedDatabase &db, bool append_only) {
 	if (db.IsSystem() || db.IsTemporary()) {
 		// we can always modify the system and temp databases
 		return;
 	}
 	if (!modified_database) {
 		modified_database = &db;
-		return;
-	}
-	if (&db != modified_database.get()) {
+	} else if (&db != modified_database.get()) {
 		throw TransactionException(
 		    "Attempting to write to database \"%s\" in a transaction that has already modified database \"%s\" - a "
 		    "single transaction can only write to a single attached database.",
 		    db.GetName(), modified_database->GetName());
 	}
+	if (!append_only) {
+		GetTransaction(db).SetReadWrite();
+	}
 }
 
 } // namespace duckdb
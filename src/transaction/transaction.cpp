@@ -21,4 +21,7 @@ bool Transaction::IsReadOnly() {
 	return MetaTransaction::Get(*ctxt).ModifiedDatabase().get() != &db;
 }
 
+void Transaction::SetReadWrite() {
+}
+
 } // namespace duckdb
@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <thread>
 
@@ -115,3 +116,84 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+//! A task that records its name every time it is executed, and that takes "steps" partial executions to finish
+class RecordingTask : public Task {
+public:
+	RecordingTask(duckdb::vector<string> &order, string name, idx_t steps = 1,
+	              std::function<void()> on_execute = nullptr)
+	    : order(order), name(std::move(name)), steps(steps), on_execute(std::move(on_execute)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		order.push_back(name);
+		if (on_execute) {
+			auto callback = std::move(on_execute);
+			on_execute = nullptr;
+			callback();
+		}
+		if (--steps > 0 && mode == TaskExecutionMode::PROCESS_PARTIAL) {
+			return TaskExecutionResult::TASK_NOT_FINISHED;
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	duckdb::vector<string> &order;
+	string name;
+	idx_t steps;
+	std::function<void()> on_execute;
+};
+
+TEST_CASE("Test interleaving the tasks of concurrent producers", "[api]") {
+	// without background threads, this thread executes all tasks in the order the scheduler selects them
+	DBConfig config;
+	config.options.maximum_threads = 1;
+	atomic<bool> marker(true);
+	duckdb::vector<string> order;
+
+	SECTION("Producers of the same class take turns") {
+		DuckDB db(nullptr, &config);
+		auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+		auto producer_a = scheduler.CreateProducer(TaskPriority::NORMAL);
+		auto producer_b = scheduler.CreateProducer(TaskPriority::NORMAL);
+		for (idx_t i = 0; i < 10; i++) {
+			scheduler.ScheduleTask(*producer_a, make_shared<RecordingTask>(order, "a"));
+		}
+		for (idx_t i = 0; i < 10; i++) {
+			scheduler.ScheduleTask(*producer_b, make_shared<RecordingTask>(order, "b"));
+		}
+		REQUIRE(scheduler.ExecuteTasks(&marker, 20) == 20);
+		REQUIRE(order.size() == 20);
+		for (idx_t i = 0; i < order.size(); i += 2) {
+			REQUIRE(order[i] != order[i + 1]);
+		}
+	}
+	SECTION("Producers of a higher class receive a larger share") {
+		DuckDB db(nullptr, &config);
+		auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+		auto normal = scheduler.CreateProducer(TaskPriority::NORMAL);
+		auto high = scheduler.CreateProducer(TaskPriority::HIGH);
+		for (idx_t i = 0; i < 20; i++) {
+			scheduler.ScheduleTask(*normal, make_shared<RecordingTask>(order, "normal"));
+			scheduler.ScheduleTask(*high, make_shared<RecordingTask>(order, "high"));
+		}
+		REQUIRE(scheduler.ExecuteTasks(&marker, 10) == 10);
+		REQUIRE(std::count(order.begin(), order.end(), "high") == 8);
+		REQUIRE(scheduler.ExecuteTasks(&marker, 30) == 30);
+	}
+	SECTION("Tasks of a lower class yield to tasks of a higher class") {
+		DuckDB db(nullptr, &config);
+		auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+		auto normal = scheduler.CreateProducer(TaskPriority::NORMAL);
+		auto high = scheduler.CreateProducer(TaskPriority::HIGH);
+		auto schedule_high = [&]() {
+			scheduler.ScheduleTask(*high, make_shared<RecordingTask>(order, "high"));
+		};
+		scheduler.ScheduleTask(*normal, make_shared<RecordingTask>(order, "normal", 3, schedule_high));
+		REQUIRE(scheduler.ExecuteTasks(&marker, 2) == 2);
+		REQUIRE(order == duckdb::vector<string> {"normal", "high", "normal", "normal"});
+		REQUIRE(high->statistics->tasks_executed == 1);
+		REQUIRE(normal->statistics->tasks_preempted == 1);
+	}
+}
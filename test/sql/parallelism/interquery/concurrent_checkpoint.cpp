@@ -311,3 +311,138 @@ TEST_CASE("Concurrent commits on persistent database with automatic checkpoints"
 	result = con.Query("SELECT SUM(money) FROM accounts");
 	REQUIRE(CHECK_COLUMN(result, 0, {ACCOUNTS * ConcurrentCheckpoint::CONCURRENT_UPDATE_MONEY_PER_ACCOUNT}));
 }
+
+static idx_t BackgroundCheckpointCount(Connection &con) {
+	auto result =
+	    con.Query("SELECT checkpoint_count FROM duckdb_checkpoint_stats() WHERE database_name='bg_checkpoint'");
+	REQUIRE_NO_FAIL(*result);
+	return result->GetValue(0, 0).GetValue<idx_t>();
+}
+
+TEST_CASE("Background checkpoints with concurrent readers and updaters", "[interquery][.]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("bg_checkpoint");
+	DeleteDatabase(storage_database);
+	duckdb::unique_ptr<MaterializedQueryResult> result;
+	config->options.checkpoint_wal_size = 1;
+	config->options.background_checkpoint = true;
+	// checkpoints postponed by the updaters for longer than this block new updaters
+	config->options.background_checkpoint_timeout = 100;
+	DuckDB db(storage_database, config.get());
+	Connection con(db);
+
+	ConcurrentCheckpoint::finished = false;
+	ConcurrentCheckpoint::finished_threads = 0;
+	// initialize the database
+	con.Query("BEGIN TRANSACTION");
+	con.Query("CREATE TABLE accounts(id INTEGER, money INTEGER)");
+	for (size_t i = 0; i < ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS; i++) {
+		con.Query("INSERT INTO accounts VALUES (" + to_string(i) + ", " +
+		          to_string(ConcurrentCheckpoint::CONCURRENT_UPDATE_MONEY_PER_ACCOUNT) + ");");
+	}
+	con.Query("COMMIT");
+
+	// readers check the total balance while the background thread checkpoints the updates
+	atomic<bool> read_correct(true);
+	auto read_accounts = [&]() {
+		Connection read_con(db);
+		while (!ConcurrentCheckpoint::finished) {
+			auto read_result = read_con.Query("SELECT SUM(money) FROM accounts");
+			if (!CHECK_COLUMN(read_result, 0,
+			                  {ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS *
+			                   ConcurrentCheckpoint::CONCURRENT_UPDATE_MONEY_PER_ACCOUNT})) {
+				read_correct = false;
+			}
+		}
+	};
+	bool correct[ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS];
+	std::thread write_threads[ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS];
+	thread read_threads[2] = {thread(read_accounts), thread(read_accounts)};
+	for (size_t i = 0; i < ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS; i++) {
+		write_threads[i] = thread(ConcurrentCheckpoint::WriteRandomNumbers, &db, correct, i);
+	}
+	for (size_t i = 0; i < ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS; i++) {
+		write_threads[i].join();
+		REQUIRE(correct[i]);
+	}
+	for (auto &read_thread : read_threads) {
+		read_thread.join();
+	}
+	REQUIRE(read_correct);
+
+	// an open updater postpones the checkpoint past the timeout: transactions can still start and read
+	Connection update_con(db);
+	REQUIRE_NO_FAIL(update_con.Query("BEGIN TRANSACTION"));
+	REQUIRE_NO_FAIL(update_con.Query("UPDATE accounts SET money = money"));
+	auto checkpoint_count = BackgroundCheckpointCount(con);
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO accounts VALUES (100, 0)"));
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	result = con.Query("SELECT SUM(money) FROM accounts");
+	REQUIRE(CHECK_COLUMN(result, 0,
+	                     {ConcurrentCheckpoint::CONCURRENT_UPDATE_TOTAL_ACCOUNTS *
+	                      ConcurrentCheckpoint::CONCURRENT_UPDATE_MONEY_PER_ACCOUNT}));
+	REQUIRE(BackgroundCheckpointCount(con) == checkpoint_count);
+	REQUIRE_NO_FAIL(update_con.Query("COMMIT"));
+
+	// once the updater has finished the background thread checkpoints
+	for (idx_t i = 0; i < 600 && BackgroundCheckpointCount(con) == checkpoint_count; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	REQUIRE(BackgroundCheckpointCount(con) > checkpoint_count);
+}
+
+TEST_CASE("Background checkpoints with concurrent appenders", "[interquery][.]") {
+	static constexpr idx_t APPEND_THREADS = 4;
+	static constexpr idx_t APPENDS_PER_THREAD = 50;
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("bg_checkpoint");
+	DeleteDatabase(storage_database);
+	duckdb::unique_ptr<MaterializedQueryResult> result;
+	config->options.checkpoint_wal_size = 1;
+	config->options.background_checkpoint = true;
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+
+		// a transaction that only appends does not postpone the checkpoint
+		Connection append_con(db);
+		REQUIRE_NO_FAIL(append_con.Query("BEGIN TRANSACTION"));
+		REQUIRE_NO_FAIL(append_con.Query("INSERT INTO integers VALUES (0)"));
+		auto checkpoint_count = BackgroundCheckpointCount(con);
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (0)"));
+		for (idx_t i = 0; i < 600 && BackgroundCheckpointCount(con) == checkpoint_count; i++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		}
+		REQUIRE(BackgroundCheckpointCount(con) > checkpoint_count);
+		REQUIRE_NO_FAIL(append_con.Query("COMMIT"));
+
+		// appenders keep committing while the background thread checkpoints their earlier commits
+		atomic<bool> append_correct(true);
+		auto append_integers = [&]() {
+			Connection thread_con(db);
+			for (idx_t i = 0; i < APPENDS_PER_THREAD; i++) {
+				if (thread_con.Query("INSERT INTO integers SELECT * FROM range(100)")->HasError()) {
+					append_correct = false;
+				}
+			}
+		};
+		thread append_threads[APPEND_THREADS];
+		for (auto &append_thread : append_threads) {
+			append_thread = thread(append_integers);
+		}
+		for (auto &append_thread : append_threads) {
+			append_thread.join();
+		}
+		REQUIRE(append_correct);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(2 + APPEND_THREADS * APPENDS_PER_THREAD * 100)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(APPEND_THREADS * APPENDS_PER_THREAD * 4950)}));
+	}
+	// the commits made while the checkpoints ran are durable
+	DuckDB db(storage_database, config.get());
+	Connection con(db);
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(2 + APPEND_THREADS * APPENDS_PER_THREAD * 100)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(APPEND_THREADS * APPENDS_PER_THREAD * 4950)}));
+}
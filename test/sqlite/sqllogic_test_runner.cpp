@@ -204,6 +204,7 @@ bool SQLLogicTestRunner::ForEachTokenReplace(const string &parameter, vector<str
 		result.push_back("fsst");
 		result.push_back("alp");
 		result.push_back("alprd");
+		result.push_back("zstd");
 		collection = true;
 	}
 	return collection;
@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -362,6 +363,17 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 		}
 		return expression;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		py::object expression = py::none();
+		for (auto &value : in_filter.values) {
+			auto constant_value = GetScalar(value, timezone_config, type);
+			auto child_expression = constant_field.attr("__eq__")(constant_value);
+			expression = expression.is_none() ? child_expression : expression.attr("__or__")(child_expression);
+		}
+		return expression;
+	}
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter->Cast<StructFilter>();
 		auto &child_type = StructType::GetChildType(type.GetDuckType(), struct_filter.child_idx);